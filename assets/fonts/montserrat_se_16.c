@@ -0,0 +1,2841 @@
+/*******************************************************************************
+ * Size: 16 px
+ * Bpp: 4
+ * Opts: --bpp 4 --size 16 --no-compress --stride 1 --align 1 --font Montserrat.ttf --symbols ÅÄÖ --range 32-255 --font NotoEmoji-VariableFont_wght.ttf --symbols ☀⛅☁🌫🌧⛈⚡🌨❄ --format lvgl -o montserrat_se_16.c
+ ******************************************************************************/
+
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+
+
+#ifndef MONTSERRAT_SE_16
+#define MONTSERRAT_SE_16 1
+#endif
+
+#if MONTSERRAT_SE_16
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x9b, 0x8b, 0x8a, 0x8a, 0x79, 0x79, 0x69, 0x68,
+    0x12, 0x0, 0x57, 0x8b,
+
+    /* U+0022 "\"" */
+    0xe1, 0x2d, 0xd1, 0x2d, 0xd1, 0x1c, 0xd0, 0x1c,
+    0x60, 0x5,
+
+    /* U+0023 "#" */
+    0x0, 0x5, 0x80, 0x2, 0xb0, 0x0, 0x0, 0x76,
+    0x0, 0x49, 0x0, 0x0, 0x9, 0x40, 0x6, 0x70,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xc,
+    0x10, 0xa, 0x30, 0x0, 0x0, 0xd0, 0x0, 0xb2,
+    0x0, 0x0, 0xd, 0x0, 0xd, 0x0, 0x0, 0x1,
+    0xc0, 0x0, 0xd0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0x20, 0x5, 0x80, 0x2, 0xb0, 0x0, 0x0,
+    0x76, 0x0, 0x49, 0x0, 0x0, 0x9, 0x40, 0x6,
+    0x70, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x66, 0x0, 0x0, 0x0, 0x0, 0x66,
+    0x0, 0x0, 0x0, 0x5c, 0xff, 0xd8, 0x10, 0x6,
+    0xe6, 0x87, 0x4a, 0x60, 0xd, 0x50, 0x66, 0x0,
+    0x0, 0xe, 0x30, 0x66, 0x0, 0x0, 0xb, 0xb1,
+    0x66, 0x0, 0x0, 0x1, 0xcf, 0xd9, 0x10, 0x0,
+    0x0, 0x3, 0xae, 0xfb, 0x10, 0x0, 0x0, 0x66,
+    0x2c, 0xb0, 0x0, 0x0, 0x66, 0x2, 0xf0, 0x2,
+    0x0, 0x66, 0x3, 0xf0, 0x1e, 0x83, 0x76, 0x4d,
+    0x80, 0x2, 0x9e, 0xff, 0xd7, 0x0, 0x0, 0x0,
+    0x66, 0x0, 0x0, 0x0, 0x0, 0x66, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x3, 0xcc, 0x70, 0x0, 0x5, 0x90, 0x0, 0xc1,
+    0x9, 0x40, 0x1, 0xc1, 0x0, 0x39, 0x0, 0x39,
+    0x0, 0x95, 0x0, 0x4, 0x70, 0x1, 0xb0, 0x4b,
+    0x0, 0x0, 0x39, 0x0, 0x39, 0xc, 0x10, 0x0,
+    0x0, 0xc2, 0xa, 0x38, 0x60, 0x0, 0x0, 0x2,
+    0xbb, 0x52, 0xc0, 0x4b, 0xb5, 0x0, 0x0, 0x0,
+    0xc2, 0x1c, 0x0, 0xb3, 0x0, 0x0, 0x68, 0x6,
+    0x60, 0x4, 0x80, 0x0, 0x1c, 0x0, 0x66, 0x0,
+    0x48, 0x0, 0xb, 0x30, 0x2, 0xb0, 0x9, 0x40,
+    0x5, 0x90, 0x0, 0x6, 0xbb, 0x70,
+
+    /* U+0026 "&" */
+    0x0, 0x9, 0xee, 0x90, 0x0, 0x0, 0x8, 0xa0,
+    0xa, 0x60, 0x0, 0x0, 0xc4, 0x0, 0x69, 0x0,
+    0x0, 0x9, 0x80, 0xc, 0x40, 0x0, 0x0, 0x2e,
+    0x7d, 0x70, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0,
+    0x0, 0x1, 0xd7, 0x5e, 0x20, 0x4, 0x0, 0xc6,
+    0x0, 0x6e, 0x14, 0xb0, 0x2f, 0x0, 0x0, 0x7d,
+    0xb6, 0x2, 0xf1, 0x0, 0x0, 0xaf, 0x10, 0xb,
+    0xc3, 0x2, 0x7e, 0xab, 0x0, 0x8, 0xef, 0xe9,
+    0x10, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0027 "'" */
+    0xe1, 0xd1, 0xd1, 0xd0, 0x60,
+
+    /* U+0028 "(" */
+    0x0, 0xb6, 0x2, 0xe0, 0x8, 0x90, 0xd, 0x40,
+    0xf, 0x10, 0x2e, 0x0, 0x4d, 0x0, 0x5c, 0x0,
+    0x5c, 0x0, 0x4d, 0x0, 0x2e, 0x0, 0xf, 0x10,
+    0xd, 0x40, 0x8, 0x90, 0x2, 0xe0, 0x0, 0xb6,
+
+    /* U+0029 ")" */
+    0x2e, 0x0, 0xa, 0x60, 0x5, 0xc0, 0x0, 0xf1,
+    0x0, 0xd4, 0x0, 0xa6, 0x0, 0x98, 0x0, 0x89,
+    0x0, 0x89, 0x0, 0x98, 0x0, 0xa6, 0x0, 0xd4,
+    0x0, 0xf1, 0x5, 0xc0, 0xa, 0x60, 0x2e, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x47, 0x0, 0x55, 0x47, 0x47, 0x9, 0xdd,
+    0xa1, 0x6, 0xee, 0x80, 0x68, 0x47, 0x68, 0x0,
+    0x47, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x2, 0x0, 0x0, 0x0, 0xe, 0x10, 0x0,
+    0x0, 0xe, 0x10, 0x0, 0x0, 0xe, 0x10, 0x0,
+    0xef, 0xff, 0xff, 0xf1, 0x0, 0xe, 0x10, 0x0,
+    0x0, 0xe, 0x10, 0x0, 0x0, 0xe, 0x10, 0x0,
+
+    /* U+002C "," */
+    0x2, 0x0, 0xf7, 0xb, 0x60, 0xc1, 0xc, 0x0,
+
+    /* U+002D "-" */
+    0xf, 0xff, 0xf2, 0x1, 0x11, 0x10,
+
+    /* U+002E "." */
+    0xb, 0x40, 0xe6,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x4, 0xc0, 0x0, 0x0, 0x96, 0x0,
+    0x0, 0xe, 0x10, 0x0, 0x4, 0xc0, 0x0, 0x0,
+    0x96, 0x0, 0x0, 0xe, 0x10, 0x0, 0x4, 0xc0,
+    0x0, 0x0, 0x97, 0x0, 0x0, 0xe, 0x10, 0x0,
+    0x4, 0xc0, 0x0, 0x0, 0x97, 0x0, 0x0, 0xe,
+    0x20, 0x0, 0x4, 0xc0, 0x0, 0x0, 0x97, 0x0,
+    0x0, 0xe, 0x20, 0x0, 0x3, 0xc0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x8, 0xef, 0xc4, 0x0, 0x0, 0xcc, 0x42,
+    0x6f, 0x50, 0x6, 0xd0, 0x0, 0x4, 0xf1, 0xc,
+    0x60, 0x0, 0x0, 0xc6, 0xf, 0x20, 0x0, 0x0,
+    0x8a, 0x2f, 0x0, 0x0, 0x0, 0x7b, 0x2f, 0x0,
+    0x0, 0x0, 0x7b, 0xf, 0x20, 0x0, 0x0, 0x8a,
+    0xc, 0x60, 0x0, 0x0, 0xc6, 0x6, 0xd0, 0x0,
+    0x4, 0xf1, 0x0, 0xcc, 0x42, 0x6f, 0x60, 0x0,
+    0x8, 0xef, 0xc4, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xff, 0x11, 0x4f, 0x0, 0x3f, 0x0, 0x3f,
+    0x0, 0x3f, 0x0, 0x3f, 0x0, 0x3f, 0x0, 0x3f,
+    0x0, 0x3f, 0x0, 0x3f, 0x0, 0x3f, 0x0, 0x3f,
+
+    /* U+0032 "2" */
+    0x4, 0xbe, 0xfd, 0x60, 0x6, 0xe7, 0x32, 0x6f,
+    0x60, 0x12, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x0,
+    0x4, 0xe0, 0x0, 0x0, 0x0, 0x7b, 0x0, 0x0,
+    0x0, 0x2e, 0x40, 0x0, 0x0, 0x1d, 0x80, 0x0,
+    0x0, 0x1d, 0x90, 0x0, 0x0, 0xc, 0x90, 0x0,
+    0x0, 0xc, 0xa0, 0x0, 0x0, 0xb, 0xc1, 0x11,
+    0x11, 0x5, 0xff, 0xff, 0xff, 0xf7,
+
+    /* U+0033 "3" */
+    0x6f, 0xff, 0xff, 0xfc, 0x0, 0x11, 0x11, 0x2e,
+    0x50, 0x0, 0x0, 0xb, 0x80, 0x0, 0x0, 0x8,
+    0xc0, 0x0, 0x0, 0x5, 0xe1, 0x0, 0x0, 0x0,
+    0xcf, 0xd8, 0x0, 0x0, 0x0, 0x3, 0xda, 0x0,
+    0x0, 0x0, 0x2, 0xf1, 0x0, 0x0, 0x0, 0xf,
+    0x33, 0x0, 0x0, 0x3, 0xf1, 0x9d, 0x63, 0x26,
+    0xe8, 0x0, 0x6c, 0xff, 0xd6, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0xc8, 0x0, 0x0, 0x0, 0x0,
+    0x8c, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x20, 0x0,
+    0x0, 0x0, 0xe, 0x50, 0x0, 0x0, 0x0, 0xa,
+    0xa0, 0x0, 0x0, 0x0, 0x6, 0xe1, 0x0, 0xf1,
+    0x0, 0x2, 0xf3, 0x0, 0xf, 0x10, 0x0, 0xc8,
+    0x0, 0x0, 0xf1, 0x0, 0x5f, 0xff, 0xff, 0xff,
+    0xff, 0x50, 0x22, 0x22, 0x22, 0xf3, 0x20, 0x0,
+    0x0, 0x0, 0xf, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xf1, 0x0,
+
+    /* U+0035 "5" */
+    0x5, 0xff, 0xff, 0xfd, 0x0, 0x6b, 0x11, 0x11,
+    0x10, 0x8, 0x90, 0x0, 0x0, 0x0, 0x97, 0x0,
+    0x0, 0x0, 0xb, 0x60, 0x0, 0x0, 0x0, 0xcf,
+    0xfe, 0xc7, 0x0, 0x1, 0x22, 0x35, 0xdc, 0x0,
+    0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0xc,
+    0x61, 0x10, 0x0, 0x1, 0xf4, 0x6e, 0x73, 0x24,
+    0xcc, 0x0, 0x4b, 0xef, 0xe8, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x6, 0xcf, 0xfc, 0x40, 0x0, 0xad, 0x51,
+    0x26, 0x30, 0x5, 0xe1, 0x0, 0x0, 0x0, 0xc,
+    0x60, 0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0,
+    0x0, 0x1f, 0x6, 0xce, 0xc6, 0x0, 0x2f, 0x9a,
+    0x32, 0x5d, 0x90, 0x1f, 0xb0, 0x0, 0x2, 0xf1,
+    0xe, 0x70, 0x0, 0x0, 0xf3, 0x8, 0xa0, 0x0,
+    0x2, 0xf1, 0x0, 0xd9, 0x21, 0x4d, 0x90, 0x0,
+    0x19, 0xef, 0xd7, 0x0,
+
+    /* U+0037 "7" */
+    0x7f, 0xff, 0xff, 0xff, 0xb7, 0xa1, 0x11, 0x11,
+    0xc7, 0x7a, 0x0, 0x0, 0x3f, 0x12, 0x30, 0x0,
+    0x9, 0x90, 0x0, 0x0, 0x1, 0xf3, 0x0, 0x0,
+    0x0, 0x7c, 0x0, 0x0, 0x0, 0xd, 0x50, 0x0,
+    0x0, 0x4, 0xe0, 0x0, 0x0, 0x0, 0xb8, 0x0,
+    0x0, 0x0, 0x2f, 0x10, 0x0, 0x0, 0x9, 0xa0,
+    0x0, 0x0, 0x0, 0xf4, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x4c, 0xef, 0xd7, 0x0, 0x5, 0xf6, 0x11,
+    0x4d, 0x80, 0xc, 0x70, 0x0, 0x4, 0xf0, 0xc,
+    0x60, 0x0, 0x3, 0xf0, 0x5, 0xe5, 0x0, 0x3d,
+    0x80, 0x0, 0x8f, 0xff, 0xfb, 0x0, 0x8, 0xd4,
+    0x0, 0x3c, 0xb0, 0x1f, 0x20, 0x0, 0x0, 0xf4,
+    0x3f, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x30, 0x0,
+    0x1, 0xf4, 0x8, 0xe5, 0x11, 0x4c, 0xb0, 0x0,
+    0x5c, 0xef, 0xd7, 0x0,
+
+    /* U+0039 "9" */
+    0x1, 0x9e, 0xfd, 0x70, 0x0, 0xcb, 0x31, 0x3c,
+    0xa0, 0x5d, 0x0, 0x0, 0xe, 0x47, 0xa0, 0x0,
+    0x0, 0xb9, 0x5d, 0x0, 0x0, 0xe, 0xc0, 0xe9,
+    0x10, 0x1a, 0xbe, 0x2, 0xbf, 0xfe, 0x74, 0xd0,
+    0x0, 0x1, 0x0, 0x6c, 0x0, 0x0, 0x0, 0xa,
+    0x70, 0x0, 0x0, 0x3, 0xf2, 0x5, 0x41, 0x27,
+    0xe6, 0x0, 0x6d, 0xfe, 0xb3, 0x0,
+
+    /* U+003A ":" */
+    0xe, 0x60, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb4, 0xe, 0x60,
+
+    /* U+003B ";" */
+    0xe, 0x60, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe5, 0xd, 0x70, 0xb2, 0xc,
+    0x0, 0x20,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x5c, 0xd0,
+    0x1, 0x8e, 0xa4, 0x0, 0x9e, 0x81, 0x0, 0x0,
+    0xbd, 0x60, 0x0, 0x0, 0x3, 0xae, 0x82, 0x0,
+    0x0, 0x1, 0x7e, 0xb0, 0x0, 0x0, 0x0, 0x50,
+
+    /* U+003D "=" */
+    0xef, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xff, 0xff, 0xf1,
+
+    /* U+003E ">" */
+    0x30, 0x0, 0x0, 0x0, 0xad, 0x71, 0x0, 0x0,
+    0x2, 0x9e, 0x92, 0x0, 0x0, 0x0, 0x6d, 0xb0,
+    0x0, 0x0, 0x4b, 0xd0, 0x1, 0x7d, 0xb4, 0x0,
+    0x9e, 0x92, 0x0, 0x0, 0x50, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x5, 0xbe, 0xfc, 0x60, 0x7e, 0x62, 0x26, 0xf6,
+    0x11, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x5c,
+    0x0, 0x0, 0x0, 0xc7, 0x0, 0x0, 0xb, 0xa0,
+    0x0, 0x0, 0xab, 0x0, 0x0, 0x1, 0xf1, 0x0,
+    0x0, 0x1, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x90, 0x0, 0x0, 0x4, 0xe1, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x17, 0xcd, 0xdd, 0xa4, 0x0, 0x0,
+    0x0, 0x5, 0xd7, 0x10, 0x0, 0x3a, 0xc1, 0x0,
+    0x0, 0x6c, 0x10, 0x0, 0x0, 0x0, 0x4d, 0x10,
+    0x2, 0xd1, 0x1, 0xae, 0xfa, 0x1c, 0x45, 0xa0,
+    0x9, 0x50, 0xd, 0x81, 0x5, 0xdd, 0x40, 0xc2,
+    0xe, 0x0, 0x8a, 0x0, 0x0, 0x4f, 0x40, 0x67,
+    0xd, 0x0, 0xc4, 0x0, 0x0, 0xe, 0x40, 0x39,
+    0x2b, 0x0, 0xe2, 0x0, 0x0, 0xc, 0x40, 0x2b,
+    0xd, 0x0, 0xc4, 0x0, 0x0, 0xe, 0x40, 0x39,
+    0xe, 0x0, 0x8a, 0x0, 0x0, 0x4f, 0x40, 0x67,
+    0x9, 0x50, 0xd, 0x81, 0x4, 0xcb, 0x71, 0xc1,
+    0x2, 0xd1, 0x1, 0xae, 0xeb, 0x23, 0xde, 0x60,
+    0x0, 0x6b, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xd6, 0x10, 0x0, 0x33, 0x0, 0x0,
+    0x0, 0x0, 0x17, 0xcd, 0xdd, 0x92, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7d, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0xd6,
+    0x0, 0x0, 0x0, 0x5, 0xe0, 0x6c, 0x0, 0x0,
+    0x0, 0xc, 0x70, 0xf, 0x30, 0x0, 0x0, 0x3f,
+    0x10, 0x9, 0xa0, 0x0, 0x0, 0x9a, 0x0, 0x3,
+    0xf1, 0x0, 0x1, 0xf4, 0x0, 0x0, 0xd8, 0x0,
+    0x7, 0xfe, 0xee, 0xee, 0xfe, 0x0, 0xe, 0x71,
+    0x11, 0x11, 0x1e, 0x50, 0x5e, 0x0, 0x0, 0x0,
+    0x8, 0xc0, 0xc7, 0x0, 0x0, 0x0, 0x1, 0xf3,
+
+    /* U+0042 "B" */
+    0x2f, 0xff, 0xff, 0xeb, 0x30, 0x2, 0xf0, 0x0,
+    0x2, 0x8f, 0x30, 0x2f, 0x0, 0x0, 0x0, 0xb8,
+    0x2, 0xf0, 0x0, 0x0, 0xb, 0x80, 0x2f, 0x0,
+    0x0, 0x6, 0xe2, 0x2, 0xfe, 0xee, 0xef, 0xf6,
+    0x0, 0x2f, 0x11, 0x11, 0x26, 0xe7, 0x2, 0xf0,
+    0x0, 0x0, 0x3, 0xf0, 0x2f, 0x0, 0x0, 0x0,
+    0xf, 0x22, 0xf0, 0x0, 0x0, 0x3, 0xf1, 0x2f,
+    0x0, 0x0, 0x14, 0xda, 0x2, 0xff, 0xff, 0xff,
+    0xd7, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x1, 0x8d, 0xfe, 0xb4, 0x0, 0x4, 0xeb,
+    0x52, 0x37, 0xe7, 0x2, 0xf6, 0x0, 0x0, 0x2,
+    0x20, 0xaa, 0x0, 0x0, 0x0, 0x0, 0xf, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x22, 0x0,
+    0x4f, 0xb4, 0x23, 0x7e, 0x70, 0x0, 0x29, 0xdf,
+    0xeb, 0x40,
+
+    /* U+0044 "D" */
+    0x2f, 0xff, 0xff, 0xda, 0x30, 0x0, 0x2f, 0x11,
+    0x11, 0x38, 0xf7, 0x0, 0x2f, 0x0, 0x0, 0x0,
+    0x3f, 0x50, 0x2f, 0x0, 0x0, 0x0, 0x6, 0xd0,
+    0x2f, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x2f, 0x0,
+    0x0, 0x0, 0x0, 0xd5, 0x2f, 0x0, 0x0, 0x0,
+    0x0, 0xd5, 0x2f, 0x0, 0x0, 0x0, 0x0, 0xf3,
+    0x2f, 0x0, 0x0, 0x0, 0x6, 0xd0, 0x2f, 0x0,
+    0x0, 0x0, 0x3f, 0x50, 0x2f, 0x11, 0x11, 0x39,
+    0xf7, 0x0, 0x2f, 0xff, 0xff, 0xea, 0x30, 0x0,
+
+    /* U+0045 "E" */
+    0x2f, 0xff, 0xff, 0xff, 0x82, 0xf1, 0x11, 0x11,
+    0x10, 0x2f, 0x0, 0x0, 0x0, 0x2, 0xf0, 0x0,
+    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xff, 0xb0, 0x2f, 0x22, 0x22, 0x21, 0x2,
+    0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0,
+    0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x11, 0x11,
+    0x11, 0x12, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+0046 "F" */
+    0x2f, 0xff, 0xff, 0xff, 0x82, 0xf1, 0x11, 0x11,
+    0x10, 0x2f, 0x0, 0x0, 0x0, 0x2, 0xf0, 0x0,
+    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfb, 0x2,
+    0xf2, 0x22, 0x22, 0x10, 0x2f, 0x0, 0x0, 0x0,
+    0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0,
+    0x0, 0x2, 0xf0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x1, 0x8d, 0xfe, 0xb5, 0x0, 0x4, 0xeb,
+    0x52, 0x36, 0xe9, 0x2, 0xf7, 0x0, 0x0, 0x1,
+    0x30, 0xaa, 0x0, 0x0, 0x0, 0x0, 0xf, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0x0, 0x0, 0x0, 0x4, 0xd0, 0xf3,
+    0x0, 0x0, 0x0, 0x4d, 0xa, 0xa0, 0x0, 0x0,
+    0x4, 0xd0, 0x2f, 0x70, 0x0, 0x0, 0x4d, 0x0,
+    0x4e, 0xb5, 0x23, 0x7e, 0xa0, 0x0, 0x18, 0xdf,
+    0xeb, 0x50,
+
+    /* U+0048 "H" */
+    0x2f, 0x0, 0x0, 0x0, 0xf, 0x32, 0xf0, 0x0,
+    0x0, 0x0, 0xf3, 0x2f, 0x0, 0x0, 0x0, 0xf,
+    0x32, 0xf0, 0x0, 0x0, 0x0, 0xf3, 0x2f, 0x0,
+    0x0, 0x0, 0xf, 0x32, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x2f, 0x22, 0x22, 0x22, 0x2f, 0x32, 0xf0,
+    0x0, 0x0, 0x0, 0xf3, 0x2f, 0x0, 0x0, 0x0,
+    0xf, 0x32, 0xf0, 0x0, 0x0, 0x0, 0xf3, 0x2f,
+    0x0, 0x0, 0x0, 0xf, 0x32, 0xf0, 0x0, 0x0,
+    0x0, 0xf3,
+
+    /* U+0049 "I" */
+    0x2f, 0x2, 0xf0, 0x2f, 0x2, 0xf0, 0x2f, 0x2,
+    0xf0, 0x2f, 0x2, 0xf0, 0x2f, 0x2, 0xf0, 0x2f,
+    0x2, 0xf0,
+
+    /* U+004A "J" */
+    0x0, 0xff, 0xff, 0xf4, 0x0, 0x11, 0x11, 0xe4,
+    0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0xe4,
+    0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0xe4,
+    0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0, 0xe4,
+    0x0, 0x0, 0x0, 0xe3, 0x3, 0x0, 0x1, 0xf1,
+    0xd, 0xa2, 0x2b, 0xb0, 0x1, 0xaf, 0xea, 0x10,
+
+    /* U+004B "K" */
+    0x2f, 0x0, 0x0, 0x0, 0xd7, 0x2, 0xf0, 0x0,
+    0x0, 0xb9, 0x0, 0x2f, 0x0, 0x0, 0xab, 0x0,
+    0x2, 0xf0, 0x0, 0x9c, 0x0, 0x0, 0x2f, 0x0,
+    0x7d, 0x10, 0x0, 0x2, 0xf0, 0x6f, 0x40, 0x0,
+    0x0, 0x2f, 0x5f, 0xbd, 0x10, 0x0, 0x2, 0xff,
+    0x40, 0xcb, 0x0, 0x0, 0x2f, 0x50, 0x1, 0xe8,
+    0x0, 0x2, 0xf0, 0x0, 0x3, 0xf4, 0x0, 0x2f,
+    0x0, 0x0, 0x5, 0xf2, 0x2, 0xf0, 0x0, 0x0,
+    0x8, 0xd0,
+
+    /* U+004C "L" */
+    0x2f, 0x0, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0,
+    0x0, 0x2f, 0x0, 0x0, 0x0, 0x2, 0xf0, 0x0,
+    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2,
+    0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0,
+    0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x11, 0x11,
+    0x11, 0x2, 0xff, 0xff, 0xff, 0xf4,
+
+    /* U+004D "M" */
+    0x2f, 0x10, 0x0, 0x0, 0x0, 0xc, 0x72, 0xf9,
+    0x0, 0x0, 0x0, 0x5, 0xf7, 0x2f, 0xe2, 0x0,
+    0x0, 0x0, 0xde, 0x72, 0xf7, 0xb0, 0x0, 0x0,
+    0x6b, 0xb7, 0x2f, 0xe, 0x40, 0x0, 0xe, 0x2b,
+    0x72, 0xf0, 0x5c, 0x0, 0x8, 0xa0, 0xb7, 0x2f,
+    0x0, 0xd5, 0x1, 0xe1, 0xb, 0x72, 0xf0, 0x4,
+    0xd0, 0x98, 0x0, 0xb7, 0x2f, 0x0, 0xb, 0x9e,
+    0x10, 0xb, 0x72, 0xf0, 0x0, 0x2f, 0x70, 0x0,
+    0xb7, 0x2f, 0x0, 0x0, 0x50, 0x0, 0xb, 0x72,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0xb7,
+
+    /* U+004E "N" */
+    0x2f, 0x30, 0x0, 0x0, 0xf, 0x32, 0xfd, 0x0,
+    0x0, 0x0, 0xf3, 0x2f, 0xca, 0x0, 0x0, 0xf,
+    0x32, 0xf2, 0xf6, 0x0, 0x0, 0xf3, 0x2f, 0x5,
+    0xf2, 0x0, 0xf, 0x32, 0xf0, 0x9, 0xd0, 0x0,
+    0xf3, 0x2f, 0x0, 0xd, 0x90, 0xf, 0x32, 0xf0,
+    0x0, 0x2f, 0x50, 0xf3, 0x2f, 0x0, 0x0, 0x6f,
+    0x2f, 0x32, 0xf0, 0x0, 0x0, 0xac, 0xf3, 0x2f,
+    0x0, 0x0, 0x0, 0xdf, 0x32, 0xf0, 0x0, 0x0,
+    0x3, 0xf3,
+
+    /* U+004F "O" */
+    0x0, 0x1, 0x8d, 0xfe, 0xb4, 0x0, 0x0, 0x4,
+    0xeb, 0x42, 0x38, 0xe9, 0x0, 0x2, 0xf6, 0x0,
+    0x0, 0x2, 0xd8, 0x0, 0xaa, 0x0, 0x0, 0x0,
+    0x3, 0xf1, 0xf, 0x30, 0x0, 0x0, 0x0, 0xd,
+    0x61, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x1f,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0x80, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xd6, 0xa, 0xa0, 0x0, 0x0,
+    0x0, 0x3f, 0x10, 0x2f, 0x60, 0x0, 0x0, 0x2d,
+    0x80, 0x0, 0x4e, 0xb4, 0x23, 0x7e, 0xa0, 0x0,
+    0x0, 0x18, 0xdf, 0xeb, 0x40, 0x0,
+
+    /* U+0050 "P" */
+    0x2f, 0xff, 0xff, 0xd7, 0x0, 0x2f, 0x11, 0x12,
+    0x5d, 0xb0, 0x2f, 0x0, 0x0, 0x1, 0xe4, 0x2f,
+    0x0, 0x0, 0x0, 0xb8, 0x2f, 0x0, 0x0, 0x0,
+    0xa8, 0x2f, 0x0, 0x0, 0x0, 0xe5, 0x2f, 0x0,
+    0x0, 0x3c, 0xd0, 0x2f, 0xff, 0xff, 0xf9, 0x10,
+    0x2f, 0x22, 0x21, 0x0, 0x0, 0x2f, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x1, 0x8d, 0xfe, 0xb4, 0x0, 0x0, 0x0,
+    0x4e, 0xb4, 0x23, 0x8e, 0x90, 0x0, 0x2, 0xf6,
+    0x0, 0x0, 0x2, 0xe8, 0x0, 0xa, 0xa0, 0x0,
+    0x0, 0x0, 0x4f, 0x10, 0xf, 0x30, 0x0, 0x0,
+    0x0, 0xd, 0x60, 0x1f, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0x80, 0x1f, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0x80, 0xf, 0x30, 0x0, 0x0, 0x0, 0xd, 0x60,
+    0xa, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0x2,
+    0xf6, 0x0, 0x0, 0x1, 0xd8, 0x0, 0x0, 0x4f,
+    0xa4, 0x23, 0x7e, 0xa0, 0x0, 0x0, 0x2, 0x9d,
+    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xb2, 0x4, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8e,
+    0xfc, 0x40,
+
+    /* U+0052 "R" */
+    0x2f, 0xff, 0xff, 0xd7, 0x0, 0x2f, 0x11, 0x12,
+    0x5d, 0xb0, 0x2f, 0x0, 0x0, 0x1, 0xe4, 0x2f,
+    0x0, 0x0, 0x0, 0xb8, 0x2f, 0x0, 0x0, 0x0,
+    0xa8, 0x2f, 0x0, 0x0, 0x0, 0xe5, 0x2f, 0x0,
+    0x0, 0x3c, 0xc0, 0x2f, 0xff, 0xff, 0xf9, 0x10,
+    0x2f, 0x22, 0x21, 0xc7, 0x0, 0x2f, 0x0, 0x0,
+    0x2f, 0x20, 0x2f, 0x0, 0x0, 0x8, 0xc0, 0x2f,
+    0x0, 0x0, 0x0, 0xd7,
+
+    /* U+0053 "S" */
+    0x0, 0x5c, 0xff, 0xd7, 0x0, 0x6, 0xe6, 0x22,
+    0x4b, 0x60, 0xd, 0x60, 0x0, 0x0, 0x0, 0xe,
+    0x30, 0x0, 0x0, 0x0, 0xa, 0xc1, 0x0, 0x0,
+    0x0, 0x1, 0xbf, 0xb6, 0x20, 0x0, 0x0, 0x2,
+    0x7b, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x1b, 0xc0,
+    0x0, 0x0, 0x0, 0x2, 0xf0, 0x3, 0x0, 0x0,
+    0x4, 0xf0, 0x1e, 0xa4, 0x12, 0x5e, 0x80, 0x1,
+    0x8d, 0xff, 0xc6, 0x0,
+
+    /* U+0054 "T" */
+    0xff, 0xff, 0xff, 0xff, 0xf2, 0x11, 0x11, 0xf4,
+    0x11, 0x10, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xf3, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0,
+    0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e,
+    0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0,
+    0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0,
+    0x0, 0x0, 0x3e, 0x3f, 0x0, 0x0, 0x0, 0x4e,
+    0x1f, 0x20, 0x0, 0x0, 0x7b, 0xc, 0x80, 0x0,
+    0x0, 0xd6, 0x3, 0xf9, 0x32, 0x4c, 0xc0, 0x0,
+    0x2a, 0xef, 0xd8, 0x0,
+
+    /* U+0056 "V" */
+    0xc8, 0x0, 0x0, 0x0, 0x4, 0xe0, 0x5e, 0x0,
+    0x0, 0x0, 0xb, 0x80, 0xe, 0x50, 0x0, 0x0,
+    0x1f, 0x10, 0x8, 0xc0, 0x0, 0x0, 0x8b, 0x0,
+    0x1, 0xf2, 0x0, 0x0, 0xe4, 0x0, 0x0, 0xa9,
+    0x0, 0x5, 0xd0, 0x0, 0x0, 0x4f, 0x0, 0xc,
+    0x70, 0x0, 0x0, 0xd, 0x60, 0x2f, 0x10, 0x0,
+    0x0, 0x7, 0xd0, 0x99, 0x0, 0x0, 0x0, 0x1,
+    0xf4, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9e, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x4f, 0x0, 0x0, 0x0, 0xca, 0x0, 0x0, 0x1,
+    0xf1, 0xe, 0x40, 0x0, 0x1, 0xff, 0x0, 0x0,
+    0x6, 0xb0, 0x9, 0x90, 0x0, 0x6, 0xad, 0x40,
+    0x0, 0xb, 0x60, 0x4, 0xe0, 0x0, 0xb, 0x58,
+    0x90, 0x0, 0x1f, 0x10, 0x0, 0xf3, 0x0, 0x1f,
+    0x3, 0xe0, 0x0, 0x5c, 0x0, 0x0, 0xa8, 0x0,
+    0x6a, 0x0, 0xe3, 0x0, 0xa7, 0x0, 0x0, 0x5d,
+    0x0, 0xb5, 0x0, 0x98, 0x0, 0xf2, 0x0, 0x0,
+    0x1f, 0x21, 0xf1, 0x0, 0x4d, 0x4, 0xd0, 0x0,
+    0x0, 0xb, 0x75, 0xb0, 0x0, 0xe, 0x2a, 0x80,
+    0x0, 0x0, 0x6, 0xcb, 0x60, 0x0, 0xa, 0x8e,
+    0x30, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x5,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0,
+    0x0, 0xf9, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x2f, 0x40, 0x0, 0x0, 0xb9, 0x0, 0x6e, 0x0,
+    0x0, 0x6d, 0x0, 0x0, 0xba, 0x0, 0x1e, 0x30,
+    0x0, 0x1, 0xf5, 0xb, 0x80, 0x0, 0x0, 0x6,
+    0xe8, 0xd0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x60, 0x0, 0x0, 0x0,
+    0xab, 0x3f, 0x20, 0x0, 0x0, 0x5e, 0x10, 0x8c,
+    0x0, 0x0, 0x1e, 0x50, 0x0, 0xd7, 0x0, 0xb,
+    0xa0, 0x0, 0x3, 0xf3, 0x6, 0xe1, 0x0, 0x0,
+    0x7, 0xd0,
+
+    /* U+0059 "Y" */
+    0xb9, 0x0, 0x0, 0x0, 0x5d, 0x2, 0xf2, 0x0,
+    0x0, 0xd, 0x40, 0x8, 0xb0, 0x0, 0x7, 0xb0,
+    0x0, 0x1e, 0x40, 0x1, 0xe2, 0x0, 0x0, 0x6d,
+    0x0, 0x99, 0x0, 0x0, 0x0, 0xd6, 0x2e, 0x10,
+    0x0, 0x0, 0x4, 0xec, 0x60, 0x0, 0x0, 0x0,
+    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8a, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x8a, 0x0, 0x0, 0x0, 0x0, 0x8, 0xa0,
+    0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x2f, 0xff, 0xff, 0xff, 0xfb, 0x1, 0x11, 0x11,
+    0x14, 0xf4, 0x0, 0x0, 0x0, 0xd, 0x80, 0x0,
+    0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x6, 0xe1,
+    0x0, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0, 0x0,
+    0xd8, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0,
+    0x0, 0x5f, 0x20, 0x0, 0x0, 0x2, 0xf5, 0x0,
+    0x0, 0x0, 0xc, 0xa1, 0x11, 0x11, 0x11, 0x4f,
+    0xff, 0xff, 0xff, 0xfe,
+
+    /* U+005B "[" */
+    0x2f, 0xfc, 0x2f, 0x0, 0x2f, 0x0, 0x2f, 0x0,
+    0x2f, 0x0, 0x2f, 0x0, 0x2f, 0x0, 0x2f, 0x0,
+    0x2f, 0x0, 0x2f, 0x0, 0x2f, 0x0, 0x2f, 0x0,
+    0x2f, 0x0, 0x2f, 0x0, 0x2f, 0x0, 0x2f, 0xfc,
+
+    /* U+005C "\\" */
+    0x6a, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0, 0xb,
+    0x40, 0x0, 0x0, 0x6a, 0x0, 0x0, 0x1, 0xe0,
+    0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0x6a, 0x0,
+    0x0, 0x1, 0xe0, 0x0, 0x0, 0xc, 0x40, 0x0,
+    0x0, 0x69, 0x0, 0x0, 0x1, 0xe0, 0x0, 0x0,
+    0xc, 0x40, 0x0, 0x0, 0x79, 0x0, 0x0, 0x1,
+    0xe0, 0x0, 0x0, 0xc, 0x40, 0x0, 0x0, 0x79,
+
+    /* U+005D "]" */
+    0xaf, 0xf4, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4,
+    0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4,
+    0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4,
+    0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4, 0xaf, 0xf4,
+
+    /* U+005E "^" */
+    0x0, 0x1f, 0x40, 0x0, 0x7, 0xab, 0x0, 0x0,
+    0xd1, 0xc1, 0x0, 0x4a, 0x6, 0x70, 0xa, 0x30,
+    0x1d, 0x1, 0xd0, 0x0, 0xa4, 0x77, 0x0, 0x4,
+    0xb0,
+
+    /* U+005F "_" */
+    0xdd, 0xdd, 0xdd, 0xdd,
+
+    /* U+0060 "`" */
+    0x4d, 0x30, 0x2, 0xc5,
+
+    /* U+0061 "a" */
+    0x1, 0x9e, 0xfd, 0x70, 0xa, 0x92, 0x14, 0xe6,
+    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x3e,
+    0x2, 0xad, 0xee, 0xef, 0xd, 0x70, 0x0, 0x3f,
+    0x1f, 0x0, 0x0, 0x4f, 0xd, 0x70, 0x3, 0xdf,
+    0x2, 0xbe, 0xdb, 0x4f,
+
+    /* U+0062 "b" */
+    0x6b, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0,
+    0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x6b,
+    0x0, 0x0, 0x0, 0x0, 0x6b, 0x2b, 0xfe, 0xa2,
+    0x0, 0x6d, 0xd6, 0x12, 0x9e, 0x20, 0x6f, 0x40,
+    0x0, 0x9, 0xa0, 0x6d, 0x0, 0x0, 0x2, 0xf0,
+    0x6b, 0x0, 0x0, 0x0, 0xf1, 0x6d, 0x0, 0x0,
+    0x2, 0xf0, 0x6f, 0x40, 0x0, 0x9, 0xa0, 0x6c,
+    0xd6, 0x12, 0x9e, 0x20, 0x6a, 0x2b, 0xfe, 0xa2,
+    0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x2b, 0xef, 0xb3, 0x0, 0x3f, 0x72, 0x17,
+    0xf2, 0xd, 0x70, 0x0, 0x2, 0x2, 0xf0, 0x0,
+    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0xd, 0x70, 0x0, 0x2, 0x0,
+    0x3f, 0x72, 0x16, 0xf2, 0x0, 0x3b, 0xef, 0xb3,
+    0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0xe4, 0x0, 0x3b, 0xfe, 0xa1,
+    0xe4, 0x4, 0xf7, 0x22, 0x7d, 0xe4, 0xd, 0x70,
+    0x0, 0x6, 0xf4, 0x2f, 0x0, 0x0, 0x0, 0xf4,
+    0x3e, 0x0, 0x0, 0x0, 0xe4, 0x2f, 0x0, 0x0,
+    0x0, 0xf4, 0xd, 0x60, 0x0, 0x6, 0xf4, 0x4,
+    0xf6, 0x0, 0x6d, 0xe4, 0x0, 0x3b, 0xfe, 0xa1,
+    0xd4,
+
+    /* U+0065 "e" */
+    0x0, 0x3b, 0xfe, 0x91, 0x0, 0x4f, 0x61, 0x29,
+    0xd0, 0xd, 0x60, 0x0, 0xa, 0x72, 0xf0, 0x0,
+    0x0, 0x4c, 0x3f, 0xee, 0xee, 0xee, 0xd2, 0xf0,
+    0x0, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0, 0x0,
+    0x3f, 0x82, 0x15, 0xd2, 0x0, 0x2a, 0xef, 0xc5,
+    0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x4d, 0xfa, 0x0, 0xe5, 0x13, 0x2, 0xe0,
+    0x0, 0x3, 0xe0, 0x0, 0xbf, 0xff, 0xf7, 0x3,
+    0xe0, 0x0, 0x3, 0xe0, 0x0, 0x3, 0xe0, 0x0,
+    0x3, 0xe0, 0x0, 0x3, 0xe0, 0x0, 0x3, 0xe0,
+    0x0, 0x3, 0xe0, 0x0, 0x3, 0xe0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x3b, 0xfe, 0xa2, 0xb6, 0x3, 0xf8, 0x21,
+    0x6d, 0xd6, 0xd, 0x70, 0x0, 0x4, 0xf6, 0x2f,
+    0x0, 0x0, 0x0, 0xe6, 0x3e, 0x0, 0x0, 0x0,
+    0xc6, 0x2f, 0x0, 0x0, 0x0, 0xe6, 0xd, 0x70,
+    0x0, 0x4, 0xf6, 0x3, 0xf8, 0x21, 0x6d, 0xd5,
+    0x0, 0x3b, 0xff, 0xb2, 0xd4, 0x0, 0x0, 0x0,
+    0x1, 0xf1, 0x7, 0xa4, 0x21, 0x4c, 0xa0, 0x0,
+    0x7c, 0xff, 0xd8, 0x0,
+
+    /* U+0068 "h" */
+    0x6b, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x0, 0x0,
+    0x0, 0x6b, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x0,
+    0x0, 0x0, 0x6b, 0x3b, 0xfe, 0x90, 0x6, 0xdd,
+    0x52, 0x4c, 0xb0, 0x6f, 0x30, 0x0, 0x2f, 0x26,
+    0xd0, 0x0, 0x0, 0xd4, 0x6b, 0x0, 0x0, 0xd,
+    0x56, 0xb0, 0x0, 0x0, 0xd5, 0x6b, 0x0, 0x0,
+    0xd, 0x56, 0xb0, 0x0, 0x0, 0xd5, 0x6b, 0x0,
+    0x0, 0xd, 0x50,
+
+    /* U+0069 "i" */
+    0x7c, 0x47, 0x0, 0x0, 0x6b, 0x6b, 0x6b, 0x6b,
+    0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+
+    /* U+006A "j" */
+    0x0, 0x6, 0xd0, 0x0, 0x3, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x0,
+    0x5, 0xc0, 0x0, 0x5, 0xc0, 0x0, 0x5, 0xc0,
+    0x0, 0x5, 0xc0, 0x0, 0x5, 0xc0, 0x0, 0x5,
+    0xc0, 0x0, 0x5, 0xc0, 0x0, 0x5, 0xc0, 0x0,
+    0x5, 0xc0, 0x13, 0x1b, 0x90, 0x3d, 0xfb, 0x10,
+
+    /* U+006B "k" */
+    0x6b, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x0, 0x0,
+    0x0, 0x6b, 0x0, 0x0, 0x0, 0x6, 0xb0, 0x0,
+    0x0, 0x0, 0x6b, 0x0, 0x0, 0xba, 0x6, 0xb0,
+    0x0, 0xba, 0x0, 0x6b, 0x0, 0xca, 0x0, 0x6,
+    0xb0, 0xcc, 0x0, 0x0, 0x6c, 0xcc, 0xf3, 0x0,
+    0x6, 0xfa, 0x8, 0xd0, 0x0, 0x6c, 0x0, 0xc,
+    0xa0, 0x6, 0xb0, 0x0, 0x1e, 0x50, 0x6b, 0x0,
+    0x0, 0x4f, 0x20,
+
+    /* U+006C "l" */
+    0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+    0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+
+    /* U+006D "m" */
+    0x6a, 0x4c, 0xfe, 0x80, 0x2a, 0xee, 0xb1, 0x6,
+    0xdd, 0x31, 0x3d, 0xae, 0x61, 0x1a, 0xd0, 0x6f,
+    0x20, 0x0, 0x4f, 0x80, 0x0, 0xe, 0x46, 0xd0,
+    0x0, 0x1, 0xf3, 0x0, 0x0, 0xb6, 0x6b, 0x0,
+    0x0, 0xf, 0x10, 0x0, 0xa, 0x76, 0xb0, 0x0,
+    0x0, 0xf1, 0x0, 0x0, 0xa7, 0x6b, 0x0, 0x0,
+    0xf, 0x10, 0x0, 0xa, 0x76, 0xb0, 0x0, 0x0,
+    0xf1, 0x0, 0x0, 0xa7, 0x6b, 0x0, 0x0, 0xf,
+    0x10, 0x0, 0xa, 0x70,
+
+    /* U+006E "n" */
+    0x6a, 0x3c, 0xfe, 0x90, 0x6, 0xdd, 0x41, 0x2c,
+    0xb0, 0x6f, 0x20, 0x0, 0x1f, 0x26, 0xd0, 0x0,
+    0x0, 0xd4, 0x6b, 0x0, 0x0, 0xd, 0x56, 0xb0,
+    0x0, 0x0, 0xd5, 0x6b, 0x0, 0x0, 0xd, 0x56,
+    0xb0, 0x0, 0x0, 0xd5, 0x6b, 0x0, 0x0, 0xd,
+    0x50,
+
+    /* U+006F "o" */
+    0x0, 0x3b, 0xef, 0xb3, 0x0, 0x3, 0xf7, 0x21,
+    0x7f, 0x40, 0xd, 0x70, 0x0, 0x6, 0xd0, 0x2f,
+    0x0, 0x0, 0x0, 0xf2, 0x3e, 0x0, 0x0, 0x0,
+    0xe4, 0x2f, 0x0, 0x0, 0x0, 0xf2, 0xd, 0x70,
+    0x0, 0x6, 0xd0, 0x3, 0xf7, 0x21, 0x7f, 0x40,
+    0x0, 0x3b, 0xff, 0xb3, 0x0,
+
+    /* U+0070 "p" */
+    0x6a, 0x3b, 0xfe, 0xa2, 0x0, 0x6d, 0xd4, 0x1,
+    0x8e, 0x20, 0x6f, 0x30, 0x0, 0x9, 0xa0, 0x6d,
+    0x0, 0x0, 0x2, 0xf0, 0x6b, 0x0, 0x0, 0x0,
+    0xf1, 0x6d, 0x0, 0x0, 0x2, 0xf0, 0x6f, 0x40,
+    0x0, 0x9, 0xb0, 0x6d, 0xd6, 0x12, 0x9f, 0x20,
+    0x6b, 0x2b, 0xfe, 0xb2, 0x0, 0x6b, 0x0, 0x0,
+    0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x6b,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x3b, 0xfe, 0xa1, 0xd4, 0x4, 0xf7, 0x22,
+    0x7d, 0xe4, 0xd, 0x70, 0x0, 0x6, 0xf4, 0x2f,
+    0x0, 0x0, 0x0, 0xf4, 0x3e, 0x0, 0x0, 0x0,
+    0xe4, 0x2f, 0x0, 0x0, 0x0, 0xf4, 0xd, 0x70,
+    0x0, 0x6, 0xf4, 0x4, 0xf7, 0x21, 0x7d, 0xe4,
+    0x0, 0x3b, 0xfe, 0xa1, 0xe4, 0x0, 0x0, 0x0,
+    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0xe4,
+
+    /* U+0072 "r" */
+    0x6a, 0x4c, 0xc6, 0xde, 0x62, 0x6f, 0x30, 0x6,
+    0xd0, 0x0, 0x6b, 0x0, 0x6, 0xb0, 0x0, 0x6b,
+    0x0, 0x6, 0xb0, 0x0, 0x6b, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x3, 0xbe, 0xec, 0x60, 0xe, 0x71, 0x15, 0x80,
+    0x3e, 0x0, 0x0, 0x0, 0x1f, 0x81, 0x0, 0x0,
+    0x3, 0xbf, 0xea, 0x30, 0x0, 0x0, 0x28, 0xf1,
+    0x0, 0x0, 0x0, 0xe4, 0x5a, 0x41, 0x16, 0xe1,
+    0x18, 0xdf, 0xeb, 0x30,
+
+    /* U+0074 "t" */
+    0x3, 0xe0, 0x0, 0x0, 0x3e, 0x0, 0x0, 0xbf,
+    0xff, 0xf7, 0x0, 0x3e, 0x0, 0x0, 0x3, 0xe0,
+    0x0, 0x0, 0x3e, 0x0, 0x0, 0x3, 0xe0, 0x0,
+    0x0, 0x3e, 0x0, 0x0, 0x3, 0xe0, 0x0, 0x0,
+    0xf, 0x51, 0x30, 0x0, 0x5d, 0xfa, 0x0,
+
+    /* U+0075 "u" */
+    0x8a, 0x0, 0x0, 0xf, 0x28, 0xa0, 0x0, 0x0,
+    0xf2, 0x8a, 0x0, 0x0, 0xf, 0x28, 0xa0, 0x0,
+    0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf, 0x27, 0xb0,
+    0x0, 0x1, 0xf2, 0x4e, 0x0, 0x0, 0x6f, 0x20,
+    0xd9, 0x11, 0x5d, 0xf2, 0x1, 0xae, 0xfb, 0x2e,
+    0x20,
+
+    /* U+0076 "v" */
+    0xc6, 0x0, 0x0, 0xa, 0x75, 0xd0, 0x0, 0x1,
+    0xf1, 0xe, 0x30, 0x0, 0x89, 0x0, 0x8a, 0x0,
+    0xe, 0x30, 0x2, 0xf1, 0x5, 0xc0, 0x0, 0xb,
+    0x70, 0xb5, 0x0, 0x0, 0x4d, 0x2e, 0x0, 0x0,
+    0x0, 0xdd, 0x80, 0x0, 0x0, 0x7, 0xf1, 0x0,
+    0x0,
+
+    /* U+0077 "w" */
+    0xb6, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x4c, 0x5b,
+    0x0, 0x0, 0xef, 0x10, 0x0, 0xa6, 0xf, 0x10,
+    0x5, 0xba, 0x60, 0x0, 0xe1, 0xa, 0x60, 0xa,
+    0x54, 0xc0, 0x5, 0xb0, 0x4, 0xc0, 0xe, 0x0,
+    0xe1, 0xa, 0x50, 0x0, 0xe1, 0x6a, 0x0, 0x97,
+    0xe, 0x0, 0x0, 0x97, 0xb4, 0x0, 0x3d, 0x6a,
+    0x0, 0x0, 0x3d, 0xe0, 0x0, 0xd, 0xd4, 0x0,
+    0x0, 0xe, 0x80, 0x0, 0x7, 0xe0, 0x0,
+
+    /* U+0078 "x" */
+    0x3e, 0x20, 0x0, 0x9a, 0x0, 0x7c, 0x0, 0x4e,
+    0x10, 0x0, 0xb8, 0x1e, 0x30, 0x0, 0x1, 0xec,
+    0x80, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x3,
+    0xea, 0xb0, 0x0, 0x0, 0xd5, 0xc, 0x60, 0x0,
+    0xaa, 0x0, 0x2e, 0x20, 0x5e, 0x0, 0x0, 0x6d,
+    0x0,
+
+    /* U+0079 "y" */
+    0xc, 0x60, 0x0, 0x0, 0xa7, 0x5, 0xd0, 0x0,
+    0x1, 0xf0, 0x0, 0xe4, 0x0, 0x8, 0x90, 0x0,
+    0x7b, 0x0, 0xe, 0x20, 0x0, 0x1f, 0x20, 0x6b,
+    0x0, 0x0, 0x9, 0x90, 0xd4, 0x0, 0x0, 0x2,
+    0xf4, 0xd0, 0x0, 0x0, 0x0, 0xbe, 0x60, 0x0,
+    0x0, 0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x98,
+    0x0, 0x0, 0x16, 0x15, 0xe1, 0x0, 0x0, 0x1b,
+    0xfd, 0x40, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x3f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x6, 0xd0,
+    0x0, 0x0, 0x2e, 0x30, 0x0, 0x0, 0xd6, 0x0,
+    0x0, 0x9, 0xb0, 0x0, 0x0, 0x5e, 0x10, 0x0,
+    0x2, 0xe3, 0x0, 0x0, 0xc, 0x70, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xf8,
+
+    /* U+007B "{" */
+    0x0, 0x3d, 0xf0, 0x0, 0xa9, 0x0, 0x0, 0xc5,
+    0x0, 0x0, 0xc5, 0x0, 0x0, 0xc5, 0x0, 0x0,
+    0xc5, 0x0, 0x0, 0xd5, 0x0, 0xf, 0xe0, 0x0,
+    0x2, 0xe4, 0x0, 0x0, 0xc5, 0x0, 0x0, 0xc5,
+    0x0, 0x0, 0xc5, 0x0, 0x0, 0xc5, 0x0, 0x0,
+    0xc5, 0x0, 0x0, 0xaa, 0x0, 0x0, 0x2c, 0xf0,
+
+    /* U+007C "|" */
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+
+    /* U+007D "}" */
+    0xae, 0x60, 0x0, 0x4f, 0x0, 0x0, 0xf1, 0x0,
+    0xf, 0x20, 0x0, 0xf2, 0x0, 0xf, 0x20, 0x0,
+    0xf3, 0x0, 0x9, 0xf5, 0x0, 0xf5, 0x0, 0xf,
+    0x20, 0x0, 0xf2, 0x0, 0xf, 0x20, 0x0, 0xf2,
+    0x0, 0xf, 0x10, 0x5, 0xf0, 0xa, 0xe6, 0x0,
+
+    /* U+007E "~" */
+    0x3, 0xdd, 0x30, 0x9, 0x20, 0xb3, 0x2c, 0x41,
+    0xd0, 0xb, 0x0, 0x1b, 0xd4, 0x0,
+
+    /* U+00A0 " " */
+
+    /* U+00A1 "¡" */
+    0x9b, 0x57, 0x0, 0x0, 0x68, 0x68, 0x79, 0x79,
+    0x8a, 0x8a, 0x8b, 0x8b,
+
+    /* U+00A2 "¢" */
+    0x0, 0x0, 0x65, 0x0, 0x0, 0x0, 0x6, 0x50,
+    0x0, 0x0, 0x3b, 0xff, 0xc4, 0x0, 0x3f, 0x78,
+    0x66, 0xf2, 0xd, 0x70, 0x65, 0x2, 0x2, 0xf0,
+    0x6, 0x50, 0x0, 0x3e, 0x0, 0x65, 0x0, 0x2,
+    0xf0, 0x6, 0x50, 0x0, 0xd, 0x70, 0x65, 0x2,
+    0x0, 0x3f, 0x78, 0x66, 0xf2, 0x0, 0x3b, 0xff,
+    0xc4, 0x0, 0x0, 0x6, 0x50, 0x0, 0x0, 0x0,
+    0x65, 0x0, 0x0,
+
+    /* U+00A3 "£" */
+    0x0, 0x0, 0x8d, 0xfe, 0xb4, 0x0, 0xb, 0xd5,
+    0x23, 0x7a, 0x0, 0x5e, 0x0, 0x0, 0x0, 0x0,
+    0x99, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0, 0x0,
+    0x0, 0x0, 0xb7, 0x0, 0x0, 0x0, 0x6d, 0xfe,
+    0xdd, 0xdc, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x0,
+    0x0, 0xb7, 0x0, 0x0, 0x0, 0x0, 0xb7, 0x0,
+    0x0, 0x0, 0x1, 0xb8, 0x11, 0x11, 0x11, 0x8f,
+    0xff, 0xff, 0xff, 0xfb,
+
+    /* U+00A4 "¤" */
+    0x16, 0x0, 0x0, 0x0, 0x4, 0x31, 0xe6, 0x4b,
+    0xec, 0x63, 0xe3, 0x2, 0xfd, 0x52, 0x4b, 0xf4,
+    0x0, 0x3d, 0x0, 0x0, 0xa, 0x60, 0x9, 0x50,
+    0x0, 0x0, 0x2d, 0x0, 0xb3, 0x0, 0x0, 0x0,
+    0xf0, 0xa, 0x40, 0x0, 0x0, 0x1e, 0x0, 0x5c,
+    0x0, 0x0, 0x8, 0x80, 0x0, 0xfa, 0x20, 0x18,
+    0xf2, 0x0, 0xb9, 0x7e, 0xff, 0x97, 0xd1, 0x39,
+    0x0, 0x1, 0x0, 0x7, 0x50,
+
+    /* U+00A5 "¥" */
+    0xa9, 0x0, 0x0, 0x0, 0x6, 0xc0, 0x1e, 0x30,
+    0x0, 0x0, 0x1e, 0x20, 0x6, 0xd0, 0x0, 0x0,
+    0xb8, 0x0, 0x0, 0xb8, 0x0, 0x5, 0xd0, 0x0,
+    0x0, 0x2f, 0x20, 0x1e, 0x30, 0x0, 0x0, 0x7,
+    0xc0, 0xa9, 0x0, 0x0, 0x0, 0x0, 0xca, 0xe0,
+    0x0, 0x0, 0x6, 0xcc, 0xcf, 0xdc, 0xc7, 0x0,
+    0x0, 0x0, 0xf, 0x20, 0x0, 0x0, 0x6, 0xcc,
+    0xcf, 0xcc, 0xc7, 0x0, 0x0, 0x0, 0xf, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0x20, 0x0, 0x0,
+
+    /* U+00A6 "¦" */
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2d, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+
+    /* U+00A7 "§" */
+    0x0, 0x8e, 0xfd, 0x91, 0xa, 0x91, 0x2, 0x81,
+    0xf, 0x10, 0x0, 0x0, 0xd, 0x60, 0x0, 0x0,
+    0x4, 0xfd, 0x82, 0x0, 0x1d, 0x53, 0x8e, 0x80,
+    0x5a, 0x0, 0x1, 0xe2, 0x4d, 0x10, 0x0, 0xd3,
+    0xa, 0xe8, 0x47, 0xd0, 0x0, 0x38, 0xdf, 0x30,
+    0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x2, 0xd0,
+    0x69, 0x20, 0x1a, 0x90, 0x8, 0xdf, 0xd8, 0x0,
+
+    /* U+00A8 "¨" */
+    0x0, 0x0, 0x3, 0xf0, 0x5c, 0x3, 0x0, 0x20,
+
+    /* U+00A9 "©" */
+    0x0, 0x0, 0x69, 0xaa, 0x60, 0x0, 0x0, 0x3,
+    0xa4, 0x0, 0x4, 0xa3, 0x0, 0x1, 0xa0, 0x3b,
+    0xec, 0x40, 0xa1, 0x0, 0x91, 0x2d, 0x30, 0x2a,
+    0x1, 0x80, 0x9, 0x9, 0x60, 0x0, 0x0, 0xa,
+    0x1, 0x70, 0xb3, 0x0, 0x0, 0x0, 0x81, 0x17,
+    0x9, 0x60, 0x0, 0x0, 0x8, 0x0, 0x90, 0x2d,
+    0x30, 0x2a, 0x0, 0xa0, 0x9, 0x10, 0x3b, 0xec,
+    0x40, 0x28, 0x0, 0x1a, 0x0, 0x0, 0x0, 0xa,
+    0x10, 0x0, 0x3a, 0x30, 0x0, 0x4a, 0x20, 0x0,
+    0x0, 0x6, 0xaa, 0xa6, 0x0, 0x0,
+
+    /* U+00AA "ª" */
+    0x9, 0xab, 0x90, 0x1, 0x0, 0xa3, 0x8, 0x99,
+    0xc4, 0x48, 0x0, 0xb4, 0x8, 0x87, 0x73,
+
+    /* U+00AB "«" */
+    0x0, 0x6, 0x1, 0x60, 0x0, 0x88, 0xb, 0x50,
+    0x4, 0xc0, 0x6a, 0x0, 0xe, 0x22, 0xe1, 0x0,
+    0xa, 0x60, 0xc4, 0x0, 0x1, 0xd2, 0x2d, 0x10,
+    0x0, 0x3c, 0x6, 0xa0,
+
+    /* U+00AC "¬" */
+    0xef, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xe1,
+    0x0, 0x0, 0x0, 0xe1, 0x0, 0x0, 0x0, 0xe1,
+
+    /* U+00AD "­" */
+    0xf, 0xff, 0xf2, 0x1, 0x11, 0x10,
+
+    /* U+00AE "®" */
+    0x0, 0x0, 0x69, 0xaa, 0x60, 0x0, 0x0, 0x3,
+    0xa4, 0x0, 0x4, 0xa3, 0x0, 0x1, 0xa0, 0xac,
+    0xcb, 0x40, 0xa1, 0x0, 0x91, 0xb, 0x10, 0x1c,
+    0x11, 0x80, 0x9, 0x0, 0xb1, 0x0, 0x84, 0xa,
+    0x1, 0x70, 0xb, 0x10, 0x1c, 0x10, 0x81, 0x17,
+    0x0, 0xbc, 0xce, 0x50, 0x8, 0x0, 0x90, 0xb,
+    0x10, 0x75, 0x0, 0xa0, 0x9, 0x10, 0xb1, 0x0,
+    0xc0, 0x28, 0x0, 0x1a, 0x2, 0x0, 0x1, 0x1a,
+    0x10, 0x0, 0x3a, 0x30, 0x0, 0x4a, 0x20, 0x0,
+    0x0, 0x6, 0xaa, 0xa6, 0x0, 0x0,
+
+    /* U+00AF "¯" */
+    0x8c, 0xcc, 0xc3,
+
+    /* U+00B0 "°" */
+    0x1, 0xab, 0x80, 0xb, 0x20, 0x67, 0x29, 0x0,
+    0xb, 0x29, 0x0, 0xb, 0xb, 0x20, 0x67, 0x1,
+    0xab, 0x80,
+
+    /* U+00B1 "±" */
+    0x0, 0xe, 0x10, 0x0, 0x0, 0xe, 0x10, 0x0,
+    0x0, 0xe, 0x10, 0x0, 0xce, 0xef, 0xee, 0xe1,
+    0x11, 0x1e, 0x31, 0x10, 0x0, 0xe, 0x10, 0x0,
+    0x0, 0xe, 0x10, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf1,
+
+    /* U+00B2 "²" */
+    0x1a, 0xcb, 0xb1, 0x1, 0x30, 0x5, 0x90, 0x0,
+    0x0, 0x59, 0x0, 0x0, 0x2c, 0x10, 0x0, 0x3c,
+    0x20, 0x0, 0x4c, 0x10, 0x0, 0x2f, 0xcb, 0xbb,
+    0x0,
+
+    /* U+00B3 "³" */
+    0x3b, 0xbb, 0xd9, 0x0, 0x1, 0xc1, 0x0, 0xc,
+    0x30, 0x0, 0x4c, 0xa2, 0x0, 0x0, 0x2d, 0x12,
+    0x0, 0x1d, 0x2b, 0xbb, 0xb3,
+
+    /* U+00B4 "´" */
+    0x0, 0x9b, 0x10, 0xa8, 0x0,
+
+    /* U+00B5 "µ" */
+    0x6b, 0x0, 0x0, 0xe, 0x46, 0xb0, 0x0, 0x0,
+    0xe4, 0x6b, 0x0, 0x0, 0xe, 0x46, 0xb0, 0x0,
+    0x0, 0xe4, 0x6b, 0x0, 0x0, 0xe, 0x46, 0xc0,
+    0x0, 0x0, 0xf4, 0x6f, 0x0, 0x0, 0x4f, 0x46,
+    0xfa, 0x20, 0x4d, 0xe4, 0x6b, 0x8e, 0xfc, 0x3d,
+    0x46, 0xb0, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0,
+    0x0, 0x6, 0xb0, 0x0, 0x0, 0x0,
+
+    /* U+00B6 "¶" */
+    0x4, 0xcf, 0xff, 0xff, 0x43, 0xff, 0xf9, 0x0,
+    0xa4, 0x9f, 0xff, 0x90, 0xa, 0x49, 0xff, 0xf9,
+    0x0, 0xa4, 0x3f, 0xff, 0x90, 0xa, 0x40, 0x4c,
+    0xf9, 0x0, 0xa4, 0x0, 0x6, 0x90, 0xa, 0x40,
+    0x0, 0x69, 0x0, 0xa4, 0x0, 0x6, 0x90, 0xa,
+    0x40, 0x0, 0x69, 0x0, 0xa4, 0x0, 0x6, 0x90,
+    0xa, 0x40, 0x0, 0x69, 0x0, 0xa4, 0x0, 0x6,
+    0x90, 0xa, 0x40, 0x0, 0x69, 0x0, 0xa4, 0x0,
+    0x2, 0x40, 0x4, 0x20,
+
+    /* U+00B7 "·" */
+    0x88, 0x9a,
+
+    /* U+00B8 "¸" */
+    0xa, 0x0, 0x8, 0xb0, 0x0, 0xa3, 0x8b, 0x90,
+
+    /* U+00B9 "¹" */
+    0x6b, 0xe2, 0x0, 0xb, 0x20, 0x0, 0xb2, 0x0,
+    0xb, 0x20, 0x0, 0xb2, 0x0, 0xb, 0x20, 0x7b,
+    0xec, 0xa0,
+
+    /* U+00BA "º" */
+    0x6, 0xcb, 0xb2, 0x3, 0xb0, 0x2, 0xc0, 0x66,
+    0x0, 0xc, 0x2, 0xc1, 0x4, 0xc0, 0x4, 0xbb,
+    0x91, 0x0,
+
+    /* U+00BB "»" */
+    0x15, 0x2, 0x40, 0x0, 0xb5, 0xd, 0x30, 0x1,
+    0xd1, 0x3d, 0x0, 0x5, 0xb0, 0x89, 0x0, 0x97,
+    0xc, 0x50, 0x5b, 0x7, 0x90, 0x1d, 0x13, 0xd0,
+    0x0,
+
+    /* U+00BC "¼" */
+    0x6c, 0xd2, 0x0, 0x0, 0x0, 0x93, 0x0, 0x0,
+    0xb, 0x20, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0xb,
+    0x20, 0x0, 0x9, 0x50, 0x0, 0x0, 0x0, 0xb2,
+    0x0, 0x4, 0xa0, 0x0, 0x30, 0x0, 0xb, 0x20,
+    0x0, 0xc1, 0x0, 0x4b, 0x0, 0x7c, 0xdc, 0xa0,
+    0x96, 0x0, 0x1c, 0x10, 0x0, 0x0, 0x0, 0x3b,
+    0x0, 0xb, 0x41, 0x30, 0x0, 0x0, 0xc, 0x10,
+    0x6, 0x80, 0x39, 0x0, 0x0, 0x8, 0x60, 0x0,
+    0xdc, 0xcc, 0xeb, 0x0, 0x3, 0xb0, 0x0, 0x0,
+    0x0, 0x49, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x0,
+    0x3, 0x80,
+
+    /* U+00BD "½" */
+    0x6c, 0xd2, 0x0, 0x0, 0x0, 0x93, 0x0, 0x0,
+    0xb, 0x20, 0x0, 0x0, 0x5a, 0x0, 0x0, 0x0,
+    0xb2, 0x0, 0x0, 0x1c, 0x10, 0x0, 0x0, 0xb,
+    0x20, 0x0, 0x9, 0x50, 0x0, 0x0, 0x0, 0xb2,
+    0x0, 0x4, 0xa0, 0x0, 0x0, 0x0, 0xb, 0x20,
+    0x0, 0xc1, 0x4b, 0xcc, 0x60, 0x7c, 0xdc, 0xa0,
+    0x96, 0x1, 0x0, 0xc, 0x20, 0x0, 0x0, 0x3b,
+    0x0, 0x0, 0x0, 0xb2, 0x0, 0x0, 0xc, 0x10,
+    0x0, 0x0, 0x88, 0x0, 0x0, 0x8, 0x60, 0x0,
+    0x0, 0x97, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x0,
+    0xb5, 0x0, 0x0, 0x0, 0xa2, 0x0, 0x0, 0x8d,
+    0xcc, 0xc7,
+
+    /* U+00BE "¾" */
+    0x3c, 0xcc, 0xc9, 0x0, 0x0, 0x9, 0x30, 0x0,
+    0x0, 0x1, 0xc1, 0x0, 0x0, 0x5a, 0x0, 0x0,
+    0x0, 0xb, 0x30, 0x0, 0x1, 0xc1, 0x0, 0x0,
+    0x0, 0x5c, 0xa3, 0x0, 0x9, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x2d, 0x0, 0x4a, 0x0, 0x2, 0x0,
+    0x24, 0x0, 0x2d, 0x0, 0xc1, 0x0, 0x3b, 0x0,
+    0x19, 0xcc, 0xa2, 0x9, 0x60, 0x0, 0xc1, 0x0,
+    0x0, 0x0, 0x0, 0x3b, 0x0, 0xa, 0x41, 0x40,
+    0x0, 0x0, 0x0, 0xc1, 0x0, 0x68, 0x3, 0x90,
+    0x0, 0x0, 0x8, 0x60, 0x0, 0xdc, 0xcc, 0xeb,
+    0x0, 0x0, 0x3b, 0x0, 0x0, 0x0, 0x4, 0x90,
+    0x0, 0x0, 0xa2, 0x0, 0x0, 0x0, 0x3, 0x80,
+
+    /* U+00BF "¿" */
+    0x0, 0xe, 0x50, 0x0, 0x0, 0x9, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x10, 0x0,
+    0x0, 0xf, 0x20, 0x0, 0x0, 0x9c, 0x0, 0x0,
+    0x8, 0xd1, 0x0, 0x0, 0x5e, 0x10, 0x0, 0x0,
+    0xb7, 0x0, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x1,
+    0x6e, 0x40, 0x3, 0xc9, 0x7, 0xef, 0xfe, 0x70,
+    0x0, 0x1, 0x10, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0x5, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2c, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7d, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xe4, 0xd6, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x6c,
+    0x0, 0x0, 0x0, 0xc, 0x70, 0xf, 0x30, 0x0,
+    0x0, 0x3f, 0x10, 0x9, 0xa0, 0x0, 0x0, 0x9a,
+    0x0, 0x3, 0xf1, 0x0, 0x1, 0xf4, 0x0, 0x0,
+    0xd8, 0x0, 0x7, 0xfe, 0xee, 0xee, 0xfe, 0x0,
+    0xe, 0x71, 0x11, 0x11, 0x1e, 0x50, 0x5e, 0x0,
+    0x0, 0x0, 0x8, 0xc0, 0xc7, 0x0, 0x0, 0x0,
+    0x1, 0xf3,
+
+    /* U+00C1 "Á" */
+    0x0, 0x0, 0x0, 0xab, 0x10, 0x0, 0x0, 0x0,
+    0xb, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7d, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xe4, 0xd6, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x6c,
+    0x0, 0x0, 0x0, 0xc, 0x70, 0xf, 0x30, 0x0,
+    0x0, 0x3f, 0x10, 0x9, 0xa0, 0x0, 0x0, 0x9a,
+    0x0, 0x3, 0xf1, 0x0, 0x1, 0xf4, 0x0, 0x0,
+    0xd8, 0x0, 0x7, 0xfe, 0xee, 0xee, 0xfe, 0x0,
+    0xe, 0x71, 0x11, 0x11, 0x1e, 0x50, 0x5e, 0x0,
+    0x0, 0x0, 0x8, 0xc0, 0xc7, 0x0, 0x0, 0x0,
+    0x1, 0xf3,
+
+    /* U+00C2 "Â" */
+    0x0, 0x0, 0x5d, 0xc0, 0x0, 0x0, 0x0, 0x6,
+    0xb0, 0x4c, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7d, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xe4, 0xd6, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x6c,
+    0x0, 0x0, 0x0, 0xc, 0x70, 0xf, 0x30, 0x0,
+    0x0, 0x3f, 0x10, 0x9, 0xa0, 0x0, 0x0, 0x9a,
+    0x0, 0x3, 0xf1, 0x0, 0x1, 0xf4, 0x0, 0x0,
+    0xd8, 0x0, 0x7, 0xfe, 0xee, 0xee, 0xfe, 0x0,
+    0xe, 0x71, 0x11, 0x11, 0x1e, 0x50, 0x5e, 0x0,
+    0x0, 0x0, 0x8, 0xc0, 0xc7, 0x0, 0x0, 0x0,
+    0x1, 0xf3,
+
+    /* U+00C3 "Ã" */
+    0x0, 0x4, 0xc9, 0x8, 0x20, 0x0, 0x0, 0x9,
+    0x14, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x7d, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xe4, 0xd6, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x6c,
+    0x0, 0x0, 0x0, 0xc, 0x70, 0xf, 0x30, 0x0,
+    0x0, 0x3f, 0x10, 0x9, 0xa0, 0x0, 0x0, 0x9a,
+    0x0, 0x3, 0xf1, 0x0, 0x1, 0xf4, 0x0, 0x0,
+    0xd8, 0x0, 0x7, 0xfe, 0xee, 0xee, 0xfe, 0x0,
+    0xe, 0x71, 0x11, 0x11, 0x1e, 0x50, 0x5e, 0x0,
+    0x0, 0x0, 0x8, 0xc0, 0xc7, 0x0, 0x0, 0x0,
+    0x1, 0xf3,
+
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xe0, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x30, 0x12,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x7d, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe4, 0xd6,
+    0x0, 0x0, 0x0, 0x5, 0xe0, 0x6c, 0x0, 0x0,
+    0x0, 0xc, 0x70, 0xf, 0x30, 0x0, 0x0, 0x3f,
+    0x10, 0x9, 0xa0, 0x0, 0x0, 0x9a, 0x0, 0x3,
+    0xf1, 0x0, 0x1, 0xf4, 0x0, 0x0, 0xd8, 0x0,
+    0x7, 0xfe, 0xee, 0xee, 0xfe, 0x0, 0xe, 0x71,
+    0x11, 0x11, 0x1e, 0x50, 0x5e, 0x0, 0x0, 0x0,
+    0x8, 0xc0, 0xc7, 0x0, 0x0, 0x0, 0x1, 0xf3,
+
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x39, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x90, 0x54, 0x0, 0x0, 0x0, 0x0, 0x90, 0x54,
+    0x0, 0x0, 0x0, 0x0, 0x39, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0xe4, 0xd6, 0x0, 0x0,
+    0x0, 0x5, 0xe0, 0x6c, 0x0, 0x0, 0x0, 0xc,
+    0x70, 0xf, 0x30, 0x0, 0x0, 0x3f, 0x10, 0x9,
+    0xa0, 0x0, 0x0, 0x9a, 0x0, 0x3, 0xf1, 0x0,
+    0x1, 0xf4, 0x0, 0x0, 0xd8, 0x0, 0x7, 0xfe,
+    0xee, 0xee, 0xfe, 0x0, 0xe, 0x71, 0x11, 0x11,
+    0x1e, 0x50, 0x5e, 0x0, 0x0, 0x0, 0x8, 0xc0,
+    0xc7, 0x0, 0x0, 0x0, 0x1, 0xf3,
+
+    /* U+00C6 "Æ" */
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x1, 0xe8, 0xd1, 0x11, 0x11, 0x10,
+    0x0, 0x0, 0x9, 0xa5, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0x25, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb9, 0x5, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xf1, 0x5, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0xd, 0x70, 0x5, 0xd2, 0x22, 0x22, 0x10,
+    0x0, 0x6e, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xee, 0xef, 0xd0, 0x0, 0x0, 0x0,
+    0x8, 0xc1, 0x11, 0x16, 0xd0, 0x0, 0x0, 0x0,
+    0x2f, 0x30, 0x0, 0x5, 0xd1, 0x11, 0x11, 0x10,
+    0xa9, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+00C7 "Ç" */
+    0x0, 0x1, 0x8d, 0xfe, 0xb4, 0x0, 0x4, 0xeb,
+    0x52, 0x37, 0xe7, 0x2, 0xf6, 0x0, 0x0, 0x2,
+    0x20, 0xaa, 0x0, 0x0, 0x0, 0x0, 0xf, 0x30,
+    0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x22, 0x0,
+    0x4f, 0xb4, 0x23, 0x7e, 0x70, 0x0, 0x29, 0xdf,
+    0xeb, 0x40, 0x0, 0x0, 0x1, 0xc1, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xc0, 0x0, 0x0, 0x0, 0x1c,
+    0xc8, 0x0, 0x0,
+
+    /* U+00C8 "È" */
+    0x0, 0x6d, 0x20, 0x0, 0x0, 0x0, 0x3c, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xf8, 0x2f, 0x11, 0x11, 0x11, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2,
+    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfb,
+    0x2, 0xf2, 0x22, 0x22, 0x10, 0x2f, 0x0, 0x0,
+    0x0, 0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0,
+    0x0, 0x0, 0x2, 0xf1, 0x11, 0x11, 0x11, 0x2f,
+    0xff, 0xff, 0xff, 0xc0,
+
+    /* U+00C9 "É" */
+    0x0, 0x0, 0xb, 0xa0, 0x0, 0x0, 0xb, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xf8, 0x2f, 0x11, 0x11, 0x11, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2,
+    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfb,
+    0x2, 0xf2, 0x22, 0x22, 0x10, 0x2f, 0x0, 0x0,
+    0x0, 0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0,
+    0x0, 0x0, 0x2, 0xf1, 0x11, 0x11, 0x11, 0x2f,
+    0xff, 0xff, 0xff, 0xc0,
+
+    /* U+00CA "Ê" */
+    0x0, 0x6, 0xdb, 0x0, 0x0, 0x7, 0xa0, 0x5b,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
+    0xff, 0xf8, 0x2f, 0x11, 0x11, 0x11, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0, 0x2,
+    0xf0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfb,
+    0x2, 0xf2, 0x22, 0x22, 0x10, 0x2f, 0x0, 0x0,
+    0x0, 0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0,
+    0x0, 0x0, 0x2, 0xf1, 0x11, 0x11, 0x11, 0x2f,
+    0xff, 0xff, 0xff, 0xc0,
+
+    /* U+00CB "Ë" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x7b,
+    0x0, 0x0, 0x2, 0x1, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x82, 0xf1,
+    0x11, 0x11, 0x10, 0x2f, 0x0, 0x0, 0x0, 0x2,
+    0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xb0, 0x2f, 0x22, 0x22,
+    0x21, 0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f, 0x0,
+    0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x0, 0x2f,
+    0x11, 0x11, 0x11, 0x12, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+00CC "Ì" */
+    0x9, 0xc0, 0x0, 0x5, 0xc1, 0x0, 0x0, 0x0,
+    0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0,
+    0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2,
+    0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f,
+    0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0,
+
+    /* U+00CD "Í" */
+    0x2, 0xd7, 0x2, 0xc3, 0x0, 0x0, 0x0, 0x2,
+    0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f,
+    0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0,
+    0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0,
+    0x2, 0xf0, 0x0, 0x2f, 0x0, 0x0,
+
+    /* U+00CE "Î" */
+    0x0, 0xad, 0x80, 0x0, 0xa6, 0x9, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x2f,
+    0x0, 0x0, 0x2, 0xf0, 0x0, 0x0, 0x2f, 0x0,
+    0x0, 0x2, 0xf0, 0x0, 0x0, 0x2f, 0x0, 0x0,
+    0x2, 0xf0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x2,
+    0xf0, 0x0, 0x0, 0x2f, 0x0, 0x0, 0x2, 0xf0,
+    0x0, 0x0, 0x2f, 0x0, 0x0,
+
+    /* U+00CF "Ï" */
+    0x0, 0x0, 0x9, 0x90, 0xb6, 0x11, 0x2, 0x10,
+    0x0, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2,
+    0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f,
+    0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0, 0x2, 0xf0,
+    0x0, 0x2f, 0x0, 0x2, 0xf0, 0x0, 0x2f, 0x0,
+
+    /* U+00D0 "Ð" */
+    0x1, 0xff, 0xff, 0xfe, 0xa3, 0x0, 0x0, 0x1f,
+    0x21, 0x11, 0x38, 0xf8, 0x0, 0x1, 0xf1, 0x0,
+    0x0, 0x2, 0xe6, 0x0, 0x1f, 0x10, 0x0, 0x0,
+    0x5, 0xe0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0xe,
+    0x4c, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xc6, 0x1,
+    0xf1, 0x0, 0x0, 0x0, 0xc, 0x60, 0x1f, 0x10,
+    0x0, 0x0, 0x0, 0xe4, 0x1, 0xf1, 0x0, 0x0,
+    0x0, 0x5e, 0x0, 0x1f, 0x10, 0x0, 0x0, 0x2e,
+    0x60, 0x1, 0xf2, 0x11, 0x13, 0x8f, 0x80, 0x0,
+    0x1f, 0xff, 0xff, 0xea, 0x30, 0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x7, 0xc6, 0xa, 0x0, 0x0, 0x0, 0xa0,
+    0x6b, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xf3, 0x0, 0x0, 0x0, 0xf3, 0x2f, 0xd0,
+    0x0, 0x0, 0xf, 0x32, 0xfc, 0xa0, 0x0, 0x0,
+    0xf3, 0x2f, 0x2f, 0x60, 0x0, 0xf, 0x32, 0xf0,
+    0x5f, 0x20, 0x0, 0xf3, 0x2f, 0x0, 0x9d, 0x0,
+    0xf, 0x32, 0xf0, 0x0, 0xd9, 0x0, 0xf3, 0x2f,
+    0x0, 0x2, 0xf5, 0xf, 0x32, 0xf0, 0x0, 0x6,
+    0xf2, 0xf3, 0x2f, 0x0, 0x0, 0xa, 0xcf, 0x32,
+    0xf0, 0x0, 0x0, 0xd, 0xf3, 0x2f, 0x0, 0x0,
+    0x0, 0x3f, 0x30,
+
+    /* U+00D2 "Ò" */
+    0x0, 0x0, 0x5d, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2c, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
+    0x40, 0x0, 0x0, 0x4e, 0xb4, 0x23, 0x8e, 0x90,
+    0x0, 0x2f, 0x60, 0x0, 0x0, 0x2d, 0x80, 0xa,
+    0xa0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xd6, 0x1f, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x81, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xa8, 0xf, 0x30, 0x0, 0x0, 0x0, 0xd, 0x60,
+    0xaa, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x2, 0xf6,
+    0x0, 0x0, 0x2, 0xd8, 0x0, 0x4, 0xeb, 0x42,
+    0x37, 0xea, 0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb4,
+    0x0, 0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
+    0x40, 0x0, 0x0, 0x4e, 0xb4, 0x23, 0x8e, 0x90,
+    0x0, 0x2f, 0x60, 0x0, 0x0, 0x2d, 0x80, 0xa,
+    0xa0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xd6, 0x1f, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x81, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xa8, 0xf, 0x30, 0x0, 0x0, 0x0, 0xd, 0x60,
+    0xaa, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x2, 0xf6,
+    0x0, 0x0, 0x2, 0xd8, 0x0, 0x4, 0xeb, 0x42,
+    0x37, 0xea, 0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb4,
+    0x0, 0x0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0x0, 0x6, 0xdc, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xa0, 0x5b, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
+    0x40, 0x0, 0x0, 0x4e, 0xb4, 0x23, 0x8e, 0x90,
+    0x0, 0x2f, 0x60, 0x0, 0x0, 0x2d, 0x80, 0xa,
+    0xa0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xd6, 0x1f, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x81, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xa8, 0xf, 0x30, 0x0, 0x0, 0x0, 0xd, 0x60,
+    0xaa, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x2, 0xf6,
+    0x0, 0x0, 0x2, 0xd8, 0x0, 0x4, 0xeb, 0x42,
+    0x37, 0xea, 0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb4,
+    0x0, 0x0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0x0, 0x4c, 0x80, 0x82, 0x0, 0x0, 0x0,
+    0x9, 0x4, 0xb9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
+    0x40, 0x0, 0x0, 0x4e, 0xb4, 0x23, 0x8e, 0x90,
+    0x0, 0x2f, 0x60, 0x0, 0x0, 0x2d, 0x80, 0xa,
+    0xa0, 0x0, 0x0, 0x0, 0x3f, 0x10, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0xd6, 0x1f, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0x81, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xa8, 0xf, 0x30, 0x0, 0x0, 0x0, 0xd, 0x60,
+    0xaa, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x2, 0xf6,
+    0x0, 0x0, 0x2, 0xd8, 0x0, 0x4, 0xeb, 0x42,
+    0x37, 0xea, 0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb4,
+    0x0, 0x0,
+
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xd0, 0x7b, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0x8d, 0xfe, 0xb4, 0x0,
+    0x0, 0x4, 0xeb, 0x42, 0x38, 0xe9, 0x0, 0x2,
+    0xf6, 0x0, 0x0, 0x2, 0xd8, 0x0, 0xaa, 0x0,
+    0x0, 0x0, 0x3, 0xf1, 0xf, 0x30, 0x0, 0x0,
+    0x0, 0xd, 0x61, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xa8, 0x1f, 0x0, 0x0, 0x0, 0x0, 0xa, 0x80,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0xd6, 0xa, 0xa0,
+    0x0, 0x0, 0x0, 0x3f, 0x10, 0x2f, 0x60, 0x0,
+    0x0, 0x2d, 0x80, 0x0, 0x4e, 0xb4, 0x23, 0x7e,
+    0xa0, 0x0, 0x0, 0x18, 0xdf, 0xeb, 0x40, 0x0,
+
+    /* U+00D7 "×" */
+    0xa, 0x0, 0x9, 0x20, 0x8c, 0x9, 0xb0, 0x0,
+    0x9e, 0xc0, 0x0, 0x7, 0xfa, 0x0, 0x6, 0xd1,
+    0xb9, 0x0, 0xc1, 0x0, 0xb2, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00D8 "Ø" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0x0, 0x0,
+    0x18, 0xdf, 0xeb, 0x5c, 0x10, 0x0, 0x4e, 0xb4,
+    0x23, 0x8f, 0xe0, 0x0, 0x2f, 0x60, 0x0, 0x5,
+    0xcd, 0x80, 0xa, 0xa0, 0x0, 0x1, 0xc0, 0x3f,
+    0x10, 0xf3, 0x0, 0x0, 0xb3, 0x0, 0xd6, 0x1f,
+    0x0, 0x0, 0x68, 0x0, 0xa, 0x81, 0xf0, 0x0,
+    0x2c, 0x0, 0x0, 0xa8, 0xf, 0x30, 0xc, 0x30,
+    0x0, 0xd, 0x60, 0xaa, 0x7, 0x70, 0x0, 0x3,
+    0xf1, 0x2, 0xf9, 0xc0, 0x0, 0x2, 0xd8, 0x0,
+    0x4, 0xfd, 0x42, 0x37, 0xea, 0x0, 0x0, 0x98,
+    0x8d, 0xfe, 0xb4, 0x0, 0x0, 0x4b, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00D9 "Ù" */
+    0x0, 0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6b,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0,
+    0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0,
+    0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e,
+    0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0,
+    0x0, 0x3e, 0x3f, 0x0, 0x0, 0x0, 0x4e, 0x1f,
+    0x20, 0x0, 0x0, 0x7b, 0xc, 0x80, 0x0, 0x0,
+    0xd6, 0x3, 0xf9, 0x32, 0x4c, 0xc0, 0x0, 0x2a,
+    0xef, 0xd8, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0x0, 0x2, 0xd6, 0x0, 0x0, 0x0, 0x3c,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0,
+    0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0,
+    0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e,
+    0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0,
+    0x0, 0x3e, 0x3f, 0x0, 0x0, 0x0, 0x4e, 0x1f,
+    0x20, 0x0, 0x0, 0x7b, 0xc, 0x80, 0x0, 0x0,
+    0xd6, 0x3, 0xf9, 0x32, 0x4c, 0xc0, 0x0, 0x2a,
+    0xef, 0xd8, 0x0,
+
+    /* U+00DB "Û" */
+    0x0, 0x0, 0xbd, 0x60, 0x0, 0x0, 0xb, 0x50,
+    0xa7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0,
+    0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0,
+    0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e,
+    0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0,
+    0x0, 0x3e, 0x3f, 0x0, 0x0, 0x0, 0x4e, 0x1f,
+    0x20, 0x0, 0x0, 0x7b, 0xc, 0x80, 0x0, 0x0,
+    0xd6, 0x3, 0xf9, 0x32, 0x4c, 0xc0, 0x0, 0x2a,
+    0xef, 0xd8, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x70,
+    0xd5, 0x0, 0x0, 0x2, 0x10, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0,
+    0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0,
+    0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e,
+    0x4e, 0x0, 0x0, 0x0, 0x3e, 0x4e, 0x0, 0x0,
+    0x0, 0x3e, 0x4e, 0x0, 0x0, 0x0, 0x3e, 0x3f,
+    0x0, 0x0, 0x0, 0x4e, 0x1f, 0x20, 0x0, 0x0,
+    0x7b, 0xc, 0x80, 0x0, 0x0, 0xd6, 0x3, 0xf9,
+    0x32, 0x4c, 0xc0, 0x0, 0x2a, 0xef, 0xd8, 0x0,
+
+    /* U+00DD "Ý" */
+    0x0, 0x0, 0x5, 0xd3, 0x0, 0x0, 0x0, 0x6,
+    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0x90, 0x0, 0x0, 0x5, 0xd0, 0x2f, 0x20,
+    0x0, 0x0, 0xd4, 0x0, 0x8b, 0x0, 0x0, 0x7b,
+    0x0, 0x1, 0xe4, 0x0, 0x1e, 0x20, 0x0, 0x6,
+    0xd0, 0x9, 0x90, 0x0, 0x0, 0xd, 0x62, 0xe1,
+    0x0, 0x0, 0x0, 0x4e, 0xc6, 0x0, 0x0, 0x0,
+    0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x8, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8a,
+    0x0, 0x0, 0x0,
+
+    /* U+00DE "Þ" */
+    0x2f, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0xfe, 0xc6, 0x0, 0x2f,
+    0x22, 0x23, 0x6e, 0xa0, 0x2f, 0x0, 0x0, 0x1,
+    0xf4, 0x2f, 0x0, 0x0, 0x0, 0xb8, 0x2f, 0x0,
+    0x0, 0x0, 0xa8, 0x2f, 0x0, 0x0, 0x0, 0xe5,
+    0x2f, 0x0, 0x0, 0x3c, 0xd0, 0x2f, 0xff, 0xff,
+    0xf9, 0x10, 0x2f, 0x22, 0x21, 0x0, 0x0, 0x2f,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+00DF "ß" */
+    0x0, 0x8e, 0xfd, 0x60, 0x0, 0xac, 0x31, 0x4e,
+    0x70, 0x2f, 0x10, 0x0, 0x4e, 0x5, 0xd0, 0x0,
+    0x2, 0xf0, 0x6b, 0x0, 0x0, 0x5d, 0x6, 0xb0,
+    0x0, 0x4e, 0x40, 0x6b, 0x0, 0xef, 0xc2, 0x6,
+    0xb0, 0x1, 0x27, 0xe3, 0x6b, 0x0, 0x0, 0x7,
+    0xc6, 0xb0, 0x0, 0x0, 0x4e, 0x6b, 0x0, 0x0,
+    0x6, 0xc6, 0xb0, 0x12, 0x16, 0xf5, 0x6b, 0x7,
+    0xff, 0xc5, 0x0,
+
+    /* U+00E0 "à" */
+    0x0, 0x9c, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0,
+    0x0, 0x0, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9e, 0xfd, 0x70, 0xa, 0x92, 0x14, 0xe6,
+    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x3e,
+    0x2, 0xad, 0xee, 0xef, 0xd, 0x70, 0x0, 0x3f,
+    0x1f, 0x0, 0x0, 0x4f, 0xd, 0x70, 0x3, 0xdf,
+    0x2, 0xbe, 0xdb, 0x4f,
+
+    /* U+00E1 "á" */
+    0x0, 0x0, 0xb, 0xa0, 0x0, 0x0, 0x9a, 0x0,
+    0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9e, 0xfd, 0x70, 0xa, 0x92, 0x14, 0xe6,
+    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x3e,
+    0x2, 0xad, 0xee, 0xef, 0xd, 0x70, 0x0, 0x3f,
+    0x1f, 0x0, 0x0, 0x4f, 0xd, 0x70, 0x3, 0xdf,
+    0x2, 0xbe, 0xdb, 0x4f,
+
+    /* U+00E2 "â" */
+    0x0, 0x6, 0xf8, 0x0, 0x0, 0x4c, 0x1b, 0x60,
+    0x0, 0x61, 0x0, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9e, 0xfd, 0x70, 0xa, 0x92, 0x14, 0xe6,
+    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x3e,
+    0x2, 0xad, 0xee, 0xef, 0xd, 0x70, 0x0, 0x3f,
+    0x1f, 0x0, 0x0, 0x4f, 0xd, 0x70, 0x3, 0xdf,
+    0x2, 0xbe, 0xdb, 0x4f,
+
+    /* U+00E3 "ã" */
+    0x0, 0x5d, 0x40, 0xa0, 0x0, 0xb0, 0x91, 0xb0,
+    0x0, 0x90, 0x1b, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x9e, 0xfd, 0x70, 0xa, 0x92, 0x14, 0xe6,
+    0x0, 0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x3e,
+    0x2, 0xad, 0xee, 0xef, 0xd, 0x70, 0x0, 0x3f,
+    0x1f, 0x0, 0x0, 0x4f, 0xd, 0x70, 0x3, 0xdf,
+    0x2, 0xbe, 0xdb, 0x4f,
+
+    /* U+00E4 "ä" */
+    0x0, 0x6a, 0x8, 0x80, 0x0, 0x23, 0x3, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9e, 0xfd, 0x70,
+    0xa, 0x92, 0x14, 0xe6, 0x0, 0x0, 0x0, 0x6c,
+    0x0, 0x0, 0x0, 0x3e, 0x2, 0xad, 0xee, 0xef,
+    0xd, 0x70, 0x0, 0x3f, 0x1f, 0x0, 0x0, 0x4f,
+    0xd, 0x70, 0x3, 0xdf, 0x2, 0xbe, 0xdb, 0x4f,
+
+    /* U+00E5 "å" */
+    0x0, 0x5, 0x96, 0x0, 0x0, 0x9, 0x8, 0x10,
+    0x0, 0x9, 0x8, 0x10, 0x0, 0x5, 0x96, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9e, 0xfd, 0x70,
+    0xa, 0x92, 0x14, 0xe6, 0x0, 0x0, 0x0, 0x6c,
+    0x0, 0x0, 0x0, 0x3e, 0x2, 0xad, 0xee, 0xef,
+    0xd, 0x70, 0x0, 0x3f, 0x1f, 0x0, 0x0, 0x4f,
+    0xd, 0x70, 0x3, 0xdf, 0x2, 0xbe, 0xdb, 0x4f,
+
+    /* U+00E6 "æ" */
+    0x1, 0x9e, 0xfd, 0x70, 0x2b, 0xfe, 0xa1, 0x0,
+    0xa, 0x92, 0x14, 0xe8, 0xe7, 0x12, 0x8e, 0x10,
+    0x0, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x9, 0x90,
+    0x0, 0x0, 0x0, 0x3f, 0x10, 0x0, 0x3, 0xe0,
+    0x2, 0xad, 0xee, 0xef, 0xee, 0xee, 0xee, 0xf0,
+    0xd, 0x70, 0x0, 0x3f, 0x10, 0x0, 0x0, 0x0,
+    0x1f, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x0, 0x0,
+    0xd, 0x92, 0x16, 0xe5, 0xf8, 0x21, 0x4d, 0x30,
+    0x2, 0xbe, 0xfb, 0x30, 0x2a, 0xef, 0xc6, 0x0,
+
+    /* U+00E7 "ç" */
+    0x0, 0x2b, 0xef, 0xb3, 0x0, 0x3f, 0x72, 0x17,
+    0xf2, 0xd, 0x70, 0x0, 0x2, 0x2, 0xf0, 0x0,
+    0x0, 0x0, 0x3e, 0x0, 0x0, 0x0, 0x2, 0xf0,
+    0x0, 0x0, 0x0, 0xd, 0x70, 0x0, 0x2, 0x0,
+    0x3f, 0x72, 0x16, 0xf2, 0x0, 0x3b, 0xff, 0xb3,
+    0x0, 0x0, 0xc, 0x20, 0x0, 0x0, 0x0, 0x1c,
+    0x10, 0x0, 0x0, 0x9b, 0xb0, 0x0,
+
+    /* U+00E8 "è" */
+    0x0, 0x5e, 0x30, 0x0, 0x0, 0x0, 0x4d, 0x20,
+    0x0, 0x0, 0x0, 0x35, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3b, 0xfe, 0x91, 0x0, 0x4f,
+    0x61, 0x29, 0xd0, 0xd, 0x60, 0x0, 0xa, 0x72,
+    0xf0, 0x0, 0x0, 0x4c, 0x3f, 0xee, 0xee, 0xee,
+    0xd2, 0xf0, 0x0, 0x0, 0x0, 0xd, 0x60, 0x0,
+    0x0, 0x0, 0x3f, 0x82, 0x15, 0xd2, 0x0, 0x2a,
+    0xef, 0xc5, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x7, 0xd2, 0x0, 0x0, 0x5, 0xd1,
+    0x0, 0x0, 0x0, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3b, 0xfe, 0x91, 0x0, 0x4f,
+    0x61, 0x29, 0xd0, 0xd, 0x60, 0x0, 0xa, 0x72,
+    0xf0, 0x0, 0x0, 0x4c, 0x3f, 0xee, 0xee, 0xee,
+    0xd2, 0xf0, 0x0, 0x0, 0x0, 0xd, 0x60, 0x0,
+    0x0, 0x0, 0x3f, 0x82, 0x15, 0xd2, 0x0, 0x2a,
+    0xef, 0xc5, 0x0,
+
+    /* U+00EA "ê" */
+    0x0, 0x3, 0xec, 0x0, 0x0, 0x1, 0xd3, 0x7a,
+    0x0, 0x0, 0x43, 0x0, 0x52, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3b, 0xfe, 0x91, 0x0, 0x4f,
+    0x61, 0x29, 0xd0, 0xd, 0x60, 0x0, 0xa, 0x72,
+    0xf0, 0x0, 0x0, 0x4c, 0x3f, 0xee, 0xee, 0xee,
+    0xd2, 0xf0, 0x0, 0x0, 0x0, 0xd, 0x60, 0x0,
+    0x0, 0x0, 0x3f, 0x82, 0x15, 0xd2, 0x0, 0x2a,
+    0xef, 0xc5, 0x0,
+
+    /* U+00EB "ë" */
+    0x0, 0x2d, 0x4, 0xc0, 0x0, 0x0, 0x50, 0x14,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xbf,
+    0xe9, 0x10, 0x4, 0xf6, 0x12, 0x9d, 0x0, 0xd6,
+    0x0, 0x0, 0xa7, 0x2f, 0x0, 0x0, 0x4, 0xc3,
+    0xfe, 0xee, 0xee, 0xed, 0x2f, 0x0, 0x0, 0x0,
+    0x0, 0xd6, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x21,
+    0x5d, 0x20, 0x2, 0xae, 0xfc, 0x50,
+
+    /* U+00EC "ì" */
+    0x1d, 0x70, 0x0, 0x1c, 0x60, 0x0, 0x6, 0x0,
+    0x0, 0x0, 0x0, 0x6b, 0x0, 0x6, 0xb0, 0x0,
+    0x6b, 0x0, 0x6, 0xb0, 0x0, 0x6b, 0x0, 0x6,
+    0xb0, 0x0, 0x6b, 0x0, 0x6, 0xb0, 0x0, 0x6b,
+    0x0,
+
+    /* U+00ED "í" */
+    0x3, 0xe5, 0x2d, 0x40, 0x42, 0x0, 0x0, 0x0,
+    0x6b, 0x0, 0x6b, 0x0, 0x6b, 0x0, 0x6b, 0x0,
+    0x6b, 0x0, 0x6b, 0x0, 0x6b, 0x0, 0x6b, 0x0,
+    0x6b, 0x0,
+
+    /* U+00EE "î" */
+    0x0, 0xbe, 0x10, 0x7, 0xa5, 0xc0, 0x5, 0x0,
+    0x51, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0,
+    0x6b, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x6b, 0x0,
+    0x0, 0x6b, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x6b,
+    0x0, 0x0, 0x6b, 0x0, 0x0, 0x6b, 0x0,
+
+    /* U+00EF "ï" */
+    0x69, 0x4b, 0x23, 0x14, 0x0, 0x0, 0x6, 0xb0,
+    0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0,
+    0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0, 0x6, 0xb0,
+
+    /* U+00F0 "ð" */
+    0x4, 0xdf, 0xfc, 0x66, 0x70, 0x1, 0x20, 0x4c,
+    0xef, 0x20, 0x0, 0x7c, 0x83, 0xa, 0x90, 0x0,
+    0x20, 0x0, 0x1, 0xf0, 0x0, 0x4b, 0xed, 0x70,
+    0xd3, 0x6, 0xe6, 0x23, 0xaa, 0xc5, 0xe, 0x40,
+    0x0, 0xa, 0xf5, 0x3f, 0x0, 0x0, 0x4, 0xf4,
+    0x3f, 0x0, 0x0, 0x4, 0xf1, 0xf, 0x40, 0x0,
+    0xa, 0xb0, 0x7, 0xe5, 0x12, 0x9e, 0x20, 0x0,
+    0x6d, 0xfe, 0xa2, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x0, 0x6c, 0x20, 0xa0, 0x0, 0xb, 0x9, 0x1a,
+    0x0, 0x0, 0x80, 0x2b, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6a, 0x3c, 0xfe, 0x90, 0x6, 0xdd,
+    0x41, 0x2c, 0xb0, 0x6f, 0x20, 0x0, 0x1f, 0x26,
+    0xd0, 0x0, 0x0, 0xd4, 0x6b, 0x0, 0x0, 0xd,
+    0x56, 0xb0, 0x0, 0x0, 0xd5, 0x6b, 0x0, 0x0,
+    0xd, 0x56, 0xb0, 0x0, 0x0, 0xd5, 0x6b, 0x0,
+    0x0, 0xd, 0x50,
+
+    /* U+00F2 "ò" */
+    0x0, 0x3e, 0x40, 0x0, 0x0, 0x0, 0x2, 0xd3,
+    0x0, 0x0, 0x0, 0x0, 0x26, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xef, 0xb3,
+    0x0, 0x3, 0xf7, 0x21, 0x7f, 0x40, 0xd, 0x70,
+    0x0, 0x6, 0xd0, 0x2f, 0x0, 0x0, 0x0, 0xf2,
+    0x3e, 0x0, 0x0, 0x0, 0xe4, 0x2f, 0x0, 0x0,
+    0x0, 0xf2, 0xd, 0x70, 0x0, 0x6, 0xd0, 0x3,
+    0xf7, 0x21, 0x7f, 0x40, 0x0, 0x3b, 0xff, 0xb3,
+    0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0x0, 0x4, 0xe3, 0x0, 0x0, 0x0, 0x3e,
+    0x30, 0x0, 0x0, 0x0, 0x62, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xef, 0xb3,
+    0x0, 0x3, 0xf7, 0x21, 0x7f, 0x40, 0xd, 0x70,
+    0x0, 0x6, 0xd0, 0x2f, 0x0, 0x0, 0x0, 0xf2,
+    0x3e, 0x0, 0x0, 0x0, 0xe4, 0x2f, 0x0, 0x0,
+    0x0, 0xf2, 0xd, 0x70, 0x0, 0x6, 0xd0, 0x3,
+    0xf7, 0x21, 0x7f, 0x40, 0x0, 0x3b, 0xff, 0xb3,
+    0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0x1, 0xdd, 0x10, 0x0, 0x0, 0xc, 0x55,
+    0xc0, 0x0, 0x0, 0x34, 0x0, 0x43, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xef, 0xb3,
+    0x0, 0x3, 0xf7, 0x21, 0x7f, 0x40, 0xd, 0x70,
+    0x0, 0x6, 0xd0, 0x2f, 0x0, 0x0, 0x0, 0xf2,
+    0x3e, 0x0, 0x0, 0x0, 0xe4, 0x2f, 0x0, 0x0,
+    0x0, 0xf2, 0xd, 0x70, 0x0, 0x6, 0xd0, 0x3,
+    0xf7, 0x21, 0x7f, 0x40, 0x0, 0x3b, 0xff, 0xb3,
+    0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0xb, 0x90, 0x37, 0x0, 0x0, 0x56, 0x45,
+    0x64, 0x0, 0x0, 0x62, 0x8, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xef, 0xb3,
+    0x0, 0x3, 0xf7, 0x21, 0x7f, 0x40, 0xd, 0x70,
+    0x0, 0x6, 0xd0, 0x2f, 0x0, 0x0, 0x0, 0xf2,
+    0x3e, 0x0, 0x0, 0x0, 0xe4, 0x2f, 0x0, 0x0,
+    0x0, 0xf2, 0xd, 0x70, 0x0, 0x6, 0xd0, 0x3,
+    0xf7, 0x21, 0x7f, 0x40, 0x0, 0x3b, 0xff, 0xb3,
+    0x0,
+
+    /* U+00F6 "ö" */
+    0x0, 0xe, 0x22, 0xe0, 0x0, 0x0, 0x5, 0x0,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0xef, 0xb3, 0x0, 0x3, 0xf7, 0x21, 0x7f,
+    0x40, 0xd, 0x70, 0x0, 0x6, 0xd0, 0x2f, 0x0,
+    0x0, 0x0, 0xf2, 0x3e, 0x0, 0x0, 0x0, 0xe4,
+    0x2f, 0x0, 0x0, 0x0, 0xf2, 0xd, 0x70, 0x0,
+    0x6, 0xd0, 0x3, 0xf7, 0x21, 0x7f, 0x40, 0x0,
+    0x3b, 0xff, 0xb3, 0x0,
+
+    /* U+00F7 "÷" */
+    0x0, 0xe, 0x30, 0x0, 0x0, 0x8, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0x10, 0x0, 0x0, 0xe, 0x30, 0x0,
+
+    /* U+00F8 "ø" */
+    0x0, 0x0, 0x0, 0x2, 0x90, 0x0, 0x3b, 0xef,
+    0xbe, 0x0, 0x3, 0xf7, 0x21, 0xef, 0x40, 0xd,
+    0x70, 0x2, 0x96, 0xd0, 0x2f, 0x0, 0xa, 0x10,
+    0xf2, 0x3e, 0x0, 0x65, 0x0, 0xe4, 0x2f, 0x1,
+    0xa0, 0x0, 0xf2, 0xd, 0x7a, 0x20, 0x6, 0xd0,
+    0x3, 0xfe, 0x21, 0x7f, 0x40, 0x0, 0xeb, 0xff,
+    0xb3, 0x0, 0x9, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+00F9 "ù" */
+    0x0, 0xba, 0x0, 0x0, 0x0, 0x0, 0xa8, 0x0,
+    0x0, 0x0, 0x0, 0x51, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8a, 0x0, 0x0, 0xf, 0x28, 0xa0,
+    0x0, 0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf, 0x28,
+    0xa0, 0x0, 0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf,
+    0x27, 0xb0, 0x0, 0x1, 0xf2, 0x4e, 0x0, 0x0,
+    0x6f, 0x20, 0xd9, 0x11, 0x5d, 0xf2, 0x1, 0xae,
+    0xfb, 0x2e, 0x20,
+
+    /* U+00FA "ú" */
+    0x0, 0x0, 0x1d, 0x70, 0x0, 0x0, 0xc, 0x60,
+    0x0, 0x0, 0x3, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8a, 0x0, 0x0, 0xf, 0x28, 0xa0,
+    0x0, 0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf, 0x28,
+    0xa0, 0x0, 0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf,
+    0x27, 0xb0, 0x0, 0x1, 0xf2, 0x4e, 0x0, 0x0,
+    0x6f, 0x20, 0xd9, 0x11, 0x5d, 0xf2, 0x1, 0xae,
+    0xfb, 0x2e, 0x20,
+
+    /* U+00FB "û" */
+    0x0, 0xa, 0xf5, 0x0, 0x0, 0x8, 0xa1, 0xd3,
+    0x0, 0x0, 0x60, 0x1, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8a, 0x0, 0x0, 0xf, 0x28, 0xa0,
+    0x0, 0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf, 0x28,
+    0xa0, 0x0, 0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf,
+    0x27, 0xb0, 0x0, 0x1, 0xf2, 0x4e, 0x0, 0x0,
+    0x6f, 0x20, 0xd9, 0x11, 0x5d, 0xf2, 0x1, 0xae,
+    0xfb, 0x2e, 0x20,
+
+    /* U+00FC "ü" */
+    0x0, 0x97, 0xb, 0x40, 0x0, 0x3, 0x20, 0x41,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xa0, 0x0,
+    0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf, 0x28, 0xa0,
+    0x0, 0x0, 0xf2, 0x8a, 0x0, 0x0, 0xf, 0x28,
+    0xa0, 0x0, 0x0, 0xf2, 0x7b, 0x0, 0x0, 0x1f,
+    0x24, 0xe0, 0x0, 0x6, 0xf2, 0xd, 0x91, 0x15,
+    0xdf, 0x20, 0x1a, 0xef, 0xb2, 0xe2,
+
+    /* U+00FD "ý" */
+    0x0, 0x0, 0x3, 0xe4, 0x0, 0x0, 0x0, 0x2d,
+    0x30, 0x0, 0x0, 0x0, 0x42, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0x60, 0x0, 0x0,
+    0xa7, 0x5, 0xd0, 0x0, 0x1, 0xf0, 0x0, 0xe4,
+    0x0, 0x8, 0x90, 0x0, 0x7b, 0x0, 0xe, 0x20,
+    0x0, 0x1f, 0x20, 0x6b, 0x0, 0x0, 0x9, 0x90,
+    0xd4, 0x0, 0x0, 0x2, 0xf4, 0xd0, 0x0, 0x0,
+    0x0, 0xbe, 0x60, 0x0, 0x0, 0x0, 0x5f, 0x0,
+    0x0, 0x0, 0x0, 0x98, 0x0, 0x0, 0x16, 0x15,
+    0xe1, 0x0, 0x0, 0x1b, 0xfd, 0x40, 0x0, 0x0,
+
+    /* U+00FE "þ" */
+    0x6b, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x0, 0x0,
+    0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x6b,
+    0x0, 0x0, 0x0, 0x0, 0x6b, 0x2b, 0xfe, 0xa2,
+    0x0, 0x6d, 0xd6, 0x12, 0x9f, 0x20, 0x6f, 0x40,
+    0x0, 0x9, 0xa0, 0x6d, 0x0, 0x0, 0x2, 0xf0,
+    0x6b, 0x0, 0x0, 0x0, 0xf1, 0x6d, 0x0, 0x0,
+    0x2, 0xf0, 0x6f, 0x40, 0x0, 0x9, 0xb0, 0x6d,
+    0xd6, 0x12, 0x9f, 0x20, 0x6b, 0x2b, 0xfe, 0xb2,
+    0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x6b, 0x0,
+    0x0, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00FF "ÿ" */
+    0x0, 0xd, 0x30, 0xe1, 0x0, 0x0, 0x5, 0x0,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x60, 0x0, 0x0, 0xa7, 0x5, 0xd0, 0x0, 0x1,
+    0xf0, 0x0, 0xe4, 0x0, 0x8, 0x90, 0x0, 0x7b,
+    0x0, 0xe, 0x20, 0x0, 0x1f, 0x20, 0x6b, 0x0,
+    0x0, 0x9, 0x90, 0xd4, 0x0, 0x0, 0x2, 0xf4,
+    0xd0, 0x0, 0x0, 0x0, 0xbe, 0x60, 0x0, 0x0,
+    0x0, 0x5f, 0x0, 0x0, 0x0, 0x0, 0x98, 0x0,
+    0x0, 0x16, 0x15, 0xe1, 0x0, 0x0, 0x1b, 0xfd,
+    0x40, 0x0, 0x0,
+
+    /* U+2600 "☀" */
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x54, 0x0, 0xa, 0x83, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0x88, 0x5, 0x63, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x72, 0x3f, 0xf9, 0x6a, 0x3,
+    0x65, 0x0, 0x0, 0x4, 0x7a, 0x61, 0x4, 0xfd,
+    0x76, 0xa0, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
+    0xa1, 0xa1, 0x0, 0x7a, 0xad, 0x80, 0x0, 0x0,
+    0x1, 0xe6, 0x0, 0x8, 0x60, 0x90, 0x0, 0x0,
+    0x0, 0xf, 0x40, 0x0, 0x5, 0xab, 0x0, 0x0,
+    0x0, 0x0, 0xa8, 0x80, 0x0, 0x1, 0xf0, 0x0,
+    0x0, 0x0, 0xa, 0x3, 0xb0, 0x0, 0x3d, 0x50,
+    0x0, 0x0, 0x2, 0xf9, 0xa9, 0x0, 0xa, 0xb,
+    0x10, 0x0, 0x0, 0xf9, 0x0, 0x0, 0x6, 0x66,
+    0xbf, 0x61, 0x4, 0xa6, 0x70, 0x0, 0x0, 0x37,
+    0x40, 0x68, 0x8f, 0xf6, 0xa, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x62, 0x80, 0x6a, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xa0, 0x0, 0x15, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa4, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+2601 "☁" */
+    0x0, 0x0, 0x0, 0x0, 0x29, 0x9a, 0xa6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x48, 0x0, 0x0,
+    0x79, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0,
+    0x0, 0x0, 0x56, 0x0, 0x0, 0x0, 0x4, 0x9c,
+    0x50, 0x0, 0x0, 0x0, 0xa0, 0x0, 0x0, 0x6,
+    0x80, 0x8, 0x50, 0x0, 0x0, 0xa, 0x0, 0x0,
+    0x0, 0xa0, 0x0, 0xa, 0x0, 0x0, 0x0, 0xa0,
+    0x0, 0x4, 0xb7, 0x0, 0x0, 0x20, 0x0, 0x0,
+    0x5, 0xb2, 0x6, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xa0, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa0, 0x3a,
+    0x41, 0x41, 0x0, 0x0, 0x0, 0x0, 0x2, 0x96,
+    0x0, 0x16, 0x75, 0xa7, 0x58, 0x90, 0x0, 0xa,
+    0x83, 0x0, 0x0, 0x0, 0x0, 0x24, 0x22, 0x9a,
+    0xaa, 0x30, 0x0, 0x0,
+
+    /* U+26A1 "⚡" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8d, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x1a, 0x59, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xa1, 0x91, 0x0, 0x0, 0x0, 0x0, 0x68,
+    0x4, 0x60, 0x0, 0x0, 0x0, 0x9, 0x50, 0xa,
+    0x0, 0x0, 0x0, 0x2, 0xa2, 0x0, 0x73, 0x0,
+    0x0, 0x0, 0x49, 0x0, 0x0, 0x9a, 0xaa, 0xb7,
+    0x7, 0x60, 0x0, 0x0, 0x0, 0x2, 0x91, 0x3d,
+    0xaa, 0xaa, 0x80, 0x0, 0x49, 0x0, 0x0, 0x0,
+    0x5, 0x50, 0x7, 0x70, 0x0, 0x0, 0x0, 0x9,
+    0x0, 0x94, 0x0, 0x0, 0x0, 0x0, 0x82, 0x1a,
+    0x20, 0x0, 0x0, 0x0, 0x3, 0x72, 0xa1, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0x59, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5c, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+26C5 "⛅" */
+    0x0, 0x0, 0x0, 0x0, 0x56, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xa1, 0x1, 0x99, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9a, 0x48,
+    0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa0, 0xde, 0x9c, 0x69, 0xac, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaa, 0x40, 0x5, 0xc1, 0xba, 0x20,
+    0x0, 0x0, 0x8, 0x99, 0xd2, 0x0, 0x0, 0xb9,
+    0x55, 0x99, 0x0, 0x0, 0x7, 0x81, 0xa0, 0x0,
+    0x7, 0x30, 0x0, 0x2, 0xb0, 0x0, 0x0, 0x19,
+    0xc0, 0x5, 0x88, 0x0, 0x0, 0x0, 0x65, 0x0,
+    0x0, 0x7, 0xd1, 0x94, 0x19, 0x50, 0x0, 0x0,
+    0x19, 0x0, 0x0, 0x39, 0x2e, 0x60, 0x0, 0xa0,
+    0x0, 0x0, 0x9, 0x0, 0x0, 0xb7, 0xff, 0x20,
+    0x0, 0x30, 0x0, 0x0, 0x29, 0x90, 0x0, 0x4c,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56,
+    0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x65, 0x0, 0x2, 0x99, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x70,
+
+    /* U+26C8 "⛈" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x89, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x10, 0x3a,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x9, 0x30, 0x0,
+    0x0, 0xa1, 0x0, 0x0, 0x0, 0x6, 0x9c, 0x10,
+    0x0, 0x0, 0x37, 0x0, 0x0, 0x0, 0xa4, 0x3,
+    0xb1, 0x0, 0x0, 0xa, 0x0, 0x0, 0x4, 0x60,
+    0x0, 0x28, 0x0, 0x0, 0xa, 0x0, 0x2, 0xab,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xb2, 0xa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0x7, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xa3, 0x0, 0x13, 0x44, 0x49, 0x74, 0xa4,
+    0x44, 0x43, 0x0, 0x0, 0x4, 0x60, 0xb, 0x0,
+    0xab, 0x60, 0x46, 0x0, 0x0, 0xf, 0x80, 0x2c,
+    0x55, 0xa, 0x20, 0xf8, 0x0, 0x0, 0x9, 0x20,
+    0x4, 0x4b, 0x65, 0x0, 0x92, 0x0, 0x0, 0x0,
+    0x6, 0x50, 0xc, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0x60, 0xb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+2744 "❄" */
+    0x0, 0x0, 0x0, 0x2, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1a, 0x74, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xab, 0x6b, 0xa0, 0x0, 0x0,
+    0x0, 0xb, 0x63, 0x80, 0x4, 0x73, 0xb3, 0x0,
+    0xa, 0xb9, 0x90, 0x3a, 0x58, 0x9, 0x4d, 0xa4,
+    0xa, 0x31, 0x85, 0xa, 0x63, 0x2b, 0x3, 0x83,
+    0x9, 0x81, 0x26, 0xab, 0x6b, 0x91, 0x24, 0xd0,
+    0xa, 0x99, 0x97, 0x11, 0x11, 0x4a, 0x8a, 0xb1,
+    0x0, 0x0, 0x7, 0x76, 0xc2, 0xc0, 0x0, 0x0,
+    0x9, 0xa9, 0x97, 0x1, 0x11, 0x4a, 0x8a, 0xb1,
+    0x9, 0x82, 0x26, 0xab, 0x6b, 0x81, 0x34, 0xc0,
+    0xa, 0x31, 0x85, 0xa, 0x63, 0x2b, 0x3, 0x83,
+    0xb, 0xa9, 0x90, 0x2b, 0x67, 0x9, 0x4c, 0x94,
+    0x0, 0xc, 0x82, 0x91, 0x6, 0x74, 0xc4, 0x0,
+    0x0, 0x0, 0x6, 0x99, 0x5a, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x4a, 0x66, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x70, 0x0, 0x0, 0x0,
+
+    /* U+1F327 "🌧" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x89, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x96, 0x10, 0x4a,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0x30, 0x0,
+    0x0, 0xa1, 0x0, 0x0, 0x0, 0x6, 0x9c, 0x0,
+    0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0xa4, 0x4,
+    0xb0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x5, 0x50,
+    0x0, 0x45, 0x0, 0x0, 0xb, 0x0, 0x3, 0xaa,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xa3, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0x5, 0xa9, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x80, 0x0, 0xc,
+    0x10, 0x0, 0x68, 0x0, 0x0, 0xf, 0x80, 0x0,
+    0x7f, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x8, 0x20,
+    0x0, 0x37, 0x0, 0x0, 0x82, 0x0, 0x0, 0x0,
+    0x0, 0x92, 0x0, 0x8, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xf2, 0x0, 0x4f, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x80, 0x0, 0x28, 0x0, 0x0,
+    0x0,
+
+    /* U+1F328 "🌨" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x89, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x96, 0x10, 0x4b,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0x20, 0x0,
+    0x0, 0xa1, 0x0, 0x0, 0x0, 0x6, 0x9b, 0x0,
+    0x0, 0x0, 0x27, 0x0, 0x0, 0x0, 0xa3, 0x4,
+    0xb0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x5, 0x50,
+    0x0, 0x54, 0x0, 0x0, 0xb, 0x0, 0x3, 0xa9,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5, 0xa3, 0xa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x19, 0x5, 0xa9, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x99, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0x60, 0x0, 0x49,
+    0x20, 0x0, 0x59, 0x10, 0x0, 0x4e, 0xa0, 0x0,
+    0x8f, 0x60, 0x0, 0x9e, 0x50, 0x0, 0x3, 0x30,
+    0x0, 0x34, 0x20, 0x0, 0x44, 0x10, 0x0, 0x0,
+    0x0, 0x86, 0x0, 0x2, 0xc7, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xea, 0x0, 0x3, 0xd8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0x0, 0x0, 0x12, 0x0,
+    0x0,
+
+    /* U+1F32B "🌫" */
+    0x15, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x63,
+    0xb, 0x44, 0x45, 0xe6, 0x44, 0x44, 0x44, 0x44,
+    0xa2, 0xa0, 0x0, 0x0, 0xa9, 0x9b, 0xf8, 0x88,
+    0x77, 0x4a, 0x0, 0x0, 0x38, 0x88, 0xa3, 0x0,
+    0x0, 0xb4, 0xa0, 0x0, 0xa7, 0x21, 0x30, 0x0,
+    0x0, 0x5, 0x4d, 0x10, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x54, 0xda, 0xb7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x4a, 0x6, 0xa9, 0xaa, 0xa8,
+    0x10, 0x0, 0x0, 0x54, 0xa0, 0x2, 0x0, 0x0,
+    0x2a, 0x40, 0x0, 0x5, 0x4a, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0x9a, 0x96, 0x64, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0x4a, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x17, 0x9a, 0xf4, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x89, 0x30, 0x5, 0x4a, 0x0,
+    0x0, 0x1, 0x68, 0xb3, 0x0, 0x0, 0x54, 0xa0,
+    0x0, 0x19, 0x94, 0x10, 0x0, 0x0, 0x5, 0x4a,
+    0x0, 0x2b, 0x20, 0x0, 0x0, 0x0, 0x0, 0x73,
+    0x49, 0xad, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa7,
+    0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 67, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 67, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12, .adv_w = 95, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 22, .adv_w = 178, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 88, .adv_w = 157, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 168, .adv_w = 212, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 246, .adv_w = 171, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 318, .adv_w = 52, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 323, .adv_w = 84, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 355, .adv_w = 84, .box_w = 4, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 387, .adv_w = 99, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 408, .adv_w = 147, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 440, .adv_w = 54, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 448, .adv_w = 98, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 454, .adv_w = 54, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 457, .adv_w = 86, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 513, .adv_w = 169, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 573, .adv_w = 92, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 597, .adv_w = 145, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 651, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 705, .adv_w = 169, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 771, .adv_w = 145, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 825, .adv_w = 156, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 885, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 939, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 999, .adv_w = 156, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1053, .adv_w = 54, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1067, .adv_w = 54, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1085, .adv_w = 147, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1117, .adv_w = 147, .box_w = 8, .box_h = 5, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1137, .adv_w = 147, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1169, .adv_w = 145, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1217, .adv_w = 264, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1337, .adv_w = 184, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1409, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1475, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1541, .adv_w = 211, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1613, .adv_w = 171, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1667, .adv_w = 162, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1721, .adv_w = 198, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1787, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1853, .adv_w = 77, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1871, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1919, .adv_w = 182, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1985, .adv_w = 151, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2039, .adv_w = 244, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2117, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2183, .adv_w = 215, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2261, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2321, .adv_w = 215, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2419, .adv_w = 185, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2479, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2539, .adv_w = 147, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2599, .adv_w = 203, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2659, .adv_w = 179, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2731, .adv_w = 284, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2839, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2905, .adv_w = 163, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2971, .adv_w = 167, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3031, .adv_w = 81, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3063, .adv_w = 86, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 3119, .adv_w = 81, .box_w = 4, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3151, .adv_w = 147, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 3176, .adv_w = 128, .box_w = 8, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3180, .adv_w = 154, .box_w = 4, .box_h = 2, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 3184, .adv_w = 151, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3220, .adv_w = 174, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3285, .adv_w = 144, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3326, .adv_w = 174, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3391, .adv_w = 155, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3432, .adv_w = 87, .box_w = 6, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3471, .adv_w = 176, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3531, .adv_w = 173, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3590, .adv_w = 69, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3603, .adv_w = 70, .box_w = 6, .box_h = 16, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 3651, .adv_w = 154, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3710, .adv_w = 69, .box_w = 2, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3723, .adv_w = 272, .box_w = 15, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3791, .adv_w = 173, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3832, .adv_w = 161, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3877, .adv_w = 174, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3937, .adv_w = 174, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3997, .adv_w = 103, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4020, .adv_w = 125, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4056, .adv_w = 104, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4095, .adv_w = 172, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4136, .adv_w = 139, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4177, .adv_w = 225, .box_w = 14, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4240, .adv_w = 137, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4281, .adv_w = 139, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 4341, .adv_w = 131, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4377, .adv_w = 86, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4425, .adv_w = 76, .box_w = 2, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4441, .adv_w = 86, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4481, .adv_w = 147, .box_w = 9, .box_h = 3, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 4495, .adv_w = 67, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4495, .adv_w = 67, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4507, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4566, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4626, .adv_w = 179, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4687, .adv_w = 178, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4759, .adv_w = 76, .box_w = 2, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4775, .adv_w = 125, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4831, .adv_w = 154, .box_w = 5, .box_h = 3, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 4839, .adv_w = 207, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4917, .adv_w = 103, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 4932, .adv_w = 122, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 4960, .adv_w = 147, .box_w = 8, .box_h = 4, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 4976, .adv_w = 98, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 4982, .adv_w = 207, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5060, .adv_w = 154, .box_w = 6, .box_h = 1, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 5063, .adv_w = 107, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 5081, .adv_w = 147, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5121, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 5146, .adv_w = 110, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 5167, .adv_w = 154, .box_w = 5, .box_h = 2, .ofs_x = 3, .ofs_y = 10},
+    {.bitmap_index = 5172, .adv_w = 174, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 5226, .adv_w = 162, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5294, .adv_w = 65, .box_w = 2, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 5296, .adv_w = 154, .box_w = 4, .box_h = 4, .ofs_x = 3, .ofs_y = -4},
+    {.bitmap_index = 5304, .adv_w = 110, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 5322, .adv_w = 106, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 5340, .adv_w = 122, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 5365, .adv_w = 263, .box_w = 15, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5455, .adv_w = 263, .box_w = 15, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5545, .adv_w = 263, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5641, .adv_w = 145, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 5693, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5783, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5873, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5963, .adv_w = 184, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6053, .adv_w = 184, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6149, .adv_w = 184, .box_w = 12, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6251, .adv_w = 264, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6347, .adv_w = 184, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6430, .adv_w = 171, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6498, .adv_w = 171, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6566, .adv_w = 171, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6634, .adv_w = 171, .box_w = 9, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6706, .adv_w = 77, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6744, .adv_w = 77, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6782, .adv_w = 77, .box_w = 7, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6835, .adv_w = 77, .box_w = 5, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6875, .adv_w = 213, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6953, .adv_w = 208, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7036, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7134, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7232, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7330, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7428, .adv_w = 215, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7532, .adv_w = 147, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 7557, .adv_w = 215, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7648, .adv_w = 203, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7723, .adv_w = 203, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7798, .adv_w = 203, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7873, .adv_w = 203, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7953, .adv_w = 163, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8036, .adv_w = 184, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8096, .adv_w = 171, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8155, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8207, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8259, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8311, .adv_w = 151, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8363, .adv_w = 151, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8411, .adv_w = 151, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8467, .adv_w = 252, .box_w = 16, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8539, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8593, .adv_w = 155, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8652, .adv_w = 155, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8711, .adv_w = 155, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8770, .adv_w = 155, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8824, .adv_w = 69, .box_w = 5, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8857, .adv_w = 69, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8883, .adv_w = 69, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8922, .adv_w = 69, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8946, .adv_w = 162, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9006, .adv_w = 173, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9065, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9130, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9195, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9260, .adv_w = 161, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9325, .adv_w = 161, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9385, .adv_w = 147, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 9417, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9472, .adv_w = 172, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9531, .adv_w = 172, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9590, .adv_w = 172, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9649, .adv_w = 172, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9703, .adv_w = 139, .box_w = 10, .box_h = 16, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 9783, .adv_w = 174, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 9863, .adv_w = 139, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 9938, .adv_w = 325, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 10083, .adv_w = 325, .box_w = 19, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 10207, .adv_w = 325, .box_w = 14, .box_h = 17, .ofs_x = 3, .ofs_y = -3},
+    {.bitmap_index = 10326, .adv_w = 325, .box_w = 20, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10476, .adv_w = 325, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10629, .adv_w = 325, .box_w = 16, .box_h = 17, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 10765, .adv_w = 325, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 10918, .adv_w = 325, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 11071, .adv_w = 325, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = -3}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x1, 0xa1, 0xc5, 0xc8, 0x144
+};
+
+static const uint8_t glyph_id_ofs_list_3[] = {
+    0, 1, 0, 0, 2
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 9728, .range_length = 325, .glyph_id_start = 192,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 127783, .range_length = 5, .glyph_id_start = 198,
+        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_3, .list_length = 5, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9,
+    0, 61, 47, 62, 63, 64, 0, 65,
+    0, 22, 8, 66, 0, 9, 22, 0,
+    67, 0, 0, 0, 0, 51, 29, 9,
+    0, 0, 8, 9, 0, 0, 0, 68,
+    23, 23, 23, 23, 23, 23, 26, 25,
+    26, 26, 26, 26, 29, 29, 29, 29,
+    22, 29, 22, 22, 22, 22, 22, 0,
+    22, 30, 30, 30, 30, 39, 69, 46,
+    45, 45, 45, 45, 45, 45, 49, 47,
+    49, 49, 49, 49, 51, 51, 70, 51,
+    71, 45, 46, 46, 46, 46, 46, 9,
+    46, 51, 51, 51, 51, 58, 46, 58,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] =
+{
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9,
+    0, 49, 39, 50, 51, 52, 0, 53,
+    0, 23, 8, 9, 9, 9, 23, 0,
+    54, 0, 0, 0, 0, 42, 55, 9,
+    0, 0, 8, 56, 0, 0, 0, 57,
+    24, 24, 24, 24, 24, 24, 24, 23,
+    25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 23, 23, 23, 23, 23, 0,
+    23, 28, 28, 28, 28, 31, 25, 38,
+    37, 37, 37, 37, 37, 37, 37, 39,
+    39, 39, 39, 39, 58, 42, 59, 60,
+    39, 42, 39, 39, 39, 39, 39, 9,
+    39, 45, 45, 45, 45, 46, 38, 46,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] =
+{
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 3, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 12, 0, 7,
+    -6, 0, 0, 0, 0, -14, -15, 2,
+    12, 6, 5, -10, 2, 14, 1, 12,
+    3, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 15, 1, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -5, 5,
+    0, 5, 13, 0, -13, 0, 0, 0,
+    0, -8, 0, 0, 0, 0, 0, -5,
+    5, 5, 0, 0, -3, 0, -2, 3,
+    0, -3, 0, -3, -1, -5, 0, 0,
+    0, 0, -3, 0, 0, -4, -4, 0,
+    0, -3, 0, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, -3, 0,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    -3, 0, 0, 0, 0, -7, 0, -30,
+    0, 0, -5, 0, 5, 8, 0, 0,
+    -5, 3, 3, 9, 5, -5, 5, 0,
+    0, -15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, 0, 0, 0, 0, 0,
+    -3, -14, 0, -10, -2, 0, 0, 0,
+    0, 1, 11, 0, -8, -1, -1, 1,
+    0, -5, 0, 0, -2, -20, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -20, -1, 12, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, -9, -10, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 8, 0,
+    3, 0, 0, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -10, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 5, 3, 8,
+    -3, 0, 0, 5, -3, -8, -36, 2,
+    7, 5, 1, -4, 0, 10, 0, 9,
+    0, 9, 0, -24, 0, -3, 8, 0,
+    9, -3, 5, 3, 0, 0, 1, -3,
+    0, 0, -5, 20, 0, 20, 0, 8,
+    0, 12, 3, 5, 0, 0, 2, 0,
+    0, 8, 10, 3, -22, 20, 20, 20,
+    0, 0, 0, -10, 0, 0, 0, 0,
+    1, -2, 0, 2, -4, -3, -5, 2,
+    0, -3, 0, 0, 0, -10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -6, 3, 0, -23, -3,
+    0, 0, 0, 0, 1, -14, 0, -16,
+    0, 0, 0, 0, -2, 0, 26, -3,
+    -3, 3, 3, -3, 0, -3, 3, 0,
+    0, -13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -25, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, -3, -8,
+    0, -16, -31, 1, 3, 0, 0, 0,
+    0, 15, 0, 0, -10, 0, 8, 0,
+    -17, -25, -17, -5, 8, 0, 0, -17,
+    0, 4, -6, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, -32, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -17, -3, 0, 10, -5, 12, 0, -14,
+    -19, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 2, 2, -3, -5, 0,
+    -1, -1, -3, 0, 0, -2, 0, 0,
+    0, -5, 0, -2, 0, -6, -5, 0,
+    -6, -8, -8, -5, 0, -5, 0, -5,
+    0, 0, 0, 0, -2, 0, 0, 3,
+    0, 2, -3, 0, 0, 0, 0, -3,
+    0, 1, 0, 0, -8, 0, 0, 0,
+    0, 0, 0, 3, -2, 0, 0, 0,
+    -2, 3, 3, -1, 0, 0, 0, -6,
+    0, -1, 0, 0, 0, 0, 0, 1,
+    0, 3, -2, 0, -3, 0, -4, 0,
+    0, -2, 0, 8, 0, 0, -3, 0,
+    0, 0, 0, 0, -1, 1, -2, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -3, -3, 0, 0,
+    0, 0, 0, 1, 0, 0, -2, 0,
+    -3, -3, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    0, -2, -3, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, -8, -2, -8, 5, 0, 0, -5,
+    3, 5, 7, 0, -6, -1, -4, 0,
+    -1, -13, 3, -2, 2, -13, 3, 0,
+    0, 1, -13, 0, -13, -2, -22, -2,
+    0, -13, 0, 5, 7, 0, 3, 0,
+    0, 0, 0, 0, 0, -4, -3, 0,
+    0, 3, 3, -3, 5, -8, -4, 0,
+    3, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, -1, -1, 0, -1, -4, 0, 0,
+    0, 0, 0, 0, 0, -3, -3, 0,
+    -2, -3, -2, 0, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -5, 3, 0, 0, -4,
+    1, 3, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2,
+    0, 0, -3, 0, -3, -2, -4, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    -2, 0, 0, 0, 0, -2, -4, 0,
+    0, 0, 3, 0, 5, -5, 0, 0,
+    0, 0, 0, 0, 0, 8, -2, 1,
+    -9, 0, 0, 7, -13, -14, -11, -5,
+    3, 0, -2, -17, -5, 0, -5, 0,
+    -5, 4, -5, -17, 0, -7, 0, 0,
+    1, -1, 2, -2, 0, 3, -1, -8,
+    -10, 0, -13, -7, -5, -7, -8, -4,
+    -7, -1, -6, -8, -7, -4, -5, 3,
+    -3, 1, 7, -5, -17, -7, -7, -7,
+    0, 1, 0, -3, 0, 0, 0, 2,
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, -1,
+    0, -1, -3, 0, -4, -5, -5, -1,
+    0, -8, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 2, -1, 0,
+    0, 0, 0, -3, 3, 0, 0, 0,
+    -5, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 12, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -10,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, -6, 0, 0, 0,
+    0, -13, -8, 0, 0, 0, -4, -13,
+    0, 0, -3, 3, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, 0, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, -4, 0, 3, 0, 3,
+    -28, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 4, 0, 2, -5, -5, 0,
+    -3, -3, -3, 0, 0, 0, 0, 0,
+    0, -8, 0, -3, 0, -4, -3, 0,
+    -5, -6, -8, -2, 0, -5, 0, -8,
+    0, 0, 0, 0, 20, 0, 0, 1,
+    0, 0, -3, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, -5, 0, 0, 0,
+    0, -11, 0, 0, 0, 0, 0, -24,
+    -4, 9, 8, -2, -10, 0, 3, -4,
+    0, -13, -1, -4, 3, -18, -3, 2,
+    0, 4, -9, -4, -9, -8, -10, 0,
+    0, -15, 0, 15, 0, 0, -1, 0,
+    0, 0, -1, -1, -3, -7, -8, 0,
+    3, 0, 0, 0, 0, -24, -20, 4,
+    5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    -1, -3, -4, 0, 0, -5, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -5, 0, 0, 5,
+    -1, 4, 0, -6, 3, -2, -1, -8,
+    -3, 0, -4, -3, -2, 0, -4, -5,
+    0, 0, -2, -1, -2, -5, -4, 0,
+    0, -3, 0, 3, -2, 0, -6, 0,
+    0, 0, -5, 0, -5, 0, -5, -5,
+    -3, 0, 0, 0, -2, 3, 2, -1,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 3, 0, -4,
+    0, -2, -4, -10, -2, -2, -2, -1,
+    -2, -4, -1, 0, 0, 0, 0, 0,
+    -3, -2, -2, 0, 0, 0, 0, 4,
+    -2, 0, -2, 0, 0, 0, -2, -4,
+    -2, -3, -4, -3, -2, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    1, 10, -1, 0, -8, 0, -2, 5,
+    0, -3, -11, -4, 4, 0, 0, -13,
+    -5, 3, -5, 2, 0, -3, -2, -8,
+    0, -4, 1, 0, 0, -5, 0, 0,
+    0, 3, 3, -5, -5, 0, -5, -3,
+    -4, -3, -3, 0, -5, 1, -5, -5,
+    -3, 0, 0, 0, -2, 8, 3, -4,
+    -12, -3, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, 0, -4, 0,
+    0, -3, -3, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, -4, 0, -5, 0, 0, 0,
+    -8, 0, 2, -5, 5, 0, -2, -12,
+    0, 0, -5, -3, 0, -10, -6, -7,
+    0, 0, -10, -3, -10, -9, -12, 0,
+    -8, 0, 1, 17, -4, 0, -6, -3,
+    -1, -3, -5, -7, -5, -9, -10, -6,
+    0, 0, 0, 0, 0, -3, -1, -1,
+    0, -3, -3, -3, 0, 0, -2, 0,
+    1, 0, 0, -18, -3, 8, 6, -6,
+    -10, 0, 1, -10, 0, -13, -2, -3,
+    5, -24, -4, 1, 0, 0, -17, -3,
+    -14, -3, -19, 0, 0, -18, 0, 16,
+    1, 0, -2, 0, 0, 0, 0, -1,
+    -2, -10, -2, 0, 0, 0, 0, 0,
+    0, -17, -19, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, -8, 0, -3, 0,
+    -1, -7, -12, 0, 0, -1, -4, -8,
+    -3, 0, -2, 0, 0, 0, 0, -12,
+    -3, -9, -8, -1, -4, -6, -3, -5,
+    0, -5, -3, -8, -4, 0, -3, -6,
+    -3, -6, 0, 1, 0, -2, -9, 0,
+    0, 0, 0, 0, 0, 5, 0, 0,
+    -14, -6, -6, -6, 0, -5, 0, 0,
+    0, 0, 4, 0, 2, -5, 9, 0,
+    -3, -3, -3, 0, 0, 0, 0, 0,
+    0, -8, 0, -3, 0, -4, -3, 0,
+    -5, -6, -8, -2, 0, -5, 1, 10,
+    0, 0, 0, 0, 20, 0, 0, 1,
+    0, 0, -3, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -5,
+    0, 0, 0, 0, 0, -1, 0, 0,
+    0, -3, -3, 0, 0, -5, -3, 0,
+    0, -5, 0, 5, -1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0,
+    -3, 0, 0, 0, 5, 1, -3, 0,
+    -9, -5, 0, 8, -8, -8, -5, -5,
+    10, 4, 3, -23, -2, 5, -3, 0,
+    -3, 2, -3, -9, 0, -3, 3, -4,
+    -1, -8, -1, 0, 0, 8, 5, 0,
+    -7, 0, -14, -4, 6, -4, -10, 1,
+    -4, -9, -9, -3, -5, 0, 0, 0,
+    0, 10, 8, -3, -15, 4, 8, 4,
+    3, 0, -4, 0, -7, 0, 1, 9,
+    -6, -9, -10, -6, 8, 0, 1, -18,
+    -2, 3, -4, -2, -6, 0, -5, -9,
+    -4, -4, -1, 0, 0, -6, -5, -3,
+    0, 8, 6, -3, -14, 0, -14, -5,
+    0, -9, -15, -1, -8, -4, -9, -7,
+    -8, 0, 0, 0, 0, 7, 6, -3,
+    -19, 4, 8, 4, 0, 0, -4, 0,
+    -5, -3, 0, -3, -4, 0, 5, -8,
+    3, 0, 0, -13, 0, -3, -5, -4,
+    -2, -8, -6, -8, -6, 0, -8, -3,
+    -6, -6, -8, -3, 0, 0, 1, 12,
+    -4, 0, -8, -3, 0, -3, -5, -6,
+    -7, -6, -9, -3, -3, 0, 0, 0,
+    0, -5, 0, -1, 1, -3, -3, -3,
+    5, 0, -4, 0, -13, -4, 1, 5,
+    -8, -9, -5, -8, 8, -3, 1, -24,
+    -4, 5, -5, -4, -9, 0, -8, -10,
+    -4, -3, -1, -3, -5, -8, -1, 0,
+    0, 8, 6, -2, -17, 0, -15, -7,
+    5, -10, -17, -5, -9, -10, -13, -8,
+    -10, 0, 0, 0, -5, 5, 6, -4,
+    -21, 8, 6, 4, 0, 0, 0, 0,
+    -4, 0, 0, 3, -4, 5, 2, -5,
+    5, 0, 0, -10, -1, 0, -1, 0,
+    1, 1, -2, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 1, 8,
+    0, 0, -4, 0, 0, 0, 0, -2,
+    -2, -4, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 1, 0,
+    -3, 0, 9, 0, 4, 1, 1, -3,
+    0, 5, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 0, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 3, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, -15, 0, -3,
+    5, 0, 8, 0, 0, 26, 4, -5,
+    -5, 3, 3, -2, 1, -13, 0, 0,
+    12, -15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -17, 9, 36,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 10, 0, 0, 0,
+    8, -15, -8, 3, 8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, -6, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -7,
+    0, 0, 1, 0, 0, 3, 34, -5,
+    -2, 9, 7, -7, 3, 0, 0, 3,
+    3, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -33, 6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 5, -2, -3,
+    7, 0, -20, 3, 0, 0, 0, 0,
+    0, 0, 0, -7, 0, 0, 0, -7,
+    0, 0, 0, 0, -6, -1, 0, 0,
+    0, -6, 0, -4, 0, -12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, -5, -6, 0,
+    0, 0, 0, 0, 0, -4, 0, -7,
+    0, 0, 0, -5, 3, -4, 0, 0,
+    -7, -3, -6, 0, 0, -7, 0, -3,
+    0, -12, 0, -2, 0, 0, -22, -6,
+    -10, -2, -9, 0, 0, -17, 0, -7,
+    -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -5, -2, 0, 0, 0, 0,
+    0, -4, -6, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, -6, 0, -5, 3,
+    -2, 5, 0, -2, -6, -2, -5, -6,
+    0, -4, -1, -2, 2, -7, -1, 0,
+    0, 0, -24, -1, -3, 0, -4, 0,
+    -2, -12, -3, 0, 0, -2, -2, 0,
+    0, 0, 0, 2, 0, -2, -5, -2,
+    0, 0, 0, 0, -3, 4, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, -2, 0, 0, 0, -5,
+    3, 0, 0, 0, -7, -3, -5, 0,
+    0, -7, 0, -3, 0, -12, 0, 0,
+    0, 0, -25, 0, -5, -9, -13, 0,
+    0, -17, 0, -2, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, -4, -1,
+    0, 0, 0, 0, 0, -4, -5, 0,
+    -3, 0, 0, 0, 1, 0, 0, 5,
+    -3, 0, 7, 14, -3, -3, -8, 4,
+    14, 5, 6, -7, 4, 12, 4, 8,
+    6, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 16, 12, -4,
+    -3, 0, -2, 20, 11, 20, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 10, 12, -1, -3, 17, 12, 15,
+    0, 0, -5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, -24, -4, -1, -11, -14, 0,
+    0, -17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, -24, -4,
+    -1, -11, -14, 0, 0, -13, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    -6, 3, 0, -3, 1, 4, 3, -8,
+    0, -1, -2, 3, 0, 1, 0, 0,
+    0, 0, -8, 0, -3, -2, -5, 0,
+    -3, -10, 0, 17, -3, 0, -5, -2,
+    0, -2, -4, 0, -3, -7, -5, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -2, 0, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, -24, -4,
+    -1, -11, -14, 0, 0, -17, 0, 0,
+    0, 0, 0, 0, 13, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, -9, -4, -3, 8,
+    -3, -3, -10, 1, -3, 1, -2, -8,
+    0, 5, 0, 1, 1, 1, -7, -10,
+    -4, 0, -12, -6, -7, -11, -10, 0,
+    -5, -5, -4, -3, -2, -2, -3, -2,
+    0, -2, -1, 4, 0, 4, -2, 0,
+    0, 0, 0, 0, 3, 7, 8, 1,
+    -10, -2, -2, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, -3, -3, 0, 0, -7, 0, -1,
+    0, -5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, 0, 0, 0, 0,
+    0, -4, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, -5,
+    -3, 3, 0, -5, -5, -2, 0, -8,
+    -2, -6, -2, -4, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 9, 0, 0, -5, 0,
+    0, 0, 0, -4, 0, -3, 0, 0,
+    0, 0, 0, 0, -3, -1, -5, 0,
+    0, 0, 0, 0, 0, 0, -2, 0,
+    -6, 0, 0, 12, -3, -9, -7, 2,
+    2, 2, -1, -6, 2, 4, 2, 8,
+    2, 8, -2, -7, 0, 0, -13, 0,
+    0, -8, -7, 0, 0, -5, 0, -3,
+    -4, 0, -4, 0, -4, 0, -2, 4,
+    0, -1, -8, -3, 0, 0, 0, 0,
+    0, 10, 8, 0, -8, 0, 0, 0,
+    0, 0, -3, 0, -5, 0, 0, 3,
+    -6, 0, 3, -3, 1, -1, 0, -8,
+    0, -2, -1, 0, -3, 2, -1, 0,
+    0, 0, -13, -4, -5, 0, -8, 0,
+    0, -12, 0, 10, -3, 0, -5, 0,
+    -1, 0, -3, 0, -3, -8, 0, -3,
+    0, 0, 0, 0, 0, 3, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 3, -4, 1, 0, 0,
+    -4, -2, 0, -4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -17, 0, 6,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 10, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -14, 1, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    -10, 0, 0, 8, -8, -1, 3, -10,
+    5, -3, -3, -10, -3, 2, -9, -5,
+    -8, 0, -4, -12, 0, -5, 0, 0,
+    0, -3, 3, 0, 0, 5, 1, 5,
+    -10, 0, -8, -5, -6, -5, -10, -5,
+    -7, -5, -6, -10, -6, 0, 0, 0,
+    -3, 0, 4, -3, -6, -5, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, -3, 0, 0, 0, -2, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 2, 5, 0, 0,
+    0, 0, 3, 0, -6, -8, -8, -3,
+    8, 0, 3, -3, 0, 7, -3, 0,
+    -10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 3, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, -10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 6, 0, 0, 0, 0, 5,
+    0, 2, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 1, 3, 0,
+    -1, 0, 0, 2, 2, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -15, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 5, 0, 6, 0, 0, 0, 0,
+    0, -16, -15, 1, 11, 8, 4, -10,
+    2, 12, 0, 10, 0, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -17, 0, 0, 0, -1, -8, 0, -15,
+    -5, 0, 0, 0, -10, 1, 10, -12,
+    -11, 0, 0, -11, 0, -11, -11, 0,
+    -1, -34, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -25, 1, 13,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, -6, -13,
+    1, -14, -22, -3, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, -8, 0, -5, -6, -5, 0,
+    -3, 0, 0, 0, 0, -8, 0, -8,
+    0, -10, -6, 0, -3, -8, -8, -5,
+    0, -10, 0, -8, -3, 0, 0, 0,
+    -3, 0, 0, 1, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 0, 0, 0, -5, 0,
+    0, 0, 0, 20, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 0, 0, 0, 0, -24, -4,
+    -1, -11, -14, 0, 0, -17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3,
+    0, -5, 0, 2, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 5, 0, 0,
+    -2, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes =
+{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 71,
+    .right_class_cnt     = 60,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+#endif
+
+#if LVGL_VERSION_MAJOR >= 8
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 4,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+#if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+#endif
+
+};
+
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LVGL_VERSION_MAJOR >= 8
+const lv_font_t montserrat_se_16 = {
+#else
+lv_font_t montserrat_se_16 = {
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 21,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = -1,
+    .underline_thickness = 1,
+#endif
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = NULL,
+#endif
+    .user_data = NULL,
+};
+
+
+
+#endif /*#if MONTSERRAT_SE_16*/
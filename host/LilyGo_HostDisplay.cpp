@@ -0,0 +1,360 @@
+/**
+ * @file      LilyGo_HostDisplay.cpp
+ * @license   MIT
+ * @date      2026-10-18
+ *
+ */
+#include "LilyGo_HostDisplay.h"
+
+// The panel receives RGB565 MSB first, i.e. the bytes of each uint16_t in
+// memory order. Undo that here so the framebuffer holds plain RGB565.
+static inline uint16_t panel_order(uint16_t c)
+{
+    return (uint16_t)((c >> 8) | (c << 8));
+}
+
+static inline void rgb565_to_rgb888(uint16_t c, uint8_t *out)
+{
+    uint8_t r = (c >> 11) & 0x1F;
+    uint8_t g = (c >> 5) & 0x3F;
+    uint8_t b = c & 0x1F;
+    out[0] = (uint8_t)((r << 3) | (r >> 2));
+    out[1] = (uint8_t)((g << 2) | (g >> 4));
+    out[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+LilyGo_HostDisplay::LilyGo_HostDisplay(uint16_t width, uint16_t height) :
+    _fb(NULL), _width(width), _height(height), _brightness(175),
+    _win_xs(0), _win_ys(0), _win_xe(0), _win_ye(0), _win_pos(0),
+    _touch_x(0), _touch_y(0), _touch_pressed(false), _lux(200.0f),
+    _batt_mv(4200), _vbus_in(true)
+{
+    _stats = {0, 0};
+}
+
+LilyGo_HostDisplay::~LilyGo_HostDisplay()
+{
+    free(_fb);
+}
+
+bool LilyGo_HostDisplay::begin()
+{
+    if (!_fb) {
+        _fb = (uint16_t *)calloc((size_t)_width * _height, sizeof(uint16_t));
+    }
+    return _fb != NULL;
+}
+
+void LilyGo_HostDisplay::setRotation(uint8_t rotation)
+{
+    _rotation = rotation % 4;
+}
+
+uint8_t LilyGo_HostDisplay::getRotation()
+{
+    return _rotation;
+}
+
+uint16_t LilyGo_HostDisplay::width()
+{
+    return _width;
+}
+
+uint16_t LilyGo_HostDisplay::height()
+{
+    return _height;
+}
+
+void LilyGo_HostDisplay::setAddrWindow(uint16_t xs, uint16_t ys, uint16_t xe, uint16_t ye)
+{
+    _win_xs = xs;
+    _win_ys = ys;
+    _win_xe = xe < _width ? xe : _width - 1;
+    _win_ye = ye < _height ? ye : _height - 1;
+    _win_pos = 0;
+}
+
+void LilyGo_HostDisplay::writeWindow(const uint16_t *data, uint32_t len)
+{
+    assert(_fb);
+    uint32_t win_w = _win_xe - _win_xs + 1;
+    uint32_t win_h = _win_ye - _win_ys + 1;
+    for (uint32_t i = 0; i < len && _win_pos < win_w * win_h; i++, _win_pos++) {
+        uint32_t x = _win_xs + _win_pos % win_w;
+        uint32_t y = _win_ys + _win_pos / win_w;
+        _fb[y * _width + x] = panel_order(data[i]);
+    }
+    _stats.flushes++;
+    _stats.pixels += len;
+}
+
+void LilyGo_HostDisplay::pushColors(uint16_t *data, uint32_t len)
+{
+    writeWindow(data, len);
+}
+
+void LilyGo_HostDisplay::pushColors(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *data)
+{
+    setAddrWindow(x, y, x + width - 1, y + height - 1);
+    writeWindow(data, (uint32_t)width * height);
+}
+
+void LilyGo_HostDisplay::pushColorsDMA(uint16_t *data, uint32_t len)
+{
+    writeWindow(data, len);
+}
+
+void LilyGo_HostDisplay::setTouch(int16_t x, int16_t y, bool pressed)
+{
+    _touch_x = x;
+    _touch_y = y;
+    _touch_pressed = pressed;
+}
+
+uint8_t LilyGo_HostDisplay::getPoint(int16_t *x, int16_t *y, uint8_t get_point)
+{
+    (void)get_point;
+    if (!_touch_pressed) {
+        return 0;
+    }
+    *x = _touch_x;
+    *y = _touch_y;
+    return 1;
+}
+
+bool LilyGo_HostDisplay::hasTouch()
+{
+    return true;
+}
+
+bool LilyGo_HostDisplay::needFullRefresh()
+{
+    return false;
+}
+
+void LilyGo_HostDisplay::setBrightness(uint8_t level)
+{
+    _brightness = level;
+}
+
+uint8_t LilyGo_HostDisplay::getBrightness()
+{
+    return _brightness;
+}
+
+bool LilyGo_HostDisplay::hasLightSensor()
+{
+    return true;
+}
+
+float LilyGo_HostDisplay::getLux()
+{
+    return _lux;
+}
+
+void LilyGo_HostDisplay::setLux(float lux)
+{
+    _lux = lux;
+}
+
+uint16_t LilyGo_HostDisplay::getBattVoltage()
+{
+    return _batt_mv;
+}
+
+bool LilyGo_HostDisplay::isCharging()
+{
+    return _vbus_in && _batt_mv < 4150;
+}
+
+bool LilyGo_HostDisplay::isVbusIn()
+{
+    return _vbus_in;
+}
+
+void LilyGo_HostDisplay::setBattery(uint16_t millivolts, bool vbus_in)
+{
+    _batt_mv = millivolts;
+    _vbus_in = vbus_in;
+}
+
+const uint16_t *LilyGo_HostDisplay::framebuffer() const
+{
+    return _fb;
+}
+
+uint16_t LilyGo_HostDisplay::pixel(uint16_t x, uint16_t y) const
+{
+    return _fb[(uint32_t)y * _width + x];
+}
+
+HostFrameStats LilyGo_HostDisplay::frameStats() const
+{
+    return _stats;
+}
+
+void LilyGo_HostDisplay::resetFrameStats()
+{
+    _stats = {0, 0};
+}
+
+bool LilyGo_HostDisplay::writePPM(const char *path) const
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+    fprintf(fp, "P6\n%u %u\n255\n", _width, _height);
+    uint8_t rgb[3];
+    for (uint32_t i = 0; i < (uint32_t)_width * _height; i++) {
+        rgb565_to_rgb888(_fb[i], rgb);
+        fwrite(rgb, 1, 3, fp);
+    }
+    return fclose(fp) == 0;
+}
+
+// --- Minimal PNG writer: uncompressed (stored) deflate blocks ---
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320UL ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void write_chunk(FILE *fp, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t hdr[8];
+    put_be32(hdr, len);
+    memcpy(hdr + 4, type, 4);
+    fwrite(hdr, 1, 8, fp);
+    if (len) {
+        fwrite(data, 1, len, fp);
+    }
+    uint32_t crc = crc32_update(0, (const uint8_t *)type, 4);
+    crc = crc32_update(crc, data, len);
+    uint8_t tail[4];
+    put_be32(tail, crc);
+    fwrite(tail, 1, 4, fp);
+}
+
+bool LilyGo_HostDisplay::writePNG(const char *path) const
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        return false;
+    }
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    fwrite(signature, 1, sizeof(signature), fp);
+
+    uint8_t ihdr[13];
+    put_be32(ihdr, _width);
+    put_be32(ihdr + 4, _height);
+    ihdr[8] = 8;    // bit depth
+    ihdr[9] = 2;    // colour type: RGB
+    ihdr[10] = 0;   // compression
+    ihdr[11] = 0;   // filter
+    ihdr[12] = 0;   // interlace
+    write_chunk(fp, "IHDR", ihdr, sizeof(ihdr));
+
+    // Raw scanlines, each prefixed by filter type 0
+    uint32_t stride = (uint32_t)_width * 3 + 1;
+    uint32_t raw_len = stride * _height;
+    uint8_t *raw = (uint8_t *)malloc(raw_len);
+    if (!raw) {
+        fclose(fp);
+        return false;
+    }
+    for (uint32_t y = 0; y < _height; y++) {
+        uint8_t *row = raw + y * stride;
+        row[0] = 0;
+        for (uint32_t x = 0; x < _width; x++) {
+            rgb565_to_rgb888(_fb[y * _width + x], row + 1 + x * 3);
+        }
+    }
+
+    // zlib stream: header, stored blocks of at most 65535 bytes, adler32
+    uint32_t blocks = (raw_len + 65534) / 65535;
+    uint32_t z_len = 2 + raw_len + blocks * 5 + 4;
+    uint8_t *z = (uint8_t *)malloc(z_len);
+    if (!z) {
+        free(raw);
+        fclose(fp);
+        return false;
+    }
+    uint8_t *p = z;
+    *p++ = 0x78;
+    *p++ = 0x01;
+    uint32_t a = 1, b = 0;
+    for (uint32_t off = 0; off < raw_len;) {
+        uint32_t n = raw_len - off > 65535 ? 65535 : raw_len - off;
+        *p++ = (off + n == raw_len) ? 1 : 0;
+        *p++ = (uint8_t)n;
+        *p++ = (uint8_t)(n >> 8);
+        *p++ = (uint8_t)~n;
+        *p++ = (uint8_t)(~n >> 8);
+        memcpy(p, raw + off, n);
+        for (uint32_t i = 0; i < n; i++) {
+            a = (a + raw[off + i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        p += n;
+        off += n;
+    }
+    put_be32(p, (b << 16) | a);
+
+    write_chunk(fp, "IDAT", z, z_len);
+    write_chunk(fp, "IEND", NULL, 0);
+    free(z);
+    free(raw);
+    return fclose(fp) == 0;
+}
+
+int32_t LilyGo_HostDisplay::diffPPM(const char *path) const
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return -1;
+    }
+    unsigned w = 0, h = 0, maxval = 0;
+    if (fscanf(fp, "P6 %u %u %u", &w, &h, &maxval) != 3 || w != _width || h != _height || maxval != 255) {
+        fclose(fp);
+        return -1;
+    }
+    fgetc(fp);  // single whitespace after the header
+
+    int32_t diff = 0;
+    uint8_t ref[3], cur[3];
+    for (uint32_t i = 0; i < (uint32_t)_width * _height; i++) {
+        if (fread(ref, 1, 3, fp) != 3) {
+            fclose(fp);
+            return -1;
+        }
+        rgb565_to_rgb888(_fb[i], cur);
+        if (memcmp(ref, cur, 3) != 0) {
+            diff++;
+        }
+    }
+    fclose(fp);
+    return diff;
+}
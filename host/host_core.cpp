@@ -0,0 +1,148 @@
+/**
+ * @file      host_core.cpp
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host implementations of the Arduino core, WiFi and Preferences
+ *            stand-ins in host/include.
+ */
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <map>
+#include <vector>
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+
+// --- Deterministic clock ---
+// Starts at a non-zero value so "millis() - last > period" checks behave
+// like they do a moment after boot on the device.
+static uint64_t host_clock_us = 1000ULL * 1000ULL;
+
+extern "C" uint32_t millis(void)
+{
+    return (uint32_t)(host_clock_us / 1000ULL);
+}
+
+extern "C" uint32_t micros(void)
+{
+    return (uint32_t)host_clock_us;
+}
+
+extern "C" void delay(uint32_t ms)
+{
+    host_clock_us += (uint64_t)ms * 1000ULL;
+}
+
+extern "C" void host_clock_advance(uint32_t ms)
+{
+    host_clock_us += (uint64_t)ms * 1000ULL;
+}
+
+// --- Memory ---
+extern "C" void *ps_malloc(size_t size)
+{
+    return malloc(size);
+}
+
+extern "C" void *ps_calloc(size_t n, size_t size)
+{
+    return calloc(n, size);
+}
+
+extern "C" void *ps_realloc(void *ptr, size_t size)
+{
+    return realloc(ptr, size);
+}
+
+extern "C" void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+// --- Preferences ---
+typedef std::map<std::string, std::vector<uint8_t>> PrefNamespace;
+
+static std::map<std::string, PrefNamespace> &pref_store()
+{
+    static std::map<std::string, PrefNamespace> store;
+    return store;
+}
+
+bool Preferences::begin(const char *name, bool readOnly)
+{
+    _namespace = name;
+    _readOnly = readOnly;
+    _started = true;
+    return true;
+}
+
+void Preferences::end()
+{
+    _started = false;
+}
+
+bool Preferences::clear()
+{
+    if (!_started || _readOnly) {
+        return false;
+    }
+    pref_store()[_namespace].clear();
+    return true;
+}
+
+bool Preferences::remove(const char *key)
+{
+    if (!_started || _readOnly) {
+        return false;
+    }
+    return pref_store()[_namespace].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char *key)
+{
+    return _started && pref_store()[_namespace].count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len)
+{
+    if (!_started || _readOnly || !key) {
+        return 0;
+    }
+    const uint8_t *p = (const uint8_t *)value;
+    pref_store()[_namespace][key] = std::vector<uint8_t>(p, p + len);
+    return len;
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+    if (!isKey(key)) {
+        return 0;
+    }
+    return pref_store()[_namespace][key].size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen)
+{
+    size_t len = getBytesLength(key);
+    if (len == 0 || len > maxLen) {
+        return 0;
+    }
+    memcpy(buf, pref_store()[_namespace][key].data(), len);
+    return len;
+}
+
+size_t Preferences::putUInt(const char *key, uint32_t value)
+{
+    return putBytes(key, &value, sizeof(value));
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue)
+{
+    uint32_t value = defaultValue;
+    if (getBytes(key, &value, sizeof(value)) != sizeof(value)) {
+        return defaultValue;
+    }
+    return value;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file      host_fixtures.cpp
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Fixture data source behind the host HTTPClient.
+ *
+ *            Forecast URLs map to  $HOST_FIXTURE_DIR/forecast.json
+ *            History URLs map to   $HOST_FIXTURE_DIR/history-<param>-<station>.json
+ *                            or    $HOST_FIXTURE_DIR/history-<param>.json
+ *
+ *            Without a matching file a synthetic reply is generated. It only
+ *            depends on the URL, so renders are reproducible between runs.
+ */
+#include <HTTPClient.h>
+#include <time.h>
+
+// 2025-08-15T00:00:00Z, the "now" of the synthetic data
+static const uint64_t FIXTURE_EPOCH_MS = 1755216000000ULL;
+static const int FIXTURE_FORECAST_HOURS = 10 * 24;
+static const int FIXTURE_HISTORY_HOURS = 2200;  // about three months, like latest-months
+
+static bool read_file(const std::string &path, std::string &out)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) {
+        return false;
+    }
+    char buf[4096];
+    size_t n;
+    out.clear();
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        out.append(buf, n);
+    }
+    fclose(fp);
+    return true;
+}
+
+// Returns the path segment following `key` in `url`, e.g. "/station/" -> "65090"
+static std::string url_segment(const std::string &url, const char *key)
+{
+    size_t pos = url.find(key);
+    if (pos == std::string::npos) {
+        return std::string();
+    }
+    pos += strlen(key);
+    size_t end = url.find('/', pos);
+    return url.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+}
+
+// Small deterministic noise source so synthetic series are not perfectly smooth
+static float fixture_noise(uint32_t &state)
+{
+    state = state * 1664525UL + 1013904223UL;
+    return (float)((state >> 8) & 0xFFFF) / 65535.0f - 0.5f;
+}
+
+static void format_iso8601(uint64_t ms, char *out, size_t size)
+{
+    time_t t = (time_t)(ms / 1000ULL);
+    struct tm tm_utc;
+    gmtime_r(&t, &tm_utc);
+    strftime(out, size, "%Y-%m-%dT%H:%M:%SZ", &tm_utc);
+}
+
+static void synth_forecast(const std::string &url, std::string &body)
+{
+    uint32_t seed = 0;
+    for (char c : url) {
+        seed = seed * 31 + (uint8_t)c;
+    }
+    body = "{\"approvedTime\":\"2025-08-15T00:00:00Z\",\"timeSeries\":[";
+    char item[192];
+    char time_buf[32];
+    for (int h = 0; h < FIXTURE_FORECAST_HOURS; h++) {
+        uint64_t ms = FIXTURE_EPOCH_MS + (uint64_t)h * 3600000ULL;
+        format_iso8601(ms, time_buf, sizeof(time_buf));
+        float temp = 16.0f + 6.0f * sinf((float)(h - 9) * 2.0f * (float)M_PI / 24.0f) + 2.0f * fixture_noise(seed);
+        int symbol = 1 + (h / 24 * 5 + (int)(seed >> 28)) % 27;
+        snprintf(item, sizeof(item), "%s{\"time\":\"%s\",\"data\":{\"air_temperature\":%.1f,\"symbol_code\":%d}}",
+                 h ? "," : "", time_buf, temp, symbol);
+        body += item;
+    }
+    body += "]}";
+}
+
+static float synth_history_value(int param, int h, uint32_t &seed)
+{
+    float day = sinf((float)h * 2.0f * (float)M_PI / 24.0f);
+    float week = sinf((float)h * 2.0f * (float)M_PI / (24.0f * 7.0f));
+    switch (param) {
+    case 1:     // Air temperature, C
+        return 12.0f + 5.0f * day + 4.0f * week + fixture_noise(seed);
+    case 6:     // Relative humidity, %
+        return 75.0f - 15.0f * day + 5.0f * week + 2.0f * fixture_noise(seed);
+    case 4:     // Wind speed, m/s
+        return 5.0f + 3.0f * fabsf(week) + 1.5f * fixture_noise(seed);
+    case 9:     // Air pressure, hPa
+        return 1012.0f + 12.0f * week + fixture_noise(seed);
+    default:
+        return 10.0f * day;
+    }
+}
+
+static void synth_history(const std::string &url, int param, std::string &body)
+{
+    uint32_t seed = 0;
+    for (char c : url) {
+        seed = seed * 31 + (uint8_t)c;
+    }
+    body = "{\"value\":[";
+    char item[96];
+    uint64_t first = FIXTURE_EPOCH_MS - (uint64_t)FIXTURE_HISTORY_HOURS * 3600000ULL;
+    for (int h = 0; h < FIXTURE_HISTORY_HOURS; h++) {
+        snprintf(item, sizeof(item), "%s{\"date\":%llu,\"value\":\"%.1f\",\"quality\":\"G\"}",
+                 h ? "," : "", (unsigned long long)(first + (uint64_t)h * 3600000ULL),
+                 synth_history_value(param, h, seed));
+        body += item;
+    }
+    body += "]}";
+}
+
+bool host_fixture_lookup(const char *url, std::string &body)
+{
+    std::string u(url);
+    const char *dir = getenv("HOST_FIXTURE_DIR");
+    std::string base = dir ? std::string(dir) + "/" : std::string();
+
+    if (u.find("/metfcst/") != std::string::npos || u.find("metfcst.smhi.se") != std::string::npos) {
+        if (dir && read_file(base + "forecast.json", body)) {
+            return true;
+        }
+        synth_forecast(u, body);
+        return true;
+    }
+
+    if (u.find("metobs.smhi.se") != std::string::npos) {
+        std::string param = url_segment(u, "/parameter/");
+        std::string station = url_segment(u, "/station/");
+        if (dir && (read_file(base + "history-" + param + "-" + station + ".json", body) ||
+                    read_file(base + "history-" + param + ".json", body))) {
+            return true;
+        }
+        synth_history(u, atoi(param.c_str()), body);
+        return true;
+    }
+    return false;
+}
+
+bool HTTPClient::begin(const String &url)
+{
+    _url = url.c_str();
+    return true;
+}
+
+int HTTPClient::GET()
+{
+    std::string body;
+    if (!host_fixture_lookup(_url.c_str(), body)) {
+        return HTTP_CODE_NOT_FOUND;
+    }
+    _stream.assign(body);
+    return HTTP_CODE_OK;
+}
+
+String HTTPClient::errorToString(int error)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "HTTP %d", error);
+    return String(buf);
+}
@@ -0,0 +1,156 @@
+/**
+ * @file      Arduino.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host (native) stand-in for the Arduino-ESP32 core. Only what
+ *            project.cpp and LV_Helper.cpp use is provided. Time is a
+ *            deterministic clock that only moves when delay() or
+ *            host_clock_advance() is called.
+ */
+#pragma once
+
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOW     0x0
+#define HIGH    0x1
+#define INPUT   0x01
+#define OUTPUT  0x03
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Time ---
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(uint32_t ms);
+void host_clock_advance(uint32_t ms);
+
+// --- Memory ---
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_8BIT     (1 << 2)
+
+void *ps_malloc(size_t size);
+void *ps_calloc(size_t n, size_t size);
+void *ps_realloc(void *ptr, size_t size);
+void *heap_caps_malloc(size_t size, uint32_t caps);
+
+#ifdef __cplusplus
+}
+
+#include <string>
+
+typedef bool boolean;
+
+static inline bool psramFound() { return true; }
+static inline bool esp_ptr_dma_capable(const void *p) { return p != NULL; }
+
+// --- String ---
+class String
+{
+public:
+    String() {}
+    String(const char *s) : _s(s ? s : "") {}
+    String(const std::string &s) : _s(s) {}
+    String(int v) : _s(std::to_string(v)) {}
+
+    const char *c_str() const { return _s.c_str(); }
+    size_t length() const { return _s.length(); }
+    String &operator+=(const char *s) { _s += (s ? s : ""); return *this; }
+    String &operator+=(const String &s) { _s += s._s; return *this; }
+    String &operator+=(char c) { _s += c; return *this; }
+    bool operator==(const char *s) const { return _s == (s ? s : ""); }
+
+private:
+    std::string _s;
+};
+
+// --- Print / Stream / Serial ---
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (n < size && write(buffer[n])) {
+            n++;
+        }
+        return n;
+    }
+};
+
+class Printable
+{
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Stream : public Print
+{
+public:
+    size_t write(uint8_t c) override { (void)c; return 0; }
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual size_t readBytes(char *buffer, size_t length)
+    {
+        size_t n = 0;
+        while (n < length) {
+            int c = read();
+            if (c < 0) {
+                break;
+            }
+            buffer[n++] = (char)c;
+        }
+        return n;
+    }
+};
+
+class HardwareSerial
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void flush() { fflush(stderr); }
+    int available() { return 0; }
+    int read() { return -1; }
+    size_t print(const char *s) { return fputs(s, stderr) < 0 ? 0 : strlen(s); }
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return fputc(c, stderr) < 0 ? 0 : 1; }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(int v) { return print((long)v); }
+    size_t print(unsigned int v) { return print((unsigned long)v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+    size_t println() { return print("\n"); }
+    template <typename T>
+    size_t println(T v) { size_t n = print(v); return n + println(); }
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, fmt);
+        int n = vfprintf(stderr, fmt, args);
+        va_end(args);
+        return n < 0 ? 0 : (size_t)n;
+    }
+};
+
+extern HardwareSerial Serial;
+
+// --- Sketch entry points (defined by project.cpp) ---
+void setup();
+void loop();
+
+#endif // __cplusplus
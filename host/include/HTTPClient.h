@@ -0,0 +1,58 @@
+/**
+ * @file      HTTPClient.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in for the ESP32 HTTPClient. Requests are answered by
+ *            the fixture data source: a JSON file from $HOST_FIXTURE_DIR when
+ *            one matches the URL, otherwise a deterministic synthetic reply
+ *            shaped like the SMHI open data API.
+ */
+#pragma once
+
+#include <Arduino.h>
+
+#define HTTP_CODE_OK        200
+#define HTTP_CODE_NOT_FOUND 404
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HostBufferStream : public Stream
+{
+public:
+    void assign(const std::string &data) { _data = data; _pos = 0; }
+    int available() override { return (int)(_data.size() - _pos); }
+    int read() override { return _pos < _data.size() ? (unsigned char)_data[_pos++] : -1; }
+    size_t readBytes(char *buffer, size_t length) override
+    {
+        size_t n = _data.size() - _pos;
+        if (n > length) {
+            n = length;
+        }
+        memcpy(buffer, _data.data() + _pos, n);
+        _pos += n;
+        return n;
+    }
+
+private:
+    std::string _data;
+    size_t _pos = 0;
+};
+
+class HTTPClient
+{
+public:
+    void useHTTP10(bool usehttp10) { (void)usehttp10; }
+    void setTimeout(uint16_t timeout) { (void)timeout; }
+    bool begin(const String &url);
+    void addHeader(const char *name, const char *value) { (void)name; (void)value; }
+    int GET();
+    Stream &getStream() { return _stream; }
+    void end() { _stream.assign(std::string()); }
+    static String errorToString(int error);
+
+private:
+    std::string _url;
+    HostBufferStream _stream;
+};
+
+// Builds the body for a fixture URL; exposed so host tools can dump fixtures.
+bool host_fixture_lookup(const char *url, std::string &body);
@@ -0,0 +1,14 @@
+/**
+ * @file      LilyGo_AMOLED.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in. Shadows src/LilyGo_AMOLED.h so that the sketch's
+ *            `LilyGo_Class amoled;` becomes the in-memory framebuffer display.
+ */
+#pragma once
+
+#include "LilyGo_HostDisplay.h"
+
+#ifndef LilyGo_Class
+#define LilyGo_Class LilyGo_HostDisplay
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file      LilyGo_HostDisplay.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Headless LilyGo_Display that renders into an in-memory RGB565
+ *            framebuffer. Used by the native build for render benchmarks and
+ *            screenshot (pixel-diff) tests.
+ */
+#pragma once
+
+#include <Arduino.h>
+#include "LilyGo_Display.h"
+
+// Default geometry matches the T4-S3 2.41 inch RM690B0 panel at rotation 0
+#define HOST_DISPLAY_WIDTH      600
+#define HOST_DISPLAY_HEIGHT     450
+
+struct HostFrameStats {
+    uint32_t flushes;       // number of pushColors calls
+    uint32_t pixels;        // pixels written to the framebuffer
+};
+
+class LilyGo_HostDisplay : public LilyGo_Display
+{
+public:
+    LilyGo_HostDisplay(uint16_t width = HOST_DISPLAY_WIDTH, uint16_t height = HOST_DISPLAY_HEIGHT);
+    ~LilyGo_HostDisplay();
+
+    bool begin();
+
+    void setRotation(uint8_t rotation) override;
+    uint8_t getRotation() override;
+    void setAddrWindow(uint16_t xs, uint16_t ys, uint16_t xe, uint16_t ye) override;
+    void pushColors(uint16_t *data, uint32_t len) override;
+    void pushColors(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *data) override;
+    void pushColorsDMA(uint16_t *data, uint32_t len) override;
+    uint16_t width() override;
+    uint16_t height() override;
+
+    uint8_t getPoint(int16_t *x, int16_t *y, uint8_t get_point = 1) override;
+    bool hasTouch() override;
+
+    bool needFullRefresh() override;
+
+    void setBrightness(uint8_t level);
+    uint8_t getBrightness();
+
+    bool hasLightSensor();
+    float getLux();
+
+    uint16_t getBattVoltage();
+    bool isCharging();
+    bool isVbusIn();
+
+    // --- Host only ---
+
+    // Scripted touch input, returned by getPoint() until released
+    void setTouch(int16_t x, int16_t y, bool pressed);
+
+    // Scripted ambient light, returned by getLux()
+    void setLux(float lux);
+
+    // Scripted PMU state; starts on USB power with a full battery
+    void setBattery(uint16_t millivolts, bool vbus_in);
+
+    // Pixels are stored in panel order: RGB565, not byte swapped
+    const uint16_t *framebuffer() const;
+    uint16_t pixel(uint16_t x, uint16_t y) const;
+
+    HostFrameStats frameStats() const;
+    void resetFrameStats();
+
+    bool writePPM(const char *path) const;
+    bool writePNG(const char *path) const;
+
+    /**
+     * @brief  Compare the framebuffer against a binary PPM (P6) reference
+     * @retval Number of differing pixels, or -1 if the file is unreadable or
+     *         its size does not match the display
+     */
+    int32_t diffPPM(const char *path) const;
+
+private:
+    void writeWindow(const uint16_t *data, uint32_t len);
+
+    uint16_t *_fb;
+    uint16_t _width, _height;
+    uint8_t _brightness;
+    // Current address window, as set by setAddrWindow()
+    uint16_t _win_xs, _win_ys, _win_xe, _win_ye;
+    uint32_t _win_pos;
+    HostFrameStats _stats;
+    int16_t _touch_x, _touch_y;
+    bool _touch_pressed;
+    float _lux;
+    uint16_t _batt_mv;
+    bool _vbus_in;
+};
@@ -0,0 +1,31 @@
+/**
+ * @file      Preferences.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in for the ESP32 NVS Preferences library. Values live
+ *            in memory for the lifetime of the process.
+ */
+#pragma once
+
+#include <Arduino.h>
+
+class Preferences
+{
+public:
+    bool begin(const char *name, bool readOnly = false);
+    void end();
+    bool clear();
+    bool remove(const char *key);
+    bool isKey(const char *key);
+
+    size_t putUInt(const char *key, uint32_t value);
+    uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+    size_t putBytes(const char *key, const void *value, size_t len);
+    size_t getBytes(const char *key, void *buf, size_t maxLen);
+    size_t getBytesLength(const char *key);
+
+private:
+    std::string _namespace;
+    bool _readOnly = true;
+    bool _started = false;
+};
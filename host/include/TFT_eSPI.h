@@ -0,0 +1,8 @@
+/**
+ * @file      TFT_eSPI.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in. project.cpp includes TFT_eSPI but draws through
+ *            LVGL only, so nothing is needed here.
+ */
+#pragma once
@@ -0,0 +1,96 @@
+/**
+ * @file      WiFi.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in for the ESP32 WiFi library. The station reports
+ *            itself associated as soon as begin() is called, and raises
+ *            ARDUINO_EVENT_WIFI_STA_GOT_IP right there, so fetches go
+ *            straight to the fixture data source (see HTTPClient.h).
+ */
+#pragma once
+
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+} wifi_mode_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_STA_CONNECTED = 4,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED = 5,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP = 7,
+} arduino_event_id_t;
+
+typedef struct {
+    uint8_t reason;
+} wifi_event_sta_disconnected_t;
+
+typedef union {
+    wifi_event_sta_disconnected_t wifi_sta_disconnected;
+} arduino_event_info_t;
+
+typedef void (*WiFiEventFuncCb)(arduino_event_id_t event, arduino_event_info_t info);
+
+class IPAddress
+{
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : _b{a, b, c, d} {}
+    uint8_t operator[](int i) const { return _b[i]; }
+
+private:
+    uint8_t _b[4];
+};
+
+class WiFiClass
+{
+public:
+    bool mode(wifi_mode_t m) { (void)m; return true; }
+    wl_status_t begin(const char *ssid, const char *passphrase = NULL, int32_t channel = 0,
+                      const uint8_t *bssid = NULL, bool connect = true)
+    {
+        (void)passphrase;
+        (void)bssid;
+        (void)connect;
+        _ssid = ssid ? ssid : "";
+        _channel = channel ? channel : 6;
+        _status = WL_CONNECTED;
+        if (_event_cb) {
+            arduino_event_info_t info = {};
+            _event_cb(ARDUINO_EVENT_WIFI_STA_GOT_IP, info);
+        }
+        return _status;
+    }
+    bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress())
+    {
+        (void)local_ip; (void)gateway; (void)subnet; (void)dns1;
+        return true;
+    }
+    bool disconnect(bool wifioff = false) { (void)wifioff; _status = WL_DISCONNECTED; return true; }
+    int onEvent(WiFiEventFuncCb cb) { _event_cb = cb; return 0; }
+    wl_status_t status() { return _status; }
+    String SSID() { return String(_ssid.c_str()); }
+    uint8_t *BSSID() { return _bssid; }
+    int32_t channel() { return _channel; }
+    IPAddress localIP() { return IPAddress(10, 0, 2, 15); }
+    IPAddress gatewayIP() { return IPAddress(10, 0, 2, 2); }
+    IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+    IPAddress dnsIP(uint8_t dns_no = 0) { (void)dns_no; return IPAddress(10, 0, 2, 3); }
+
+private:
+    std::string _ssid;
+    wl_status_t _status = WL_DISCONNECTED;
+    int32_t _channel = 0;
+    uint8_t _bssid[6] = {0x02, 0, 0, 0, 0, 0x01};
+    WiFiEventFuncCb _event_cb = NULL;
+};
+
+extern WiFiClass WiFi;
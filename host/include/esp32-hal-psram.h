@@ -0,0 +1,9 @@
+/**
+ * @file      esp32-hal-psram.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in, pulled in by LV_MEM_CUSTOM_INCLUDE in lv_conf.h
+ */
+#pragma once
+
+#include "Arduino.h"
@@ -0,0 +1,12 @@
+/**
+ * @file      esp_attr.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in so LV_IRAM_PROFILE builds; placement attributes are no-ops
+ */
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
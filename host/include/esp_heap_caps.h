@@ -0,0 +1,9 @@
+/**
+ * @file      esp_heap_caps.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in; heap_caps_malloc() and MALLOC_CAP_* live in Arduino.h
+ */
+#pragma once
+
+#include "Arduino.h"
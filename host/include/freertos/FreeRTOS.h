@@ -0,0 +1,21 @@
+/**
+ * @file      FreeRTOS.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in, just enough for InputParams.h and LV_Helper.cpp
+ */
+#pragma once
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE             ((BaseType_t)0)
+#define pdTRUE              ((BaseType_t)1)
+#define pdFAIL              pdFALSE
+#define pdPASS              pdTRUE
+#define portMAX_DELAY       ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS  ((TickType_t)1)
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+#define pdTICKS_TO_MS(t)    ((TickType_t)(t))
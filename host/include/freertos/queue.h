@@ -0,0 +1,20 @@
+/**
+ * @file      queue.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Host stand-in. No external input queue exists on the host, so
+ *            every receive times out.
+ */
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void *QueueHandle_t;
+
+static inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait)
+{
+    (void)queue;
+    (void)item;
+    (void)wait;
+    return pdFAIL;
+}
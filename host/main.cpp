@@ -0,0 +1,170 @@
+/**
+ * @file      main.cpp
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Headless driver for the sketch in project/. Boots it against the
+ *            fixture data source, then renders every tile of the tileview
+ *            with a full-screen invalidation and reports per-tile layout and
+ *            render time and flushed pixels. Frames can be dumped as PPM/PNG and
+ *            compared with reference PPMs for pixel-diff tests.
+ *
+ *            Usage: program [--out DIR] [--png] [--ref DIR] [--tolerance PX]
+ *                           [--iterations N]
+ *
+ *            Exit status is 1 when a tile differs from its reference by more
+ *            than the tolerance (or the reference is missing), 0 otherwise.
+ */
+#include <Arduino.h>
+#include <LilyGo_AMOLED.h>
+#include <lv_mem_hybrid.h>
+#include <lvgl.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+extern LilyGo_Class amoled;
+
+// Number of loop() passes used to let fetches land and animations finish
+static const int SETTLE_FRAMES = 120;
+
+struct HarnessOptions {
+    const char *out_dir = NULL;
+    const char *ref_dir = NULL;
+    bool png = false;
+    int32_t tolerance = 0;
+    int iterations = 20;
+};
+
+static bool parse_args(int argc, char **argv, HarnessOptions &opt)
+{
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        bool has_value = i + 1 < argc;
+        if (!strcmp(a, "--out") && has_value) {
+            opt.out_dir = argv[++i];
+        } else if (!strcmp(a, "--ref") && has_value) {
+            opt.ref_dir = argv[++i];
+        } else if (!strcmp(a, "--tolerance") && has_value) {
+            opt.tolerance = atoi(argv[++i]);
+        } else if (!strcmp(a, "--iterations") && has_value) {
+            opt.iterations = std::max(1, atoi(argv[++i]));
+        } else if (!strcmp(a, "--png")) {
+            opt.png = true;
+        } else {
+            fprintf(stderr, "usage: %s [--out DIR] [--png] [--ref DIR] [--tolerance PX] [--iterations N]\n", argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void settle()
+{
+    for (int i = 0; i < SETTLE_FRAMES; i++) {
+        host_clock_advance(LV_DISP_DEF_REFR_PERIOD);
+        loop();
+    }
+}
+
+static void mark_layout_dirty(lv_obj_t *obj)
+{
+    lv_obj_mark_layout_as_dirty(obj);
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        mark_layout_dirty(lv_obj_get_child(obj, i));
+    }
+}
+
+// Full relayout of `tile` and its children; returns wall time in microseconds
+static double layout_tile(lv_obj_t *tile)
+{
+    mark_layout_dirty(tile);
+    auto start = std::chrono::steady_clock::now();
+    lv_obj_update_layout(tile);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+// Full-screen redraw of whatever is on screen; returns wall time in microseconds
+static double render_full_frame()
+{
+    lv_obj_invalidate(lv_scr_act());
+    amoled.resetFrameStats();
+    auto start = std::chrono::steady_clock::now();
+    lv_refr_now(NULL);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    HarnessOptions opt;
+    if (!parse_args(argc, argv, opt)) {
+        return 2;
+    }
+
+    setup();
+    settle();
+
+    lv_obj_t *tileview = lv_obj_get_child(lv_scr_act(), 0);
+    if (!tileview || !lv_obj_check_type(tileview, &lv_tileview_class)) {
+        fprintf(stderr, "No tileview on the active screen\n");
+        return 2;
+    }
+
+    bool failed = false;
+    uint32_t tile_count = lv_obj_get_child_cnt(tileview);
+    printf("tile,layout_us,min_us,median_us,mean_us,flushes,flushed_px,diff_px\n");
+
+    for (uint32_t t = 0; t < tile_count; t++) {
+        lv_obj_set_tile(tileview, lv_obj_get_child(tileview, t), LV_ANIM_OFF);
+        settle();
+
+        lv_obj_t *tile = lv_obj_get_child(tileview, t);
+        std::vector<double> layouts;
+        std::vector<double> samples;
+        HostFrameStats stats = {0, 0};
+        for (int i = 0; i < opt.iterations; i++) {
+            layouts.push_back(layout_tile(tile));
+            samples.push_back(render_full_frame());
+            stats = amoled.frameStats();
+        }
+        std::sort(layouts.begin(), layouts.end());
+        std::sort(samples.begin(), samples.end());
+        double sum = 0;
+        for (double s : samples) {
+            sum += s;
+        }
+
+        char path[512];
+        if (opt.out_dir) {
+            snprintf(path, sizeof(path), "%s/tile-%u.%s", opt.out_dir, (unsigned)t, opt.png ? "png" : "ppm");
+            bool ok = opt.png ? amoled.writePNG(path) : amoled.writePPM(path);
+            if (!ok) {
+                fprintf(stderr, "Failed to write %s\n", path);
+            }
+        }
+
+        int32_t diff = 0;
+        if (opt.ref_dir) {
+            snprintf(path, sizeof(path), "%s/tile-%u.ppm", opt.ref_dir, (unsigned)t);
+            diff = amoled.diffPPM(path);
+            if (diff < 0 || diff > opt.tolerance) {
+                failed = true;
+            }
+        }
+
+        printf("%u,%.1f,%.1f,%.1f,%.1f,%u,%u,%d\n", (unsigned)t, layouts[layouts.size() / 2], samples.front(),
+               samples[samples.size() / 2], sum / samples.size(),
+               stats.flushes, stats.pixels, diff);
+    }
+
+    lv_mem_hybrid_stats_t mem;
+    lv_mem_hybrid_get_stats(&mem);
+    fprintf(stderr, "LVGL arena: %u/%u bytes used (peak %u), largest free %u, %u%% fragmented; "
+            "%u small, %u small in PSRAM, %u large allocations\n",
+            (unsigned)mem.pool_used, (unsigned)mem.pool_size, (unsigned)mem.pool_peak,
+            (unsigned)mem.pool_free_biggest, (unsigned)mem.pool_frag_pct,
+            (unsigned)mem.small_allocs, (unsigned)mem.small_fallbacks, (unsigned)mem.large_allocs);
+
+    return failed ? 1 : 0;
+}
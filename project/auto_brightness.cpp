@@ -0,0 +1,87 @@
+#include "auto_brightness.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// Lowest level at which the forecast table stays readable for each light
+// level. Indoors the curve stays low, where an AMOLED saves the most; only
+// daylight drives the panel to full. Tune the points per enclosure.
+struct BrightnessPoint
+{
+  float lux;
+  uint8_t level;
+};
+static const BrightnessPoint AUTO_BRIGHTNESS_CURVE[] = {
+    {0.0f, 12},     // Dark room
+    {10.0f, 30},    // Dim hallway
+    {100.0f, 70},   // Living room
+    {500.0f, 130},  // Office
+    {2000.0f, 190}, // Overcast outdoors, window sill
+    {10000.0f, 255} // Daylight
+};
+static const int AUTO_BRIGHTNESS_POINTS = sizeof(AUTO_BRIGHTNESS_CURVE) / sizeof(AUTO_BRIGHTNESS_CURVE[0]);
+
+static float lux_to_log(float lux)
+{
+  return log2f(1.0f + (lux > 0.0f ? lux : 0.0f));
+}
+
+// Interpolates the curve linearly in log(lux)
+static uint8_t curve_at_log(float log_lux)
+{
+  if (log_lux <= lux_to_log(AUTO_BRIGHTNESS_CURVE[0].lux))
+    return AUTO_BRIGHTNESS_CURVE[0].level;
+  for (int i = 1; i < AUTO_BRIGHTNESS_POINTS; i++)
+  {
+    float hi = lux_to_log(AUTO_BRIGHTNESS_CURVE[i].lux);
+    if (log_lux <= hi)
+    {
+      float lo = lux_to_log(AUTO_BRIGHTNESS_CURVE[i - 1].lux);
+      float t = (log_lux - lo) / (hi - lo);
+      float level = AUTO_BRIGHTNESS_CURVE[i - 1].level + t * (AUTO_BRIGHTNESS_CURVE[i].level - AUTO_BRIGHTNESS_CURVE[i - 1].level);
+      return (uint8_t)(level + 0.5f);
+    }
+  }
+  return AUTO_BRIGHTNESS_CURVE[AUTO_BRIGHTNESS_POINTS - 1].level;
+}
+
+uint8_t auto_brightness_curve(float lux)
+{
+  return curve_at_log(lux_to_log(lux));
+}
+
+void auto_brightness_init(AutoBrightness &ab, uint8_t level)
+{
+  ab.primed = false;
+  ab.log_lux = 0.0f;
+  ab.level = level;
+  ab.samples = 0;
+  ab.changes = 0;
+}
+
+bool auto_brightness_update(AutoBrightness &ab, float lux, uint8_t &level)
+{
+  float sample = lux_to_log(lux);
+  if (!ab.primed)
+  {
+    ab.log_lux = sample;
+    ab.primed = true;
+  }
+  else
+  {
+    ab.log_lux += AUTO_BRIGHTNESS_ALPHA * (sample - ab.log_lux);
+  }
+  ab.samples++;
+
+  uint8_t target = curve_at_log(ab.log_lux);
+  int delta = (int)target - (int)ab.level;
+  // Outside the band, or settling on either end of the curve, which the band could otherwise hide
+  bool at_end = target == AUTO_BRIGHTNESS_CURVE[0].level || target == AUTO_BRIGHTNESS_CURVE[AUTO_BRIGHTNESS_POINTS - 1].level;
+  if (delta == 0 || (abs(delta) < AUTO_BRIGHTNESS_HYSTERESIS && !at_end))
+    return false;
+
+  ab.level = target;
+  ab.changes++;
+  level = target;
+  return true;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Ambient-light brightness loop. Lux samples are smoothed with an EMA
+ *        in the log domain (the eye responds to ratios, not differences),
+ *        mapped to a panel level through a calibrated curve, and a new level
+ *        is only reported once it leaves the hysteresis band around the
+ *        current one. The panel gets one command per real change instead of
+ *        one per sample, and a flickering light source does not make it pump.
+ */
+static const uint32_t AUTO_BRIGHTNESS_SAMPLE_MS = 1000;
+static const float AUTO_BRIGHTNESS_ALPHA = 0.25f;    // Weight of a new sample, ~4 s time constant
+static const uint8_t AUTO_BRIGHTNESS_HYSTERESIS = 8; // Panel levels, about 3% of the range
+
+struct AutoBrightness
+{
+  bool primed;      // false until the first sample
+  float log_lux;    // Filtered log2(1 + lux)
+  uint8_t level;    // Level last reported to the panel
+  uint32_t samples;
+  uint32_t changes; // Levels reported, before the battery ceiling
+};
+
+void auto_brightness_init(AutoBrightness &ab, uint8_t level);
+
+// Feeds one sample; returns true and sets `level` when the panel should change
+bool auto_brightness_update(AutoBrightness &ab, float lux, uint8_t &level);
+
+// Panel level (LCD_CMD_BRIGHTNESS, 0-255) for an ambient light level
+uint8_t auto_brightness_curve(float lux);
@@ -0,0 +1,59 @@
+#include "battery_policy.h"
+
+const BatteryTierPolicy battery_tier_policies[BATTERY_TIER_COUNT] = {
+    // name      frame  animations  fetch  prefetch  refresh                 brightness
+    {"full",     16,    true,       true,  true,     30UL * 60 * 1000,       255},
+    {"saver",    33,    false,      true,  false,    2UL * 60 * 60 * 1000,   160},
+    {"critical", 66,    false,      false, false,    0,                      80}};
+
+void battery_policy_init(BatteryPolicy &bp, const BatteryThresholds &thresholds)
+{
+  bp.thresholds = thresholds;
+  bp.primed = false;
+  bp.mv = 0.0f;
+  bp.external = true;
+  bp.tier = BATTERY_TIER_FULL;
+  bp.changes = 0;
+}
+
+// Tier for the filtered voltage; moving back up needs the hysteresis on top of the threshold
+static BatteryTier tier_for(const BatteryPolicy &bp)
+{
+  const BatteryThresholds &t = bp.thresholds;
+  float critical = t.critical_mv + (bp.tier >= BATTERY_TIER_CRITICAL ? t.hysteresis_mv : 0);
+  float saver = t.saver_mv + (bp.tier >= BATTERY_TIER_SAVER ? t.hysteresis_mv : 0);
+  if (bp.mv < critical)
+    return BATTERY_TIER_CRITICAL;
+  if (bp.mv < saver)
+    return BATTERY_TIER_SAVER;
+  return BATTERY_TIER_FULL;
+}
+
+bool battery_policy_update(BatteryPolicy &bp, uint16_t batt_mv, bool vbus_in)
+{
+  bp.external = vbus_in || batt_mv == 0;
+  if (!bp.external)
+  {
+    if (!bp.primed)
+    {
+      bp.mv = batt_mv;
+      bp.primed = true;
+    }
+    else
+    {
+      bp.mv += BATTERY_ALPHA * (batt_mv - bp.mv);
+    }
+  }
+  else
+  {
+    // Unplugging starts over from the next sample, the charger held the voltage up
+    bp.primed = false;
+  }
+
+  BatteryTier tier = bp.external ? BATTERY_TIER_FULL : tier_for(bp);
+  if (tier == bp.tier)
+    return false;
+  bp.tier = tier;
+  bp.changes++;
+  return true;
+}
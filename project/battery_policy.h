@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Battery-aware policy. The I/O task samples the PMU every
+ *        BATTERY_SAMPLE_MS; the smoothed battery voltage picks a tier, and
+ *        each tier sets the frame period, whether scrolling animates, how
+ *        eagerly data is fetched and a brightness ceiling. External power
+ *        always selects the full tier.
+ *
+ *        A tier is entered when the voltage drops below its threshold and
+ *        only left once it recovers by the hysteresis, so the load step of a
+ *        Wi-Fi fetch cannot make the policy flap. The critical tier stops
+ *        fetching altogether: a TLS handshake on a sagging cell is what
+ *        browns the board out.
+ */
+static const uint32_t BATTERY_SAMPLE_MS = 5000;
+static const float BATTERY_ALPHA = 0.3f; // Weight of a new voltage sample
+
+enum BatteryTier
+{
+  BATTERY_TIER_FULL = 0, // External power or a healthy cell
+  BATTERY_TIER_SAVER,
+  BATTERY_TIER_CRITICAL,
+  BATTERY_TIER_COUNT
+};
+
+// Thresholds, in millivolts of the smoothed battery voltage
+struct BatteryThresholds
+{
+  uint16_t saver_mv;
+  uint16_t critical_mv;
+  uint16_t hysteresis_mv;
+};
+static const BatteryThresholds BATTERY_DEFAULT_THRESHOLDS = {3700, 3500, 60};
+
+// What each tier allows
+struct BatteryTierPolicy
+{
+  const char *name;
+  uint32_t frame_period_ms; // Render task cadence and LVGL refresh period
+  bool animations;          // Scroll momentum and animated widget changes
+  bool fetch;               // Any network fetch at all
+  bool prefetch;            // Forecasts of the other cities ahead of time
+  uint32_t refresh_ms;      // Refetch the selection after this long, 0 = never
+  uint8_t max_brightness;   // Ceiling on the panel level
+};
+extern const BatteryTierPolicy battery_tier_policies[BATTERY_TIER_COUNT];
+
+struct BatteryPolicy
+{
+  BatteryThresholds thresholds;
+  bool primed;
+  float mv;         // Filtered battery voltage
+  bool external;    // USB (VBUS) present in the last sample
+  BatteryTier tier;
+  uint32_t changes; // Tier switches
+};
+
+void battery_policy_init(BatteryPolicy &bp, const BatteryThresholds &thresholds = BATTERY_DEFAULT_THRESHOLDS);
+
+// Feeds one PMU sample; returns true when the tier changed. A zero voltage (no
+// battery gauge on this board) counts as external power.
+bool battery_policy_update(BatteryPolicy &bp, uint16_t batt_mv, bool vbus_in);
+
+inline const BatteryTierPolicy &battery_policy_current(const BatteryPolicy &bp)
+{
+  return battery_tier_policies[bp.tier];
+}
@@ -0,0 +1,169 @@
+#include "forecast_table.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "weather_icons.h"
+
+static const char *getWeatherString(WeatherCondition symbol)
+{
+  switch (symbol.value)
+  {
+  case WeatherCondition::ClearSky:
+    return "Clear";
+  case WeatherCondition::NearlyClearSky:
+    return "Mostly Clear";
+  case WeatherCondition::VariableCloudiness:
+    return "Partly Cloudy";
+  case WeatherCondition::HalfClearSky:
+    return "Partly Cloudy";
+  case WeatherCondition::CloudySky:
+    return "Cloudy";
+  case WeatherCondition::Overcast:
+    return "Overcast";
+  case WeatherCondition::Fog:
+    return "Fog";
+  case WeatherCondition::LightRainShowers:
+    return "Light Rain";
+  case WeatherCondition::ModerateRainShowers:
+    return "Rain";
+  case WeatherCondition::HeavyRainShowers:
+    return "Heavy Rain";
+  case WeatherCondition::Thunderstorm:
+    return "Thunderstorm";
+  case WeatherCondition::LightSleetShowers:
+    return "Light Sleet";
+  case WeatherCondition::ModerateSleetShowers:
+    return "Sleet";
+  case WeatherCondition::HeavySleetShowers:
+    return "Heavy Sleet";
+  case WeatherCondition::LightSnowShowers:
+    return "Light Snow";
+  case WeatherCondition::ModerateSnowShowers:
+    return "Snow";
+  case WeatherCondition::HeavySnowShowers:
+    return "Heavy Snow";
+  case WeatherCondition::LightRain:
+    return "Light Rain";
+  case WeatherCondition::ModerateRain:
+    return "Rain";
+  case WeatherCondition::HeavyRain:
+    return "Heavy Rain";
+  case WeatherCondition::Thunder:
+    return "Thunder";
+  case WeatherCondition::LightSleet:
+    return "Light Sleet";
+  case WeatherCondition::ModerateSleet:
+    return "Sleet";
+  case WeatherCondition::HeavySleet:
+    return "Heavy Sleet";
+  case WeatherCondition::LightSnowfall:
+    return "Light Snow";
+  case WeatherCondition::ModerateSnowfall:
+    return "Snow";
+  case WeatherCondition::HeavySnowfall:
+    return "Heavy Snow";
+  default:
+    return "Unknown";
+  }
+}
+
+static void formatDate(const char *timestamp, char *output, size_t outputSize)
+{
+  if (strlen(timestamp) < 10)
+  {
+    snprintf(output, outputSize, "???");
+    return;
+  }
+  int year, month, day;
+  sscanf(timestamp, "%d-%d-%d", &year, &month, &day);
+  const char *monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                              "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  if (month >= 1 && month <= 12)
+  {
+    snprintf(output, outputSize, "%s %d", monthNames[month - 1], day);
+  }
+  else
+  {
+    snprintf(output, outputSize, "???");
+  }
+}
+
+void forecast_table_create(ForecastTable &table, lv_obj_t *parent, const lv_font_t *font)
+{
+  lv_obj_set_flex_flow(parent, LV_FLEX_FLOW_COLUMN);
+  lv_obj_set_flex_align(parent, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+  lv_obj_set_style_pad_row(parent, 6, 0);
+
+  table.city = nullptr;
+  table.title = lv_label_create(parent);
+  lv_label_set_text(table.title, "Forecast data: Loading...");
+  lv_obj_set_style_text_font(table.title, font, 0);
+  lv_obj_set_style_pad_bottom(table.title, 10, 0);
+
+  for (int i = 0; i < FORECAST_TABLE_DAYS; i++)
+  {
+    ForecastRow &r = table.rows[i];
+    lv_obj_t *row = lv_obj_create(parent);
+    lv_obj_remove_style_all(row);
+    lv_obj_set_size(row, 420, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_obj_set_style_pad_column(row, 12, 0);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+
+    r.icon = lv_img_create(row);
+    lv_img_set_src(r.icon, weather_icon_get(WeatherCondition::Unknown));
+    lv_obj_set_size(r.icon, WEATHER_ICON_SIZE, WEATHER_ICON_SIZE);
+
+    r.label = lv_label_create(row);
+    lv_label_set_text(r.label, "");
+    lv_obj_set_style_text_font(r.label, font, 0);
+    r.shown = false;
+  }
+}
+
+// Updates one row if `day` differs from what it shows; returns true if it did
+static bool update_row(ForecastRow &r, const ForcastHourlyWeather &day)
+{
+  int tenths = (int)lroundf(day.temperature * 10.0f);
+  if (r.shown && r.condition == day.weatherCondition.value && r.temperature_tenths == tenths &&
+      strncmp(r.date, day.time, sizeof(r.date) - 1) == 0)
+    return false;
+
+  if (!r.shown || r.condition != day.weatherCondition.value)
+    lv_img_set_src(r.icon, weather_icon_get(day.weatherCondition.value));
+
+  char dateStr[16];
+  char text[64];
+  formatDate(day.time, dateStr, sizeof(dateStr));
+  snprintf(text, sizeof(text), "%s %.1f°C %s", dateStr, tenths / 10.0f, getWeatherString(day.weatherCondition));
+  lv_label_set_text(r.label, text);
+
+  r.shown = true;
+  r.condition = day.weatherCondition.value;
+  r.temperature_tenths = tenths;
+  strncpy(r.date, day.time, sizeof(r.date) - 1);
+  r.date[sizeof(r.date) - 1] = '\0';
+  return true;
+}
+
+int forecast_table_update(ForecastTable &table, const City &city)
+{
+  if (table.city != &city)
+  {
+    char title[96];
+    snprintf(title, sizeof(title), "7-Day Forecast (12:00) in %s", city.name);
+    lv_label_set_text(table.title, title);
+    table.city = &city;
+  }
+
+  int changed = 0;
+  for (int i = 0; i < FORECAST_TABLE_DAYS; i++)
+  {
+    if (update_row(table.rows[i], city.forecast[i]))
+      changed++;
+  }
+  return changed;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include "weather_data.h"
+
+static const int FORECAST_TABLE_DAYS = 7;
+
+/**
+ * @brief One forecast day: icon plus "Aug 15 18.2°C Clear" label, and the
+ *        values it currently shows so unchanged rows are left alone.
+ */
+struct ForecastRow
+{
+  lv_obj_t *icon = nullptr;
+  lv_obj_t *label = nullptr;
+  bool shown = false;            // false until the row has displayed data
+  int condition = -1;
+  int temperature_tenths = 0;    // Temperature as displayed, in 0.1 °C
+  char date[11] = "";            // "YYYY-MM-DD" part of the forecast time
+};
+
+/**
+ * @brief Title plus one ForecastRow per day, laid out as a flex column.
+ *
+ * forecast_table_update() compares each day with what its row shows and only
+ * touches the widgets of rows that differ, so a refresh invalidates just the
+ * changed rows.
+ */
+struct ForecastTable
+{
+  lv_obj_t *title = nullptr;
+  const City *city = nullptr;    // City named in the title
+  ForecastRow rows[FORECAST_TABLE_DAYS];
+};
+
+// Builds the title and rows inside `parent` (which becomes a flex column)
+void forecast_table_create(ForecastTable &table, lv_obj_t *parent, const lv_font_t *font);
+
+// Shows the forecast of `city`; returns the number of rows that changed
+int forecast_table_update(ForecastTable &table, const City &city);
@@ -0,0 +1,182 @@
+#include "forecast_verify.h"
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <math.h>
+#include <string.h>
+
+#include "time_service.h"
+
+// One forecast temperature waiting for its observation
+struct VerifyEntry
+{
+  uint32_t target_h; // Epoch hour the forecast is for
+  uint16_t lead_h;   // Hours between issue and target
+  int16_t temp_x10;
+  uint8_t city;
+};
+
+// Stored as one blob under "verify"/"log"
+struct VerifyStore
+{
+  uint8_t version;
+  uint16_t count;
+  uint32_t last_issued_h[FORECAST_VERIFY_MAX_CITIES];
+  VerifyLeadStats stats[FORECAST_VERIFY_MAX_CITIES][FORECAST_VERIFY_LEADS];
+  VerifyEntry entries[FORECAST_VERIFY_LOG_SIZE]; // Ascending target_h
+};
+static const uint8_t VERIFY_STORE_VERSION = 1;
+
+static VerifyStore store;
+static bool store_dirty = false;
+static uint32_t pairs_joined = 0;
+static uint32_t entries_dropped = 0;
+static uint32_t flash_writes = 0;
+
+void forecast_verify_begin()
+{
+  Preferences prefs;
+  prefs.begin("verify", true);
+  bool ok = prefs.getBytesLength("log") == sizeof(store) && prefs.getBytes("log", &store, sizeof(store)) == sizeof(store);
+  prefs.end();
+  if (!ok || store.version != VERIFY_STORE_VERSION || store.count > FORECAST_VERIFY_LOG_SIZE)
+  {
+    memset(&store, 0, sizeof(store));
+    store.version = VERIFY_STORE_VERSION;
+  }
+}
+
+// Keeps the log sorted by target hour; a full log drops its oldest target
+static void insert_entry(const VerifyEntry &entry)
+{
+  if (store.count == FORECAST_VERIFY_LOG_SIZE)
+  {
+    memmove(&store.entries[0], &store.entries[1], (store.count - 1) * sizeof(VerifyEntry));
+    store.count--;
+    entries_dropped++;
+  }
+  int pos = store.count;
+  while (pos > 0 && store.entries[pos - 1].target_h > entry.target_h)
+    pos--;
+  memmove(&store.entries[pos + 1], &store.entries[pos], (store.count - pos) * sizeof(VerifyEntry));
+  store.entries[pos] = entry;
+  store.count++;
+}
+
+bool forecast_verify_snapshot(int city, int64_t issued_s, const ForcastHourlyWeather *days, int day_count)
+{
+  if (city < 0 || city >= FORECAST_VERIFY_MAX_CITIES)
+    return false;
+  uint32_t issued_h = (uint32_t)(issued_s / 3600);
+  if (store.last_issued_h[city] != 0 &&
+      (int64_t)issued_h - (int64_t)store.last_issued_h[city] < FORECAST_VERIFY_SNAPSHOT_S / 3600)
+    return false;
+
+  int logged = 0;
+  for (int i = 0; i < day_count; i++)
+  {
+    int64_t target_s;
+    if (!time_parse_iso8601(days[i].time, target_s) || target_s <= issued_s)
+      continue;
+    VerifyEntry entry = {};
+    entry.target_h = (uint32_t)(target_s / 3600);
+    entry.lead_h = (uint16_t)(entry.target_h - issued_h);
+    entry.temp_x10 = (int16_t)lroundf(days[i].temperature * 10.0f);
+    entry.city = (uint8_t)city;
+    insert_entry(entry);
+    logged++;
+  }
+  if (logged == 0)
+    return false;
+  store.last_issued_h[city] = issued_h;
+  store_dirty = true;
+  return true;
+}
+
+static void add_pair(const VerifyEntry &entry, float observed)
+{
+  int lead = (entry.lead_h + 12) / 24;
+  lead = lead < 1 ? 1 : (lead > FORECAST_VERIFY_LEADS ? FORECAST_VERIFY_LEADS : lead);
+  VerifyLeadStats &s = store.stats[entry.city][lead - 1];
+  float error = entry.temp_x10 / 10.0f - observed;
+  if (s.n < FORECAST_VERIFY_WINDOW)
+    s.n++;
+  s.bias += (error - s.bias) / s.n;
+  s.mae += (fabsf(error) - s.mae) / s.n;
+}
+
+int forecast_verify_join(int city, const HistoricalSeries &observed)
+{
+  if (city < 0 || city >= FORECAST_VERIFY_MAX_CITIES || observed.count == 0)
+    return 0;
+
+  // Both sides ascend, so the series cursor only moves forward
+  int joined = 0;
+  int j = 0;
+  int kept = 0;
+  for (int i = 0; i < store.count; i++)
+  {
+    const VerifyEntry entry = store.entries[i];
+    bool keep = true;
+    if (entry.city == city)
+    {
+      while (j < observed.count && observed.timestamps[j] / 3600000ULL < entry.target_h)
+        j++;
+      if (j < observed.count && observed.timestamps[j] / 3600000ULL == entry.target_h)
+      {
+        add_pair(entry, observed.values[j]);
+        joined++;
+        keep = false;
+      }
+      else if (j < observed.count)
+      {
+        entries_dropped++; // The station has no value for that hour
+        keep = false;
+      }
+    }
+    if (keep)
+      store.entries[kept++] = entry;
+  }
+  if (kept != store.count)
+  {
+    store.count = kept;
+    store_dirty = true;
+  }
+  pairs_joined += joined;
+  return joined;
+}
+
+void forecast_verify_save()
+{
+  if (!store_dirty)
+    return;
+  store_dirty = false;
+  Preferences prefs;
+  prefs.begin("verify", false);
+  prefs.putBytes("log", &store, sizeof(store));
+  prefs.end();
+  flash_writes++;
+}
+
+const VerifyLeadStats *forecast_verify_stats(int city)
+{
+  return store.stats[city];
+}
+
+int forecast_verify_pending(int city)
+{
+  int pending = 0;
+  for (int i = 0; i < store.count; i++)
+  {
+    if (store.entries[i].city == city)
+      pending++;
+  }
+  return pending;
+}
+
+void forecast_verify_log()
+{
+  Serial.printf("Forecast verification: %u/%u logged, %u pairs joined, %u dropped, %u flash writes\n",
+                (unsigned)store.count, (unsigned)FORECAST_VERIFY_LOG_SIZE, (unsigned)pairs_joined,
+                (unsigned)entries_dropped, (unsigned)flash_writes);
+}
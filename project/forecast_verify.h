@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "weather_data.h"
+
+/**
+ * @brief Forecast verification: how close the SMHI noon temperatures came to
+ *        what the city's station measured.
+ *
+ *        Every fetched forecast is snapshotted (at most once per city per
+ *        FORECAST_VERIFY_SNAPSHOT_S of issue time) into a log kept sorted by
+ *        target hour and stored as one Preferences blob. When the station's
+ *        temperature series arrives, the city's log entries and the series'
+ *        timestamps, both ascending, are merge-joined on the epoch hour.
+ *        Matched entries feed a rolling bias and MAE per city and lead day
+ *        and leave the log; entries whose hour the series skipped are dropped,
+ *        later ones wait for the next fetch.
+ *
+ *        Snapshot and join run in the I/O task under ui_lock(), the render
+ *        task reads the statistics under the same lock. Flash is written
+ *        separately, outside the lock.
+ */
+static const int FORECAST_VERIFY_LOG_SIZE = 256;
+static const int FORECAST_VERIFY_MAX_CITIES = 8;
+static const int FORECAST_VERIFY_LEADS = 7;                  // +1 d .. +7 d
+static const uint16_t FORECAST_VERIFY_WINDOW = 30;           // Pairs in the rolling mean
+static const int64_t FORECAST_VERIFY_SNAPSHOT_S = 12 * 3600; // Issue-time spacing per city
+
+struct VerifyLeadStats
+{
+  uint16_t n; // Pairs seen, capped at FORECAST_VERIFY_WINDOW
+  float bias; // Forecast minus observed, C
+  float mae;  // Mean absolute error, C
+};
+
+// Loads the log and statistics from flash; call once in setup()
+void forecast_verify_begin();
+
+// Logs `days` of `city`, issued at `issued_s`; false if skipped as too close to the last snapshot
+bool forecast_verify_snapshot(int city, int64_t issued_s, const ForcastHourlyWeather *days, int day_count);
+
+// Joins the logged forecasts of `city` with its observed temperatures; returns the pairs matched
+int forecast_verify_join(int city, const HistoricalSeries &observed);
+
+// Writes the log to flash if a snapshot or join changed it
+void forecast_verify_save();
+
+// FORECAST_VERIFY_LEADS entries for `city`, lead day 1 first
+const VerifyLeadStats *forecast_verify_stats(int city);
+
+// Logged forecasts of `city` still waiting for their observation
+int forecast_verify_pending(int city);
+
+// Prints log occupancy, pairs matched and entries dropped
+void forecast_verify_log();
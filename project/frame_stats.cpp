@@ -0,0 +1,101 @@
+#include "frame_stats.h"
+
+#include <Arduino.h>
+#include <lv_trace.h>
+
+#if defined(LV_IRAM_PROFILE) && LV_IRAM_PROFILE
+static const char *FRAME_STATS_PROFILE = "iram";
+#else
+static const char *FRAME_STATS_PROFILE = "flash";
+#endif
+
+static FrameStats frame_stats;
+static InputLatencyStats input_stats;
+static uint32_t frame_start_us;
+static bool input_pending = false;
+static uint32_t input_pending_us;
+
+static void render_start_cb(lv_disp_drv_t *drv)
+{
+  LV_UNUSED(drv);
+  frame_start_us = micros();
+}
+
+static void monitor_cb(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px)
+{
+  LV_UNUSED(drv);
+  LV_UNUSED(time_ms);
+  lv_trace_complete("frame", frame_start_us, (int16_t)(px / 1000), 0);
+  uint32_t us = micros() - frame_start_us;
+  uint32_t bucket = us / 1000;
+  if (bucket >= (uint32_t)FRAME_STATS_BUCKETS)
+    bucket = FRAME_STATS_BUCKETS - 1;
+  frame_stats.histogram[bucket]++;
+  frame_stats.frames++;
+  frame_stats.pixels += px;
+  if (us > frame_stats.max_us)
+    frame_stats.max_us = us;
+
+  if (input_pending)
+  {
+    input_pending = false;
+    uint32_t latency = micros() - input_pending_us;
+    uint32_t slot = latency / 1000;
+    if (slot >= (uint32_t)FRAME_STATS_BUCKETS)
+      slot = FRAME_STATS_BUCKETS - 1;
+    input_stats.histogram[slot]++;
+    input_stats.samples++;
+    if (latency > input_stats.max_us)
+      input_stats.max_us = latency;
+  }
+}
+
+void frame_stats_input_applied(uint32_t input_us)
+{
+  if (input_pending)
+    return;
+  input_pending = true;
+  input_pending_us = input_us;
+}
+
+void frame_stats_attach(lv_disp_t *disp)
+{
+  memset(&frame_stats, 0, sizeof(frame_stats));
+  disp->driver->render_start_cb = render_start_cb;
+  disp->driver->monitor_cb = monitor_cb;
+}
+
+// Upper edge, in ms, of the bucket holding the `pct` percentile
+static int percentile_ms(const uint32_t *histogram, uint32_t count, int pct)
+{
+  uint32_t target = (count * pct + 99) / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < FRAME_STATS_BUCKETS; i++)
+  {
+    seen += histogram[i];
+    if (seen >= target)
+      return i + 1;
+  }
+  return FRAME_STATS_BUCKETS;
+}
+
+void frame_stats_log()
+{
+  if (frame_stats.frames == 0)
+    return;
+  Serial.printf("Frames (%s): %u, render p50 <%d ms, p95 <%d ms, max %.1f ms, %u px/frame\n",
+                FRAME_STATS_PROFILE, (unsigned)frame_stats.frames, percentile_ms(frame_stats.histogram, frame_stats.frames, 50),
+                percentile_ms(frame_stats.histogram, frame_stats.frames, 95),
+                frame_stats.max_us / 1000.0f, (unsigned)(frame_stats.pixels / frame_stats.frames));
+  memset(&frame_stats, 0, sizeof(frame_stats));
+}
+
+void frame_stats_log_input(const char *what)
+{
+  if (input_stats.samples == 0)
+    return;
+  Serial.printf("%s latency: %u samples, p50 <%d ms, p95 <%d ms, max %.1f ms\n", what, (unsigned)input_stats.samples,
+                percentile_ms(input_stats.histogram, input_stats.samples, 50),
+                percentile_ms(input_stats.histogram, input_stats.samples, 95), input_stats.max_us / 1000.0f);
+  memset(&input_stats, 0, sizeof(input_stats));
+}
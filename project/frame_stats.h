@@ -0,0 +1,40 @@
+#pragma once
+
+#include <lvgl.h>
+
+/**
+ * @brief Per-frame render time, from the display's render_start_cb to its
+ *        monitor_cb, i.e. LVGL drawing plus flushing every invalidated area.
+ *        Used to compare build profiles on the device, e.g. the IRAM env.
+ */
+static const int FRAME_STATS_BUCKETS = 64; // 1 ms buckets, the last one collects the rest
+
+struct FrameStats
+{
+  uint32_t frames;
+  uint64_t pixels;
+  uint32_t max_us;
+  uint32_t histogram[FRAME_STATS_BUCKETS];
+};
+
+// Input-to-photon latency: from an input event to the end of the first frame
+// flushed after the UI applied it, same 1 ms buckets
+struct InputLatencyStats
+{
+  uint32_t samples;
+  uint32_t max_us;
+  uint32_t histogram[FRAME_STATS_BUCKETS];
+};
+
+// Hooks the callbacks of `disp`'s driver; call once after the display is registered
+void frame_stats_attach(lv_disp_t *disp);
+
+// Call when the UI has applied an input that arrived at `input_us` (micros());
+// the next flushed frame closes the measurement. An earlier pending input wins.
+void frame_stats_input_applied(uint32_t input_us);
+
+// Prints frame count, p50/p95/max render time and pixels per frame, then starts over
+void frame_stats_log();
+
+// Prints input-to-flush latency p50/p95/max with `what` as the label, then starts over
+void frame_stats_log_input(const char *what);
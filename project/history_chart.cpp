@@ -0,0 +1,98 @@
+#include "history_chart.h"
+
+#include <math.h>
+
+// Value drawn for data index `i`. Indices before the first sample repeat the
+// first sample so a short series still fills the window from the left.
+static lv_coord_t sample_at(const HistoricalSeries &series, int i)
+{
+  if (series.count == 0 || i >= series.count)
+    return 0;
+  float v = series.values[i < 0 ? 0 : i];
+  if (isnan(v))
+    return LV_CHART_POINT_NONE; // A gap in an aligned overlay column
+  return (lv_coord_t)v;
+}
+
+void history_chart_ring_init(HistoryChartRing &ring, lv_obj_t *chart, lv_chart_series_t *ser,
+                             lv_coord_t *points, uint16_t size)
+{
+  ring.points = points;
+  ring.size = size;
+  ring.start_point = 0;
+  ring.source = nullptr;
+  ring.source_count = 0;
+  ring.end_index = -1;
+
+  for (uint16_t i = 0; i < size; i++)
+    points[i] = LV_CHART_POINT_NONE;
+
+  lv_chart_set_point_count(chart, size);
+  lv_chart_set_ext_y_array(chart, ser, points);
+  lv_chart_set_x_start_point(chart, ser, 0);
+}
+
+static void refill(HistoryChartRing &ring, const HistoricalSeries &series, int end_index)
+{
+  int first = end_index - (ring.size - 1);
+  for (uint16_t i = 0; i < ring.size; i++)
+    ring.points[i] = sample_at(series, first + i);
+  ring.start_point = 0;
+}
+
+void history_chart_ring_show(HistoryChartRing &ring, lv_obj_t *chart, lv_chart_series_t *ser,
+                             const HistoricalSeries &series, int end_index)
+{
+  if (ring.size == 0)
+    return;
+
+  int delta = end_index - ring.end_index;
+  bool same_data = ring.source == &series && ring.source_count == series.count;
+
+  if (same_data && delta == 0)
+    return;
+
+  if (!same_data || delta >= ring.size || -delta >= ring.size)
+  {
+    refill(ring, series, end_index);
+  }
+  else if (delta > 0)
+  {
+    // Window moved right: the oldest slot takes the newest sample
+    for (int k = 1; k <= delta; k++)
+    {
+      ring.points[ring.start_point] = sample_at(series, ring.end_index + k);
+      ring.start_point = (ring.start_point + 1) % ring.size;
+    }
+  }
+  else
+  {
+    // Window moved left: the newest slot takes the sample before the oldest
+    int oldest = ring.end_index - (ring.size - 1);
+    for (int k = 1; k <= -delta; k++)
+    {
+      ring.start_point = (ring.start_point + ring.size - 1) % ring.size;
+      ring.points[ring.start_point] = sample_at(series, oldest - k);
+    }
+  }
+
+  ring.source = &series;
+  ring.source_count = series.count;
+  ring.end_index = end_index;
+
+  lv_chart_set_x_start_point(chart, ser, ring.start_point);
+  lv_obj_invalidate(chart);
+}
+
+void history_chart_ring_clear(HistoryChartRing &ring, lv_obj_t *chart, lv_chart_series_t *ser)
+{
+  for (uint16_t i = 0; i < ring.size; i++)
+    ring.points[i] = LV_CHART_POINT_NONE;
+  ring.start_point = 0;
+  ring.source = nullptr;
+  ring.source_count = 0;
+  ring.end_index = -1;
+
+  lv_chart_set_x_start_point(chart, ser, 0);
+  lv_obj_invalidate(chart);
+}
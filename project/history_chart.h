@@ -0,0 +1,36 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include "weather_data.h"
+
+/**
+ * @brief lv_coord_t ring buffer that a chart series points at through
+ *        lv_chart_set_ext_y_array().
+ *
+ * The ring holds the `size` samples that end at `end_index`. The oldest
+ * sample sits at `start_point`, which is handed to lv_chart_set_x_start_point().
+ * Moving the window by a few steps only converts the samples that scrolled in
+ * and rotates the start point; only a jump of a whole window or a different
+ * series refills the ring.
+ */
+struct HistoryChartRing
+{
+  lv_coord_t *points = nullptr;
+  uint16_t size = 0;
+  uint16_t start_point = 0;
+  const HistoricalSeries *source = nullptr;
+  int source_count = 0;
+  int end_index = -1;
+};
+
+// Binds `points` (at least `size` entries) to the series and sets the chart's point count
+void history_chart_ring_init(HistoryChartRing &ring, lv_obj_t *chart, lv_chart_series_t *ser,
+                             lv_coord_t *points, uint16_t size);
+
+// Shows the window of `series` ending at `end_index`, invalidating only the chart
+void history_chart_ring_show(HistoryChartRing &ring, lv_obj_t *chart, lv_chart_series_t *ser,
+                             const HistoricalSeries &series, int end_index);
+
+// Hides every point, e.g. while no data is loaded
+void history_chart_ring_clear(HistoryChartRing &ring, lv_obj_t *chart, lv_chart_series_t *ser);
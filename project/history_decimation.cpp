@@ -0,0 +1,218 @@
+#include "history_decimation.h"
+
+#include <Arduino.h>
+
+static const int DECIMATION_CACHE_SIZE = 4;
+
+static DecimatedView cache[DECIMATION_CACHE_SIZE];
+static uint32_t cache_clock = 0;
+
+static inline lv_coord_t to_coord(float v)
+{
+  return (lv_coord_t)v;
+}
+
+static int copy_all(const float *values, int n, lv_coord_t *out_points, int32_t *out_index)
+{
+  for (int i = 0; i < n; i++)
+  {
+    out_points[i] = to_coord(values[i]);
+    out_index[i] = i;
+  }
+  return n;
+}
+
+int decimate_lttb(const float *values, int n, int target, lv_coord_t *out_points, int32_t *out_index)
+{
+  if (target < 3)
+    target = 3;
+  if (n <= target)
+    return copy_all(values, n, out_points, out_index);
+
+  // First and last points are always kept; the rest is split in target - 2 buckets
+  float every = (float)(n - 2) / (float)(target - 2);
+  int out = 0;
+  int a = 0;
+  out_points[out] = to_coord(values[0]);
+  out_index[out++] = 0;
+
+  for (int i = 0; i < target - 2; i++)
+  {
+    // Average of the next bucket is the third triangle vertex
+    int next_start = (int)((i + 1) * every) + 1;
+    int next_end = (int)((i + 2) * every) + 1;
+    if (next_end > n)
+      next_end = n;
+    float avg_x = 0, avg_y = 0;
+    int next_len = next_end - next_start;
+    for (int j = next_start; j < next_end; j++)
+    {
+      avg_x += j;
+      avg_y += values[j];
+    }
+    if (next_len > 0)
+    {
+      avg_x /= next_len;
+      avg_y /= next_len;
+    }
+    else
+    {
+      avg_x = n - 1;
+      avg_y = values[n - 1];
+    }
+
+    // Pick the point of this bucket that spans the largest triangle
+    int start = (int)(i * every) + 1;
+    int end = (int)((i + 1) * every) + 1;
+    float ax = a, ay = values[a];
+    float max_area = -1;
+    int chosen = start;
+    for (int j = start; j < end; j++)
+    {
+      float area = fabsf((ax - avg_x) * (values[j] - ay) - (ax - j) * (avg_y - ay));
+      if (area > max_area)
+      {
+        max_area = area;
+        chosen = j;
+      }
+    }
+
+    out_points[out] = to_coord(values[chosen]);
+    out_index[out++] = chosen;
+    a = chosen;
+  }
+
+  out_points[out] = to_coord(values[n - 1]);
+  out_index[out++] = n - 1;
+  return out;
+}
+
+int decimate_minmax(const float *values, int n, int target, lv_coord_t *out_points, int32_t *out_index)
+{
+  if (target < 2)
+    target = 2;
+  if (n <= target)
+    return copy_all(values, n, out_points, out_index);
+
+  // Two points per bucket, emitted in the order they occur
+  int buckets = target / 2;
+  int out = 0;
+  for (int b = 0; b < buckets; b++)
+  {
+    int start = (int)((long)b * n / buckets);
+    int end = (int)((long)(b + 1) * n / buckets);
+    int lo = start, hi = start;
+    for (int j = start + 1; j < end; j++)
+    {
+      if (values[j] < values[lo])
+        lo = j;
+      if (values[j] > values[hi])
+        hi = j;
+    }
+    int first = lo < hi ? lo : hi;
+    int second = lo < hi ? hi : lo;
+    out_points[out] = to_coord(values[first]);
+    out_index[out++] = first;
+    if (second != first)
+    {
+      out_points[out] = to_coord(values[second]);
+      out_index[out++] = second;
+    }
+  }
+  return out;
+}
+
+bool decimation_cache_init()
+{
+  for (int i = 0; i < DECIMATION_CACHE_SIZE; i++)
+  {
+    if (cache[i].points == nullptr)
+    {
+      cache[i].points = (lv_coord_t *)ps_malloc(DECIMATION_MAX_POINTS * sizeof(lv_coord_t));
+      cache[i].index = (int32_t *)ps_malloc(DECIMATION_MAX_POINTS * sizeof(int32_t));
+    }
+    if (cache[i].points == nullptr || cache[i].index == nullptr)
+      return false;
+  }
+  return true;
+}
+
+const DecimatedView *decimation_cache_get(const HistoricalSeries &series, int first, int count,
+                                          int target, DecimationMode mode)
+{
+  if (first < 0)
+    first = 0;
+  if (first + count > series.count)
+    count = series.count - first;
+  if (count <= 0 || cache[0].points == nullptr)
+    return nullptr;
+  if (target > DECIMATION_MAX_POINTS)
+    target = DECIMATION_MAX_POINTS;
+
+  cache_clock++;
+
+  DecimatedView *victim = &cache[0];
+  for (int i = 0; i < DECIMATION_CACHE_SIZE; i++)
+  {
+    DecimatedView &v = cache[i];
+    if (v.source == &series && v.source_count == series.count && v.first == first &&
+        v.count == count && v.target == target && v.mode == mode)
+    {
+      v.last_used = cache_clock;
+      return &v;
+    }
+    if (v.last_used < victim->last_used)
+      victim = &v;
+  }
+
+  const float *values = series.values + first;
+  if (mode == DECIMATION_MINMAX)
+    victim->point_count = decimate_minmax(values, count, target, victim->points, victim->index);
+  else
+    victim->point_count = decimate_lttb(values, count, target, victim->points, victim->index);
+
+  // Indices are relative to the range; make them series indices
+  for (int i = 0; i < victim->point_count; i++)
+    victim->index[i] += first;
+
+  victim->source = &series;
+  victim->source_count = series.count;
+  victim->first = first;
+  victim->count = count;
+  victim->target = target;
+  victim->mode = mode;
+  victim->last_used = cache_clock;
+  return victim;
+}
+
+void decimation_cache_invalidate(const HistoricalSeries &series)
+{
+  for (int i = 0; i < DECIMATION_CACHE_SIZE; i++)
+  {
+    if (cache[i].source == &series)
+    {
+      cache[i].source = nullptr;
+      cache[i].last_used = 0;
+    }
+  }
+}
+
+int decimated_view_find(const DecimatedView &view, int data_index)
+{
+  if (view.point_count == 0)
+    return 0;
+
+  // First point at or after data_index, then pick the closer neighbour
+  int lo = 0, hi = view.point_count - 1;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (view.index[mid] < data_index)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo > 0 && data_index - view.index[lo - 1] < view.index[lo] - data_index)
+    return lo - 1;
+  return lo;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <lvgl.h>
+
+#include "weather_data.h"
+
+enum DecimationMode
+{
+  DECIMATION_LTTB = 0,   // Largest-Triangle-Three-Buckets, keeps the visual shape
+  DECIMATION_MINMAX = 1  // Min and max of every bucket, keeps spikes and the envelope
+};
+
+// Largest decimated view (points) the cache holds, roughly twice the chart width
+static const int DECIMATION_MAX_POINTS = 512;
+
+/**
+ * @brief A range of a HistoricalSeries reduced to chart points.
+ *
+ * `points` can be handed straight to lv_chart_set_ext_y_array(). `index[i]`
+ * is the series index that `points[i]` was taken from, in ascending order.
+ */
+struct DecimatedView
+{
+  const HistoricalSeries *source = nullptr;
+  int source_count = 0;
+  int first = 0;
+  int count = 0;
+  int target = 0;
+  DecimationMode mode = DECIMATION_LTTB;
+  lv_coord_t *points = nullptr;
+  int32_t *index = nullptr;
+  int point_count = 0;
+  uint32_t last_used = 0;
+};
+
+/**
+ * @brief  Reduce values[0..n) to at most `target` points in one pass
+ * @retval Number of points written. Equals n when n <= target.
+ */
+int decimate_lttb(const float *values, int n, int target, lv_coord_t *out_points, int32_t *out_index);
+int decimate_minmax(const float *values, int n, int target, lv_coord_t *out_points, int32_t *out_index);
+
+// Allocates the cache buffers in PSRAM
+bool decimation_cache_init();
+
+/**
+ * @brief  Decimated view of series[first, first + count) with at most `target`
+ *         points. Views are cached and only recomputed when the key or the
+ *         series length changes.
+ * @retval nullptr if the cache is not initialised or the range is empty
+ */
+const DecimatedView *decimation_cache_get(const HistoricalSeries &series, int first, int count,
+                                          int target, DecimationMode mode);
+
+// Drops every view of `series`, e.g. after it was re-fetched
+void decimation_cache_invalidate(const HistoricalSeries &series);
+
+// Point of `view` closest to series index `data_index`
+int decimated_view_find(const DecimatedView &view, int data_index);
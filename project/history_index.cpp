@@ -0,0 +1,84 @@
+#include "history_index.h"
+
+#include <Arduino.h>
+#include <math.h>
+
+bool history_index_alloc(HistoricalSeries &series)
+{
+  HistoryIndex &index = series.index;
+  const size_t entries = HistoricalSeries::MAX_HOURS + 1;
+  if (index.sums == nullptr)
+    index.sums = (double *)ps_malloc(entries * sizeof(double));
+  if (index.squares == nullptr)
+    index.squares = (double *)ps_malloc(entries * sizeof(double));
+  if (index.below == nullptr)
+    index.below = (uint16_t *)ps_malloc(entries * sizeof(uint16_t));
+  index.count = 0;
+  return index.sums != nullptr && index.squares != nullptr && index.below != nullptr;
+}
+
+void history_index_build(HistoricalSeries &series, float threshold)
+{
+  HistoryIndex &index = series.index;
+  if (index.sums == nullptr)
+    return;
+  // Centred on the first value, so a long pressure series keeps its decimals
+  index.shift = series.count > 0 ? series.values[0] : 0.0f;
+  index.threshold = threshold;
+  index.sums[0] = 0;
+  index.squares[0] = 0;
+  index.below[0] = 0;
+  index.count = 0;
+  history_index_extend(series);
+}
+
+void history_index_extend(HistoricalSeries &series)
+{
+  HistoryIndex &index = series.index;
+  if (index.sums == nullptr)
+    return;
+  for (int i = index.count; i < series.count; i++)
+  {
+    double x = series.values[i] - index.shift;
+    index.sums[i + 1] = index.sums[i] + x;
+    index.squares[i + 1] = index.squares[i] + x * x;
+    index.below[i + 1] = index.below[i] + (series.values[i] < index.threshold ? 1 : 0);
+  }
+  index.count = series.count;
+}
+
+bool history_index_query(const HistoricalSeries &series, int first, int last, HistoryRange &out)
+{
+  const HistoryIndex &index = series.index;
+  if (first < 0)
+    first = 0;
+  if (last >= index.count)
+    last = index.count - 1;
+  if (index.sums == nullptr || last < first)
+    return false;
+
+  int n = last - first + 1;
+  double sum = index.sums[last + 1] - index.sums[first];
+  double squares = index.squares[last + 1] - index.squares[first];
+  double mean = sum / n;
+  double variance = squares / n - mean * mean;
+  out.count = n;
+  out.mean = (float)(mean + index.shift);
+  out.stddev = variance > 0 ? (float)sqrt(variance) : 0.0f;
+  out.below = index.below[last + 1] - index.below[first];
+  return true;
+}
+
+int history_index_find(const HistoricalSeries &series, unsigned long long timestamp_ms)
+{
+  int lo = 0, hi = series.count;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (series.timestamps[mid] < timestamp_ms)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
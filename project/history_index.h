@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "weather_data.h"
+
+/**
+ * @brief Constant-time range aggregates over a HistoricalSeries.
+ *
+ * The series' HistoryIndex keeps prefix sums of the values, of their
+ * squares and of the number of values under a threshold. Built once at
+ * ingest, in the I/O task next to the parse, it answers the mean, spread or
+ * threshold count of any index range with two lookups. Appended samples only
+ * extend the prefixes; a new threshold or replaced data needs a rebuild.
+ *
+ * The arrays take (8 + 8 + 2) * (MAX_HOURS + 1) bytes of PSRAM per series.
+ */
+struct HistoryRange
+{
+  int count = 0;
+  float mean = 0;
+  float stddev = 0;
+  int below = 0; // Samples under the index threshold
+};
+
+// Allocates the prefix arrays of `series` in PSRAM
+bool history_index_alloc(HistoricalSeries &series);
+
+// Indexes values[0, count) from scratch with a new threshold
+void history_index_build(HistoricalSeries &series, float threshold);
+
+// Folds in values appended since the last build or extend
+void history_index_extend(HistoricalSeries &series);
+
+/**
+ * @brief  Aggregates of values[first, last]
+ * @retval false if the range is empty or not indexed yet
+ */
+bool history_index_query(const HistoricalSeries &series, int first, int last, HistoryRange &out);
+
+// First index whose timestamp is at or after `timestamp_ms`; `count` if none
+int history_index_find(const HistoricalSeries &series, unsigned long long timestamp_ms);
@@ -0,0 +1,156 @@
+#include "history_overlay.h"
+
+#include <Arduino.h>
+#include <math.h>
+
+struct OverlayColumn
+{
+  const HistoricalSeries *source = nullptr;
+  int source_count = -1; // -1 forces a full join
+  float scale = 1.0f;
+  float offset = 0.0f;
+  int cursor = 0;    // Series index the join continues from
+  int rows_done = 0; // Rows before this one are final
+  HistoricalSeries aligned;
+};
+
+static const HistoricalSeries *primary = nullptr;
+static int primary_count = 0;
+static OverlayColumn columns[HISTORY_OVERLAY_COLUMNS];
+static int column_count = 0;
+static uint32_t rows_joined = 0;
+static uint32_t full_joins = 0;
+
+bool history_overlay_init()
+{
+  for (int i = 0; i < HISTORY_OVERLAY_COLUMNS; i++)
+  {
+    if (columns[i].aligned.values == nullptr)
+      columns[i].aligned.values = (float *)ps_malloc(HistoricalSeries::MAX_HOURS * sizeof(float));
+    if (columns[i].aligned.values == nullptr)
+      return false;
+  }
+  return true;
+}
+
+static void column_reset(OverlayColumn &c)
+{
+  c.cursor = 0;
+  c.rows_done = 0;
+  c.source_count = c.source ? c.source->count : -1;
+  full_joins++;
+}
+
+bool history_overlay_bind(const HistoricalSeries &series_primary, const HistoricalSeries *const *series,
+                          const float *scale, const float *offset, int count)
+{
+  if (columns[HISTORY_OVERLAY_COLUMNS - 1].aligned.values == nullptr)
+    return false;
+  if (count > HISTORY_OVERLAY_COLUMNS)
+    count = HISTORY_OVERLAY_COLUMNS;
+  // A grown primary is handled by history_overlay_update()
+  bool same_primary = primary == &series_primary;
+  if (!same_primary)
+  {
+    primary = &series_primary;
+    primary_count = series_primary.count;
+  }
+  column_count = count;
+
+  for (int i = 0; i < count; i++)
+  {
+    OverlayColumn &c = columns[i];
+    bool same = same_primary && c.source == series[i] && c.source_count >= 0 && c.scale == scale[i] &&
+                c.offset == offset[i];
+    c.source = series[i];
+    c.scale = scale[i];
+    c.offset = offset[i];
+    c.aligned.timestamps = series_primary.timestamps;
+    c.aligned.isLoaded = true;
+    if (!same)
+      c.source_count = -1;
+  }
+  return true;
+}
+
+// Merge join of one column from its first unresolved row
+static bool column_join(OverlayColumn &c)
+{
+  const HistoricalSeries &s = *c.source;
+  if (c.source_count != s.count)
+  {
+    // A grown series resumes where it stopped; anything else starts over
+    if (c.source_count < 0 || s.count < c.source_count)
+      column_reset(c);
+    c.source_count = s.count;
+  }
+
+  int first = c.rows_done;
+  for (int r = c.rows_done; r < primary->count; r++)
+  {
+    unsigned long long hour = primary->timestamps[r] / 3600000ULL;
+    while (c.cursor < s.count && s.timestamps[c.cursor] / 3600000ULL < hour)
+      c.cursor++;
+    if (c.cursor == s.count)
+    {
+      // Past the end of the series: blank for now, joined again once it grows
+      for (int rest = r; rest < primary->count; rest++)
+        c.aligned.values[rest] = NAN;
+      break;
+    }
+    if (s.timestamps[c.cursor] / 3600000ULL == hour)
+      c.aligned.values[r] = s.values[c.cursor] * c.scale + c.offset;
+    else
+      c.aligned.values[r] = NAN; // The station skipped this hour
+    c.rows_done = r + 1;
+  }
+  c.aligned.count = primary->count;
+  rows_joined += c.rows_done - first;
+  return c.rows_done != first;
+}
+
+bool history_overlay_update()
+{
+  if (primary == nullptr)
+    return false;
+  if (primary_count != primary->count)
+  {
+    // Rows only get appended, unless the primary was replaced
+    for (int i = 0; i < column_count; i++)
+    {
+      if (primary->count < primary_count)
+        columns[i].source_count = -1;
+    }
+    primary_count = primary->count;
+  }
+
+  bool changed = false;
+  for (int i = 0; i < column_count; i++)
+  {
+    OverlayColumn &c = columns[i];
+    bool reset = c.source_count < 0;
+    if (column_join(c) || reset)
+      changed = true;
+  }
+  return changed;
+}
+
+const HistoricalSeries &history_overlay_column(int column)
+{
+  return columns[column].aligned;
+}
+
+void history_overlay_invalidate(const HistoricalSeries &series)
+{
+  for (int i = 0; i < HISTORY_OVERLAY_COLUMNS; i++)
+  {
+    if (columns[i].source == &series || primary == &series)
+      columns[i].source_count = -1;
+  }
+}
+
+void history_overlay_log()
+{
+  Serial.printf("History overlay: %d series, %u rows joined, %u full joins\n", column_count, (unsigned)rows_joined,
+                (unsigned)full_joins);
+}
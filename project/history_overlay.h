@@ -0,0 +1,48 @@
+#pragma once
+
+#include "weather_data.h"
+
+/**
+ * @brief Other parameters of a station aligned to the selected one, for the
+ *        history chart's overlay mode.
+ *
+ * Rows are the primary series' samples. Every bound series gets a column of
+ * PSRAM floats holding its value at each row's hour, already mapped to chart
+ * coordinates with value * scale + offset, or NAN where the station has no
+ * value. Columns are filled by a merge join: both sides are sorted by time,
+ * so each series is walked once. A later update only joins rows that became
+ * resolvable, i.e. rows past the end of the series it stopped at, or rows the
+ * primary gained; a re-fetched series (history_overlay_invalidate) is joined
+ * again from the start.
+ *
+ * Each column is exposed as a HistoricalSeries view over the primary's
+ * timestamps, so HistoryChartRing scrolls it like the primary series.
+ */
+static const int HISTORY_OVERLAY_MAX = 4; // Series in one overlay, the primary included
+static const int HISTORY_OVERLAY_COLUMNS = HISTORY_OVERLAY_MAX - 1;
+
+// Allocates the column buffers in PSRAM
+bool history_overlay_init();
+
+/**
+ * @brief  Aligns `series[0, count)` to `primary`. Columns whose series and
+ *         mapping did not change keep their joined rows.
+ * @retval false if the columns could not be allocated
+ */
+bool history_overlay_bind(const HistoricalSeries &primary, const HistoricalSeries *const *series, const float *scale,
+                          const float *offset, int count);
+
+/**
+ * @brief  Joins the rows that became resolvable since the last call
+ * @retval true if any column changed
+ */
+bool history_overlay_update();
+
+// Aligned view of column `column`; values are chart coordinates or NAN
+const HistoricalSeries &history_overlay_column(int column);
+
+// Forces a full join of every column that uses `series`, e.g. after it was re-fetched
+void history_overlay_invalidate(const HistoricalSeries &series);
+
+// Prints rows joined and full joins
+void history_overlay_log();
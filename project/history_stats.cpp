@@ -0,0 +1,313 @@
+#include "history_stats.h"
+
+#include <Arduino.h>
+#include <math.h>
+#include <string.h>
+
+static const uint16_t WINDOW_MASK = HISTORY_STATS_WINDOW_MAX - 1;
+static const int PERIOD_CACHE_SIZE = 4;
+
+// Whole-period state of one series
+struct PeriodEntry
+{
+  const HistoricalSeries *source = nullptr;
+  int count = 0;
+  float lo = 0; // Sketch range, the series' min and max when it was built
+  float hi = 0;
+  float min = 0;
+  float max = 0;
+  double mean = 0;
+  double m2 = 0;
+  uint16_t bins[HISTORY_STATS_SKETCH_BINS];
+  HistoryStatsSummary summary;
+  uint32_t last_used = 0;
+};
+
+static PeriodEntry period_cache[PERIOD_CACHE_SIZE];
+static uint32_t period_clock = 0;
+static uint32_t period_builds = 0;
+static uint32_t period_extends = 0;
+static uint32_t period_hits = 0;
+
+// --- Window ---
+
+static float sorted_percentile(const float *sorted, int n, float p)
+{
+  float pos = p * (n - 1);
+  int i = (int)pos;
+  if (i >= n - 1)
+    return sorted[n - 1];
+  return sorted[i] + (sorted[i + 1] - sorted[i]) * (pos - i);
+}
+
+// First position in sorted[0, n) whose value is not below `x`
+static int lower_bound(const float *sorted, int n, float x)
+{
+  int lo = 0, hi = n;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (sorted[mid] < x)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+static void window_push(WindowStats &w, const float *values, int i)
+{
+  float x = values[i];
+  while (w.max_tail != w.max_head && values[w.max_q[(uint16_t)(w.max_tail - 1) & WINDOW_MASK]] <= x)
+    w.max_tail--;
+  w.max_q[w.max_tail++ & WINDOW_MASK] = i;
+  while (w.min_tail != w.min_head && values[w.min_q[(uint16_t)(w.min_tail - 1) & WINDOW_MASK]] >= x)
+    w.min_tail--;
+  w.min_q[w.min_tail++ & WINDOW_MASK] = i;
+
+  w.n++;
+  double d = x - w.mean;
+  w.mean += d / w.n;
+  w.m2 += d * (x - w.mean);
+
+  int pos = lower_bound(w.sorted, w.n - 1, x);
+  memmove(&w.sorted[pos + 1], &w.sorted[pos], (w.n - 1 - pos) * sizeof(float));
+  w.sorted[pos] = x;
+}
+
+// Removes the oldest sample, which is series index `i`
+static void window_pop(WindowStats &w, const float *values, int i)
+{
+  float x = values[i];
+  if (w.max_q[w.max_head & WINDOW_MASK] == i)
+    w.max_head++;
+  if (w.min_q[w.min_head & WINDOW_MASK] == i)
+    w.min_head++;
+
+  w.n--;
+  if (w.n == 0)
+  {
+    w.mean = 0;
+    w.m2 = 0;
+  }
+  else
+  {
+    double d = x - w.mean;
+    w.mean -= d / w.n;
+    w.m2 -= d * (x - w.mean);
+    if (w.m2 < 0)
+      w.m2 = 0; // Rounding after many removals
+  }
+
+  int pos = lower_bound(w.sorted, w.n + 1, x);
+  memmove(&w.sorted[pos], &w.sorted[pos + 1], (w.n - pos) * sizeof(float));
+}
+
+static void window_clear(WindowStats &w)
+{
+  w.max_head = w.max_tail = 0;
+  w.min_head = w.min_tail = 0;
+  w.mean = 0;
+  w.m2 = 0;
+  w.n = 0;
+}
+
+void window_stats_reset(WindowStats &stats)
+{
+  window_clear(stats);
+  stats.source = nullptr;
+  stats.last = -1;
+}
+
+void window_stats_move(WindowStats &stats, const HistoricalSeries &series, int first, int last)
+{
+  if (last >= series.count)
+    last = series.count - 1;
+  if (last - first + 1 > HISTORY_STATS_WINDOW_MAX)
+    first = last - HISTORY_STATS_WINDOW_MAX + 1;
+  if (first < 0)
+    first = 0;
+
+  bool follows = stats.source == &series && stats.source_count == series.count && stats.n > 0 &&
+                 first >= stats.first && last >= stats.last && first <= stats.last + 1;
+  if (follows)
+  {
+    for (int i = stats.first; i < first; i++)
+      window_pop(stats, series.values, i);
+    for (int i = stats.last + 1; i <= last; i++)
+      window_push(stats, series.values, i);
+    stats.slides += last - stats.last;
+  }
+  else
+  {
+    window_clear(stats);
+    for (int i = first; i <= last; i++)
+      window_push(stats, series.values, i);
+    stats.refills++;
+  }
+  stats.source = &series;
+  stats.source_count = series.count;
+  stats.first = first;
+  stats.last = last;
+}
+
+void window_stats_summary(const WindowStats &stats, HistoryStatsSummary &out)
+{
+  out.count = stats.n;
+  if (stats.n == 0)
+    return;
+  const float *values = stats.source->values;
+  out.min = values[stats.min_q[stats.min_head & WINDOW_MASK]];
+  out.max = values[stats.max_q[stats.max_head & WINDOW_MASK]];
+  out.mean = (float)stats.mean;
+  out.stddev = (float)sqrt(stats.m2 / stats.n);
+  out.p10 = sorted_percentile(stats.sorted, stats.n, 0.10f);
+  out.p50 = sorted_percentile(stats.sorted, stats.n, 0.50f);
+  out.p90 = sorted_percentile(stats.sorted, stats.n, 0.90f);
+}
+
+// --- Whole period ---
+
+static int sketch_bin(const PeriodEntry &e, float x)
+{
+  int bin = (int)((x - e.lo) / (e.hi - e.lo) * HISTORY_STATS_SKETCH_BINS);
+  if (bin < 0)
+    return 0;
+  return bin < HISTORY_STATS_SKETCH_BINS ? bin : HISTORY_STATS_SKETCH_BINS - 1;
+}
+
+// Value below which a fraction `p` of the samples lie, interpolated inside its bin
+static float sketch_percentile(const PeriodEntry &e, float p)
+{
+  float target = p * e.count;
+  float width = (e.hi - e.lo) / HISTORY_STATS_SKETCH_BINS;
+  uint32_t below = 0;
+  for (int b = 0; b < HISTORY_STATS_SKETCH_BINS; b++)
+  {
+    if (below + e.bins[b] >= target && e.bins[b] > 0)
+    {
+      float v = e.lo + (b + (target - below) / e.bins[b]) * width;
+      return v < e.min ? e.min : (v > e.max ? e.max : v);
+    }
+    below += e.bins[b];
+  }
+  return e.max;
+}
+
+static void period_fold(PeriodEntry &e, const HistoricalSeries &series, int from)
+{
+  for (int i = from; i < series.count; i++)
+  {
+    float x = series.values[i];
+    e.count++;
+    double d = x - e.mean;
+    e.mean += d / e.count;
+    e.m2 += d * (x - e.mean);
+    if (x < e.min)
+      e.min = x;
+    if (x > e.max)
+      e.max = x;
+    e.bins[sketch_bin(e, x)]++;
+  }
+}
+
+static void period_build(PeriodEntry &e, const HistoricalSeries &series)
+{
+  e.lo = e.hi = series.values[0];
+  for (int i = 1; i < series.count; i++)
+  {
+    float x = series.values[i];
+    if (x < e.lo)
+      e.lo = x;
+    if (x > e.hi)
+      e.hi = x;
+  }
+  if (e.hi <= e.lo)
+    e.hi = e.lo + 1.0f;
+  e.min = e.lo;
+  e.max = e.lo;
+  e.count = 0;
+  e.mean = 0;
+  e.m2 = 0;
+  memset(e.bins, 0, sizeof(e.bins));
+  period_fold(e, series, 0);
+  period_builds++;
+}
+
+// True if series[from, count) fits the entry's sketch range
+static bool period_fits(const PeriodEntry &e, const HistoricalSeries &series, int from)
+{
+  for (int i = from; i < series.count; i++)
+  {
+    if (series.values[i] < e.lo || series.values[i] > e.hi)
+      return false;
+  }
+  return true;
+}
+
+const HistoryStatsSummary *history_stats_period(const HistoricalSeries &series)
+{
+  if (series.count <= 0)
+    return nullptr;
+  period_clock++;
+
+  PeriodEntry *entry = nullptr;
+  PeriodEntry *victim = &period_cache[0];
+  for (int i = 0; i < PERIOD_CACHE_SIZE; i++)
+  {
+    if (period_cache[i].source == &series)
+      entry = &period_cache[i];
+    if (period_cache[i].last_used < victim->last_used)
+      victim = &period_cache[i];
+  }
+
+  if (entry && entry->count == series.count)
+  {
+    entry->last_used = period_clock;
+    period_hits++;
+    return &entry->summary;
+  }
+  if (entry && entry->count < series.count && period_fits(*entry, series, entry->count))
+  {
+    period_fold(*entry, series, entry->count);
+    period_extends++;
+  }
+  else
+  {
+    if (!entry)
+      entry = victim;
+    entry->source = &series;
+    period_build(*entry, series);
+  }
+  entry->last_used = period_clock;
+
+  HistoryStatsSummary &s = entry->summary;
+  s.count = entry->count;
+  s.min = entry->min;
+  s.max = entry->max;
+  s.mean = (float)entry->mean;
+  s.stddev = (float)sqrt(entry->m2 / entry->count);
+  s.p10 = sketch_percentile(*entry, 0.10f);
+  s.p50 = sketch_percentile(*entry, 0.50f);
+  s.p90 = sketch_percentile(*entry, 0.90f);
+  return &s;
+}
+
+void history_stats_invalidate(const HistoricalSeries &series)
+{
+  for (int i = 0; i < PERIOD_CACHE_SIZE; i++)
+  {
+    if (period_cache[i].source == &series)
+    {
+      period_cache[i].source = nullptr;
+      period_cache[i].last_used = 0;
+    }
+  }
+}
+
+void history_stats_log(const WindowStats &window)
+{
+  Serial.printf("History stats: window %u samples slid in, %u refills; period %u builds, %u extended, %u cached\n",
+                (unsigned)window.slides, (unsigned)window.refills, (unsigned)period_builds,
+                (unsigned)period_extends, (unsigned)period_hits);
+}
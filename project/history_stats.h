@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "weather_data.h"
+
+/**
+ * @brief Summary statistics of a HistoricalSeries, for the slider's window
+ *        and for the whole period.
+ *
+ * WindowStats follows a window [first, last] that mostly moves by a few
+ * samples at a time. Min and max come from monotonic index deques, mean and
+ * variance from Welford's update with removal, and percentiles from a sorted
+ * copy of the window. Sliding forward costs O(1) amortized per sample; a jump
+ * back or across more than a window refills it.
+ *
+ * Whole-period statistics are kept per series in a small cache. Percentiles
+ * come from a fixed-size histogram sketch spanning the series' range, so they
+ * are approximate to a fraction of a bin. Samples appended to a cached series
+ * are folded in; only a new range or a re-fetch (history_stats_invalidate)
+ * costs a full pass.
+ */
+static const int HISTORY_STATS_WINDOW_MAX = 64;  // Power of two, largest window
+static const int HISTORY_STATS_SKETCH_BINS = 128;
+
+struct HistoryStatsSummary
+{
+  int count = 0;
+  float min = 0;
+  float max = 0;
+  float mean = 0;
+  float stddev = 0;
+  float p10 = 0;
+  float p50 = 0;
+  float p90 = 0;
+};
+
+struct WindowStats
+{
+  const HistoricalSeries *source = nullptr;
+  int source_count = 0;
+  int first = 0;
+  int last = -1;
+  // Series indices; values decrease (max) or increase (min) from head to tail
+  int32_t max_q[HISTORY_STATS_WINDOW_MAX];
+  int32_t min_q[HISTORY_STATS_WINDOW_MAX];
+  uint16_t max_head = 0, max_tail = 0;
+  uint16_t min_head = 0, min_tail = 0;
+  double mean = 0;
+  double m2 = 0;
+  float sorted[HISTORY_STATS_WINDOW_MAX];
+  int n = 0;
+  uint32_t slides = 0;  // Samples moved in incrementally
+  uint32_t refills = 0; // Windows rebuilt from scratch
+};
+
+// Points `stats` at series[first, last]; at most HISTORY_STATS_WINDOW_MAX samples
+void window_stats_move(WindowStats &stats, const HistoricalSeries &series, int first, int last);
+
+// Forgets the window, so the next move refills it; call when the series' data was replaced
+void window_stats_reset(WindowStats &stats);
+
+void window_stats_summary(const WindowStats &stats, HistoryStatsSummary &out);
+
+/**
+ * @brief  Whole-period statistics of `series`, computed on first use and
+ *         extended when the series grew since.
+ * @retval nullptr if the series is empty
+ */
+const HistoryStatsSummary *history_stats_period(const HistoricalSeries &series);
+
+// Drops the cached statistics of `series`, e.g. after it was re-fetched
+void history_stats_invalidate(const HistoricalSeries &series);
+
+// Prints window slides and refills and period cache builds, extensions and hits
+void history_stats_log(const WindowStats &window);
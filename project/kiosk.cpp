@@ -0,0 +1,203 @@
+#include "kiosk.h"
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <math.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "time_service.h"
+#include "ui_task.h"
+
+#if UI_RENDER_TASK
+#include <esp_sleep.h>
+#endif
+
+// Rough board current for the estimate in kiosk_log(): panel lit and module active, and
+// deep sleep with the touch controller and PMU still powered
+static const float KIOSK_MA_AWAKE = 110.0f;
+static const float KIOSK_MA_ASLEEP = 0.5f;
+
+static const uint32_t KIOSK_SNAPSHOT_MAGIC = 0x4B534B00 | (KIOSK_HISTORY_HOURS & 0xFF);
+static const char *kiosk_wake_names[] = {"cold boot", "timer", "touch"};
+
+// Lives in RTC slow memory: kept through deep sleep, reset by a power cycle
+struct KioskSnapshot
+{
+  uint32_t magic;
+  uint8_t city;
+  uint8_t param;
+  bool has_forecast;
+  int64_t fetched_at; // Wall clock seconds of the newest fetch
+  ForcastHourlyWeather forecast[7];
+  int16_t count;
+  unsigned long long base_ts;             // Timestamp of the first kept sample, ms
+  uint32_t offset_s[KIOSK_HISTORY_HOURS]; // Seconds after base_ts
+  int16_t value_x10[KIOSK_HISTORY_HOURS];
+};
+
+struct KioskStats
+{
+  uint32_t wakes;
+  uint64_t awake_ms;
+  uint64_t asleep_ms;
+  int64_t slept_at_us; // Wall clock when the last sleep began, 0 if never
+};
+
+RTC_DATA_ATTR static KioskSnapshot snapshot;
+RTC_DATA_ATTR static KioskStats stats;
+
+static KioskWake wake = KIOSK_WAKE_COLD;
+static int64_t fetched_at = 0;
+static bool have_data = false;
+static uint32_t frame_us = 0;
+
+static int64_t wall_us()
+{
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+KioskWake kiosk_begin()
+{
+  wake = KIOSK_WAKE_COLD;
+#if UI_RENDER_TASK
+  // The system clock runs on the RTC timer through deep sleep, so wall_us() keeps counting
+  esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+  if (cause == ESP_SLEEP_WAKEUP_TIMER)
+    wake = KIOSK_WAKE_TIMER;
+  else if (cause == ESP_SLEEP_WAKEUP_EXT0)
+    wake = KIOSK_WAKE_TOUCH;
+#endif
+  if (wake == KIOSK_WAKE_COLD || snapshot.magic != KIOSK_SNAPSHOT_MAGIC)
+  {
+    wake = KIOSK_WAKE_COLD;
+    memset(&stats, 0, sizeof(stats));
+    return wake;
+  }
+
+  stats.wakes++;
+  int64_t slept_us = wall_us() - stats.slept_at_us;
+  if (stats.slept_at_us != 0 && slept_us > 0)
+    stats.asleep_ms += slept_us / 1000;
+  return wake;
+}
+
+bool kiosk_restore(City *cities, int city_count, int param_count, int &city, int &param)
+{
+  if (wake == KIOSK_WAKE_COLD || snapshot.city >= city_count || snapshot.param >= param_count)
+    return false;
+
+  fetched_at = snapshot.fetched_at;
+  have_data = true;
+  // Stale data is drawn all the same, but left marked unloaded so the I/O task refetches it
+  bool fresh = !kiosk_refresh_due();
+
+  City &target = cities[snapshot.city];
+  if (snapshot.has_forecast)
+  {
+    memcpy(target.forecast, snapshot.forecast, sizeof(target.forecast));
+    target.loaded_forcast = fresh;
+  }
+
+  HistoricalSeries &series = target.history[snapshot.param];
+  if (snapshot.count > 0 && series.values && series.timestamps)
+  {
+    for (int i = 0; i < snapshot.count; i++)
+    {
+      series.values[i] = snapshot.value_x10[i] / 10.0f;
+      series.timestamps[i] = snapshot.base_ts + snapshot.offset_s[i] * 1000ULL;
+    }
+    series.count = snapshot.count;
+    series.isLoaded = true;
+    target.loaded_historical[snapshot.param] = fresh;
+  }
+
+  city = snapshot.city;
+  param = snapshot.param;
+  return true;
+}
+
+bool kiosk_refresh_due()
+{
+  return !have_data || time(nullptr) - fetched_at >= (int64_t)KIOSK_REFRESH_S;
+}
+
+void kiosk_data_fetched()
+{
+  // Before SNTP or a running RTC the clock reads near 1970; the next fetch stamps it instead
+  if (time_service_valid())
+    fetched_at = time(nullptr);
+  have_data = true;
+}
+
+void kiosk_frame_shown()
+{
+  if (frame_us == 0)
+    frame_us = micros();
+}
+
+bool kiosk_should_sleep(uint32_t inactive_ms, bool refresh_pending)
+{
+  if (!KIOSK_MODE || inactive_ms < KIOSK_AWAKE_MS)
+    return false;
+  return !refresh_pending || millis() >= KIOSK_MAX_AWAKE_MS;
+}
+
+void kiosk_save(const City &city, int city_index, int param_index)
+{
+  const HistoricalSeries &series = city.history[param_index];
+  bool has_history = city.loaded_historical[param_index] && series.count > 0;
+  if (!city.loaded_forcast && !has_history)
+    return; // Nothing worth keeping, the previous snapshot stays
+
+  snapshot.city = (uint8_t)city_index;
+  snapshot.param = (uint8_t)param_index;
+  snapshot.has_forecast = city.loaded_forcast;
+  if (city.loaded_forcast)
+    memcpy(snapshot.forecast, city.forecast, sizeof(snapshot.forecast));
+  snapshot.fetched_at = fetched_at;
+
+  // Newest hours only; tenths fit every parameter (pressure tops out near 1100 hPa)
+  int count = has_history ? series.count : 0;
+  int first = count > KIOSK_HISTORY_HOURS ? count - KIOSK_HISTORY_HOURS : 0;
+  snapshot.count = (int16_t)(count - first);
+  snapshot.base_ts = count ? series.timestamps[first] : 0;
+  for (int i = first; i < count; i++)
+  {
+    float v = series.values[i] * 10.0f;
+    v = v > 32767.0f ? 32767.0f : (v < -32768.0f ? -32768.0f : v);
+    snapshot.value_x10[i - first] = (int16_t)lroundf(v);
+    snapshot.offset_s[i - first] = (uint32_t)((series.timestamps[i] - snapshot.base_ts) / 1000ULL);
+  }
+  snapshot.magic = KIOSK_SNAPSHOT_MAGIC;
+}
+
+void kiosk_sleep(int touch_irq_pin)
+{
+  stats.awake_ms += millis();
+  stats.slept_at_us = wall_us();
+#if UI_RENDER_TASK
+  esp_sleep_enable_timer_wakeup((uint64_t)KIOSK_WAKE_INTERVAL_S * 1000000ULL);
+  if (touch_irq_pin >= 0 && esp_sleep_is_valid_wakeup_gpio((gpio_num_t)touch_irq_pin))
+    esp_sleep_enable_ext0_wakeup((gpio_num_t)touch_irq_pin, 0);
+  esp_deep_sleep_start();
+#else
+  (void)touch_irq_pin;
+#endif
+}
+
+void kiosk_log()
+{
+  uint64_t awake = stats.awake_ms + millis();
+  uint64_t total = awake + stats.asleep_ms;
+  float duty = total ? (float)awake / (float)total : 1.0f;
+  float ma = duty * KIOSK_MA_AWAKE + (1.0f - duty) * KIOSK_MA_ASLEEP;
+  Serial.printf("Kiosk: wake %u (%s), first frame %.1f ms after boot, data %lld s old; "
+                "awake %.2f%% of %llu s, ~%.2f mA average board estimate\n",
+                (unsigned)stats.wakes, kiosk_wake_names[wake], frame_us / 1000.0f,
+                have_data ? (long long)(time(nullptr) - fetched_at) : -1LL,
+                duty * 100.0f, (unsigned long long)(total / 1000), ma);
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "weather_data.h"
+
+/**
+ * @brief Scheduled deep-sleep kiosk mode (build with -DKIOSK_MODE=1). The
+ *        board sleeps with the panel off and wakes on the RTC timer every
+ *        KIOSK_WAKE_INTERVAL_S or when the touch controller pulls its IRQ low.
+ *
+ *        Before sleeping, the selected city's forecast and the newest
+ *        KIOSK_HISTORY_HOURS of the selected series are packed into RTC
+ *        memory, which survives deep sleep. On wake they are restored before
+ *        the first frame, so the tiles redraw without waiting for Wi-Fi; data
+ *        older than KIOSK_REFRESH_S is refetched in the background. The board
+ *        goes back to sleep KIOSK_AWAKE_MS after the last touch.
+ *
+ *        A power cycle clears RTC memory, the first boot then fetches as usual.
+ */
+#ifndef KIOSK_MODE
+#define KIOSK_MODE 0
+#endif
+
+static const uint32_t KIOSK_WAKE_INTERVAL_S = 15 * 60;
+static const uint32_t KIOSK_REFRESH_S = 60 * 60;     // Older snapshots are refetched after a wake
+static const uint32_t KIOSK_AWAKE_MS = 10000;        // Stay on this long after the last touch
+static const uint32_t KIOSK_MAX_AWAKE_MS = 60000;    // Give up on a refresh that does not finish
+static const int KIOSK_HISTORY_HOURS = 480;          // 20 days, 6 bytes each in RTC memory
+
+enum KioskWake
+{
+  KIOSK_WAKE_COLD = 0, // Power on or reset, no snapshot
+  KIOSK_WAKE_TIMER,
+  KIOSK_WAKE_TOUCH
+};
+
+// Reads the wake cause and the time spent asleep; call once, first thing in setup()
+KioskWake kiosk_begin();
+
+// Copies the snapshot into `city`/its selected series and sets the selection.
+// False after a cold boot or if the snapshot is invalid.
+bool kiosk_restore(City *cities, int city_count, int param_count, int &city, int &param);
+
+// True if the restored data is older than KIOSK_REFRESH_S (or there was none)
+bool kiosk_refresh_due();
+
+// Fresh data arrived for the selection, it counts from now
+void kiosk_data_fetched();
+
+// First frame after the wake is on the panel; records wake-to-frame latency
+void kiosk_frame_shown();
+
+// True once the board may go back to sleep: no touch for KIOSK_AWAKE_MS and no refresh pending
+bool kiosk_should_sleep(uint32_t inactive_ms, bool refresh_pending);
+
+// Packs the selection into RTC memory
+void kiosk_save(const City &city, int city_index, int param_index);
+
+// Arms the timer and touch wake and enters deep sleep; never returns on the device
+void kiosk_sleep(int touch_irq_pin);
+
+// Prints wake cause, wake-to-frame latency, duty cycle and the estimated average current
+void kiosk_log();
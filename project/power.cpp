@@ -0,0 +1,139 @@
+#include "power.h"
+
+#include <Arduino.h>
+
+#include "ui_task.h"
+
+#if UI_RENDER_TASK
+#include <WiFi.h>
+#include <esp_pm.h>
+#include <freertos/FreeRTOS.h>
+#endif
+
+static const char *power_mode_names[] = {"off", "dfs", "dfs+light sleep"};
+// Rough ESP32-S3 module current for the estimate in power_log(), panel and PMU not included
+static const float POWER_MA_BUSY = 45.0f;                  // 240 MHz, Wi-Fi in modem sleep
+static const float POWER_MA_IDLE[] = {30.0f, 18.0f, 2.0f}; // Waiting at 240 MHz, at 80 MHz, in light sleep
+
+static PowerMode power_mode = POWER_MODE_NONE;
+
+// Busy residency over the current log window
+static int busy_holders = 0;
+static uint32_t busy_since_us;
+static uint64_t busy_us = 0;
+static uint32_t window_start_us;
+
+static uint32_t wakes = 0;
+static uint64_t wake_sum_us = 0;
+static uint32_t wake_max_us = 0;
+
+#if UI_RENDER_TASK
+static esp_pm_lock_handle_t busy_lock;
+static portMUX_TYPE busy_mux = portMUX_INITIALIZER_UNLOCKED;
+
+PowerMode power_begin()
+{
+  window_start_us = micros();
+#if CONFIG_IDF_TARGET_ESP32S3
+  esp_pm_config_esp32s3_t config = {};
+#else
+  esp_pm_config_esp32_t config = {};
+#endif
+  config.max_freq_mhz = POWER_CPU_MAX_MHZ;
+  config.min_freq_mhz = POWER_CPU_MIN_MHZ;
+  config.light_sleep_enable = true;
+
+  // Light sleep needs tickless idle in the SDK config; fall back to frequency scaling alone
+  power_mode = POWER_MODE_LIGHT_SLEEP;
+  if (esp_pm_configure(&config) != ESP_OK)
+  {
+    config.light_sleep_enable = false;
+    power_mode = POWER_MODE_DFS;
+    if (esp_pm_configure(&config) != ESP_OK)
+    {
+      power_mode = POWER_MODE_NONE;
+      return power_mode;
+    }
+  }
+  if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "busy", &busy_lock) != ESP_OK)
+    busy_lock = nullptr;
+
+  // Modem sleep keeps the association and wakes for beacons only
+  WiFi.setSleep(true);
+  return power_mode;
+}
+
+void power_busy_begin()
+{
+  if (busy_lock)
+    esp_pm_lock_acquire(busy_lock);
+  portENTER_CRITICAL(&busy_mux);
+  if (busy_holders++ == 0)
+    busy_since_us = micros();
+  portEXIT_CRITICAL(&busy_mux);
+}
+
+void power_busy_end()
+{
+  portENTER_CRITICAL(&busy_mux);
+  if (--busy_holders == 0)
+    busy_us += micros() - busy_since_us;
+  portEXIT_CRITICAL(&busy_mux);
+  if (busy_lock)
+    esp_pm_lock_release(busy_lock);
+}
+#else
+PowerMode power_begin()
+{
+  window_start_us = micros();
+  return power_mode;
+}
+
+void power_busy_begin() {}
+void power_busy_end() {}
+#endif
+
+void power_record_wake(uint32_t latency_us)
+{
+  wakes++;
+  wake_sum_us += latency_us;
+  if (latency_us > wake_max_us)
+    wake_max_us = latency_us;
+}
+
+void power_log()
+{
+  // Snapshot and restart the window in one go, the I/O task updates it on the other core
+#if UI_RENDER_TASK
+  portENTER_CRITICAL(&busy_mux);
+#endif
+  uint32_t now = micros();
+  uint32_t window_us = now - window_start_us;
+  uint64_t busy = busy_us;
+  if (busy_holders > 0)
+    busy += now - busy_since_us;
+  if (window_us != 0)
+  {
+    window_start_us = now;
+    busy_us = 0;
+    if (busy_holders > 0)
+      busy_since_us = now;
+  }
+#if UI_RENDER_TASK
+  portEXIT_CRITICAL(&busy_mux);
+#endif
+  if (window_us == 0)
+    return;
+  if (busy > window_us)
+    busy = window_us;
+
+  float busy_frac = (float)busy / (float)window_us;
+  float ma = busy_frac * POWER_MA_BUSY + (1.0f - busy_frac) * POWER_MA_IDLE[power_mode];
+  Serial.printf("Power (%s): busy %.1f%%, ~%.1f mA module estimate; %u wakes, latency avg %.2f ms, max %.2f ms\n",
+                power_mode_names[power_mode], busy_frac * 100.0f, ma, (unsigned)wakes,
+                wakes ? wake_sum_us / 1000.0f / wakes : 0.0f, wake_max_us / 1000.0f);
+
+  wakes = 0;
+  wake_sum_us = 0;
+  wake_max_us = 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Idle power management. power_begin() turns on esp_pm dynamic
+ *        frequency scaling (POWER_CPU_MAX_MHZ..POWER_CPU_MIN_MHZ) and, when
+ *        the SDK was built with tickless idle, automatic light sleep. Wi-Fi
+ *        stays associated in modem sleep and the touch IRQ wakes the chip.
+ *
+ *        Work that must run at full speed (rendering, TLS) holds
+ *        power_busy_begin()/power_busy_end(); everything else lets the
+ *        governor drop the clock or sleep until the next deadline.
+ *
+ *        On the host every function is a no-op.
+ */
+static const int POWER_CPU_MAX_MHZ = 240;
+static const int POWER_CPU_MIN_MHZ = 80; // Lowest clock Wi-Fi keeps working at
+
+enum PowerMode
+{
+  POWER_MODE_NONE = 0,  // esp_pm not available in this SDK build
+  POWER_MODE_DFS,       // Frequency scaling only
+  POWER_MODE_LIGHT_SLEEP // Frequency scaling plus automatic light sleep
+};
+
+PowerMode power_begin();
+
+// Counting, may be nested and used from any task; time with at least one holder counts as busy
+void power_busy_begin();
+void power_busy_end();
+
+// Time from a wake reason (message, touch) to the render task running again
+void power_record_wake(uint32_t latency_us);
+
+// Prints mode, busy/idle residency, estimated module current and wake latency, then starts over
+void power_log();
@@ -6,9 +6,29 @@
 #include <Preferences.h>
 #include <TFT_eSPI.h>
 #include <WiFi.h>
+#include <boot_timeline.h>
+#include <lv_mem_hybrid.h>
+#include <lv_trace.h>
 #include <lvgl.h>
 #include <time.h>
 
+#include "auto_brightness.h"
+#include "battery_policy.h"
+#include "forecast_table.h"
+#include "forecast_verify.h"
+#include "frame_stats.h"
+#include "history_chart.h"
+#include "history_decimation.h"
+#include "history_index.h"
+#include "history_overlay.h"
+#include "history_stats.h"
+#include "kiosk.h"
+#include "power.h"
+#include "time_service.h"
+#include "ui_task.h"
+#include "weather_data.h"
+#include "wifi_fast.h"
+
 // Wi-Fi credentials
 static const char *WIFI_SSID = "";
 static const char *WIFI_PASSWORD = "";
@@ -21,9 +41,10 @@ static lv_obj_t *t1; // Forecast (Screen 2)
 static lv_obj_t *t2; // Historical (Screen 3)
 static lv_obj_t *t3; // Settings
 static lv_obj_t *t4; // Wifi
+static lv_obj_t *t5; // Forecast verification
 
 static lv_obj_t *t0_label;
-static lv_obj_t *t1_label;
+static ForecastTable forecast_table; // 7-day rows on t1
 
 // --- HISTORICAL DATA WIDGETS (For t2) ---
 static lv_obj_t *history_chart;
@@ -33,198 +54,140 @@ static lv_obj_t *history_location_label; // Shows the selected city name
 static lv_obj_t *history_info_label;     // Shows parameter and value
 static lv_obj_t *history_datetime_label; // Shows the date/time of the slider position
 static const int CHART_WINDOW_SIZE = 24; // Show 24 hours at a time
+static lv_coord_t history_points[CHART_WINDOW_SIZE]; // Chart reads these directly
+static HistoryChartRing history_ring;
 
-static lv_obj_t *t4_label;
-
-// track Wi-Fi connection
-static bool wifi_was_connected = false;
-static unsigned long last_wifi_update = 0;
-bool ui_updated = true;
-
-Preferences preferences;
-
-// --- WEATHER STRUCTURES (Unchanged) ---
-struct WeatherCondition
-{
-  enum Value : int
-  {
-    Unknown = 0,
-    ClearSky = 1,
-    NearlyClearSky = 2,
-    VariableCloudiness = 3,
-    HalfClearSky = 4,
-    CloudySky = 5,
-    Overcast = 6,
-    Fog = 7,
-    LightRainShowers = 8,
-    ModerateRainShowers = 9,
-    HeavyRainShowers = 10,
-    Thunderstorm = 11,
-    LightSleetShowers = 12,
-    ModerateSleetShowers = 13,
-    HeavySleetShowers = 14,
-    LightSnowShowers = 15,
-    ModerateSnowShowers = 16,
-    HeavySnowShowers = 17,
-    LightRain = 18,
-    ModerateRain = 19,
-    HeavyRain = 20,
-    Thunder = 21,
-    LightSleet = 22,
-    ModerateSleet = 23,
-    HeavySleet = 24,
-    LightSnowfall = 25,
-    ModerateSnowfall = 26,
-    HeavySnowfall = 27
-  };
-  Value value;
-  WeatherCondition() = default;
-  WeatherCondition(int code) { value = static_cast<Value>(code); }
+// Chart modes: a 24 h window that follows the slider, the whole period
+// decimated to the chart width with a cursor at the slider position, or the
+// 24 h window with the city's other parameters on the secondary axis
+enum HistoryViewMode
+{
+  HISTORY_VIEW_WINDOW = 0,
+  HISTORY_VIEW_ALL_LTTB,
+  HISTORY_VIEW_ALL_MINMAX,
+  HISTORY_VIEW_OVERLAY,
+  HISTORY_VIEW_MODE_COUNT
 };
+static const char *history_view_mode_names[HISTORY_VIEW_MODE_COUNT] = {"24 h", "All", "Min/Max", "Overlay"};
+static int history_view_mode = HISTORY_VIEW_WINDOW;
+static const DecimatedView *history_view = nullptr; // Whole-period points, owned by the decimation cache
+static lv_chart_cursor_t *history_cursor;
+static lv_obj_t *history_mode_btn;
+static lv_obj_t *history_mode_label;
+
+// Overlay mode: columns of the history overlay join, scrolled like history_ring
+static const uint32_t history_overlay_colors[HISTORY_OVERLAY_COLUMNS] = {0x4CAF50, 0xFF9800, 0x9C27B0}; // Green, orange, purple
+static lv_chart_series_t *history_overlay_series[HISTORY_OVERLAY_COLUMNS];
+static lv_coord_t history_overlay_points[HISTORY_OVERLAY_COLUMNS][CHART_WINDOW_SIZE];
+static HistoryChartRing history_overlay_rings[HISTORY_OVERLAY_COLUMNS];
+static int history_overlay_shown = 0;
+static lv_obj_t *history_legend_label;                // Overlaid parameters and their ranges, above the chart
+static volatile bool history_overlay_wanted = false; // Set by the render task, the I/O task fetches the other parameters
+
+// Min/max/mean/spread of the 24 h window (left of the chart) and the whole period (under the mode button)
+static WindowStats history_window_stats;
+static lv_obj_t *history_window_stats_label;
+static lv_obj_t *history_period_stats_label;
+static lv_obj_t *history_range_label; // Last 7 and 30 days up to the slider, from the prefix index
+
+// Slider drags emit many VALUE_CHANGED events per frame; only the last one is drawn
+static int history_scrub_pending = -1;     // Slider index waiting for the next frame, -1 if none
+static uint32_t history_scrub_since_us;    // micros() the oldest touch sample not drawn yet was read
+static uint32_t history_scrub_events = 0;
+static uint32_t history_scrub_updates = 0;
 
-const char *getWeatherSymbol(WeatherCondition symbol)
-{
-  switch (symbol.value)
-  {
-  case WeatherCondition::ClearSky:
-  case WeatherCondition::NearlyClearSky:
-    return "☀";
-  case WeatherCondition::VariableCloudiness:
-  case WeatherCondition::HalfClearSky:
-    return "⛅";
-  case WeatherCondition::CloudySky:
-  case WeatherCondition::Overcast:
-    return "☁";
-  case WeatherCondition::Fog:
-    return "🌫";
-  case WeatherCondition::LightRainShowers:
-  case WeatherCondition::ModerateRainShowers:
-  case WeatherCondition::LightRain:
-  case WeatherCondition::ModerateRain:
-    return "🌧";
-  case WeatherCondition::HeavyRainShowers:
-  case WeatherCondition::HeavyRain:
-    return "⛈";
-  case WeatherCondition::Thunderstorm:
-  case WeatherCondition::Thunder:
-    return "⚡";
-  case WeatherCondition::LightSleetShowers:
-  case WeatherCondition::ModerateSleetShowers:
-  case WeatherCondition::HeavySleetShowers:
-  case WeatherCondition::LightSleet:
-  case WeatherCondition::ModerateSleet:
-  case WeatherCondition::HeavySleet:
-    return "🌨";
-  case WeatherCondition::LightSnowShowers:
-  case WeatherCondition::ModerateSnowShowers:
-  case WeatherCondition::HeavySnowShowers:
-  case WeatherCondition::LightSnowfall:
-  case WeatherCondition::ModerateSnowfall:
-  case WeatherCondition::HeavySnowfall:
-    return "❄";
-  default:
-    return "?";
-  }
-}
-
-const char *getWeatherString(WeatherCondition symbol)
-{
-  switch (symbol.value)
-  {
-  case WeatherCondition::ClearSky:
-    return "Clear";
-  case WeatherCondition::NearlyClearSky:
-    return "Mostly Clear";
-  case WeatherCondition::VariableCloudiness:
-    return "Partly Cloudy";
-  case WeatherCondition::HalfClearSky:
-    return "Partly Cloudy";
-  case WeatherCondition::CloudySky:
-    return "Cloudy";
-  case WeatherCondition::Overcast:
-    return "Overcast";
-  case WeatherCondition::Fog:
-    return "Fog";
-  case WeatherCondition::LightRainShowers:
-    return "Light Rain";
-  case WeatherCondition::ModerateRainShowers:
-    return "Rain";
-  case WeatherCondition::HeavyRainShowers:
-    return "Heavy Rain";
-  case WeatherCondition::Thunderstorm:
-    return "Thunderstorm";
-  case WeatherCondition::LightSleetShowers:
-    return "Light Sleet";
-  case WeatherCondition::ModerateSleetShowers:
-    return "Sleet";
-  case WeatherCondition::HeavySleetShowers:
-    return "Heavy Sleet";
-  case WeatherCondition::LightSnowShowers:
-    return "Light Snow";
-  case WeatherCondition::ModerateSnowShowers:
-    return "Snow";
-  case WeatherCondition::HeavySnowShowers:
-    return "Heavy Snow";
-  case WeatherCondition::LightRain:
-    return "Light Rain";
-  case WeatherCondition::ModerateRain:
-    return "Rain";
-  case WeatherCondition::HeavyRain:
-    return "Heavy Rain";
-  case WeatherCondition::Thunder:
-    return "Thunder";
-  case WeatherCondition::LightSleet:
-    return "Light Sleet";
-  case WeatherCondition::ModerateSleet:
-    return "Sleet";
-  case WeatherCondition::HeavySleet:
-    return "Heavy Sleet";
-  case WeatherCondition::LightSnowfall:
-    return "Light Snow";
-  case WeatherCondition::ModerateSnowfall:
-    return "Snow";
-  case WeatherCondition::HeavySnowfall:
-    return "Heavy Snow";
-  default:
-    return "Unknown";
-  }
-}
-
-const int FORCAST_TIMESTAMP_SIZE = 20;
-
-struct ForcastHourlyWeather
-{
-  float temperature;
-  char time[FORCAST_TIMESTAMP_SIZE + 1];
-  WeatherCondition weatherCondition;
+static lv_obj_t *t4_label;
+static char wifi_status_text[64] = "Wi-Fi: Connecting..."; // Kept while t4 is torn down
+
+// --- FORECAST VERIFICATION WIDGETS (For t5) ---
+static lv_obj_t *verify_title_label;
+static lv_obj_t *verify_table; // Lead day, bias, MAE and pairs
+static lv_obj_t *verify_pending_label;
+
+static bool wifi_started = false; // Set once by setup() or the I/O task
+static const uint32_t IO_POLL_MS = 500;
+
+// Ambient light, sampled by the I/O task; the panel command is sent by the
+// render task, which owns the display bus
+static AutoBrightness auto_brightness;
+static unsigned long last_lux_sample = 0;
+static float last_lux = 0.0f;
+static uint8_t brightness_wanted;        // Before the battery ceiling
+static uint8_t brightness_posted;        // After the ceiling, last level handed to the render task
+static uint32_t brightness_commands = 0; // Panel commands sent by the render task
+
+// PMU state, sampled by the I/O task; the render task applies the frame and
+// animation side of the tier
+static BatteryPolicy battery_policy;
+static unsigned long last_battery_sample = 0;
+static unsigned long last_refresh = 0; // Last fetch of the selection
+static bool ui_animations = true;      // Render task copy of the tier's setting
+
+// --- UI INVALIDATION ---
+// Every data tile has a dirty bit. A dirty tile is rebuilt only while some of
+// it is on screen; off-screen tiles wait until they scroll into view, so
+// repeated fetches or setting changes collapse into a single rebuild.
+enum UiTile
+{
+  UI_TILE_FORECAST = 0,
+  UI_TILE_HISTORY,
+  UI_TILE_SETTINGS,
+  UI_TILE_VERIFY,
+  UI_TILE_COUNT
 };
+static const uint8_t UI_DIRTY_ALL = (1 << UI_TILE_COUNT) - 1;
+static const char *ui_tile_names[UI_TILE_COUNT] = {"forecast", "history", "settings", "verify"};
 
-struct Parameter
+// Work done and avoided per tile, logged every UI_STATS_LOG_MS
+struct UiTileStats
 {
-  const char *label;
-  const char *apiCode;
+  uint32_t rebuilds;  // Tile updates that ran
+  uint32_t deferred;  // Updates postponed because the tile was off screen
+  uint32_t coalesced; // Invalidations merged into an already pending update
 };
-
-struct HistoricalSeries
+static const unsigned long UI_STATS_LOG_MS = 60000;
+static uint8_t ui_dirty = UI_DIRTY_ALL;
+static uint8_t ui_deferred = 0; // Dirty tiles already counted as deferred
+static UiTileStats ui_stats[UI_TILE_COUNT];
+static uint32_t forecast_rows_changed = 0;
+static uint32_t forecast_rows_skipped = 0;
+static unsigned long last_ui_stats_log = 0;
+
+// --- LAZY TILES ---
+// At boot only the tileview and its empty tiles exist. A tile's widgets are
+// built the first time any of it scrolls into view. Settings, Wi-Fi and
+// verification are rarely open, so when the LVGL arena runs low they are
+// cleaned again once they have been off screen for UI_PAGE_IDLE_MS, and rebuilt
+// on the next visit.
+enum UiPage
 {
-  static constexpr int MAX_HOURS = 4000;
-  float *values = nullptr;
-  unsigned long long *timestamps = nullptr;
-  int count = 0;
-  bool isLoaded = false;
+  UI_PAGE_BOOT = 0,
+  UI_PAGE_FORECAST,
+  UI_PAGE_HISTORY,
+  UI_PAGE_SETTINGS,
+  UI_PAGE_WIFI,
+  UI_PAGE_VERIFY,
+  UI_PAGE_COUNT
 };
+static const char *ui_page_names[UI_PAGE_COUNT] = {"boot", "forecast", "history", "settings", "wifi", "verify"};
+static const int ui_tile_pages[UI_TILE_COUNT] = {UI_PAGE_FORECAST, UI_PAGE_HISTORY, UI_PAGE_SETTINGS, UI_PAGE_VERIFY};
 
-struct City
+struct UiPageState
 {
-  const char *name;
-  const char *lat;
-  const char *lon;
-  const char *stationID;
-  ForcastHourlyWeather forecast[7];
-  HistoricalSeries history[4];
-  bool loaded_forcast;
-  bool loaded_historical[4];
+  bool built;
+  bool recyclable;          // May be torn down under memory pressure
+  unsigned long last_shown; // millis() when it was last the active tile
+  uint32_t builds;
+  uint32_t teardowns;
+  uint32_t build_us; // Duration of the last build
 };
+static UiPageState ui_pages[UI_PAGE_COUNT] = {
+    {false, false}, {false, false}, {false, false}, {false, true}, {false, true}, {false, true}};
+static const uint32_t UI_PAGE_RECLAIM_FREE = 4096; // Largest free arena block that counts as pressure
+static const unsigned long UI_PAGE_IDLE_MS = 30000;
+static int ui_page_active = UI_PAGE_BOOT;
+
+Preferences preferences;
 
 static City cities[] = {
     {"Karlskrona", "56.16156", "15.58661", "65090"},
@@ -242,6 +205,18 @@ static Parameter parameters[] = {{"Temperture", "1"},
 
 static const int PARAM_COUNT = sizeof(parameters) / sizeof(parameters[0]);
 
+// Threshold each parameter's history index counts, and how the tile words the count
+struct HistoryThreshold
+{
+  float value;
+  bool above; // Show the hours at or above the threshold instead of below
+  const char *text;
+};
+static const HistoryThreshold history_thresholds[] = {{0.0f, false, "h below 0°C"},
+                                                      {90.0f, true, "h at 90%+"},
+                                                      {10.0f, true, "h at 10 m/s+"},
+                                                      {1000.0f, false, "h below 1000"}};
+
 // current selcetions (indices)
 static int selectedCityIndex = 0;
 static int selectedParamIndex = 0;
@@ -253,87 +228,66 @@ static lv_obj_t *btn_save_default;
 static lv_obj_t *btn_reset_defaults;
 static lv_obj_t *settings_status_label;
 
+// Shared by the history and settings tiles, initialised on the first build
+static lv_style_t style_text_large;     // Button and dropdown text
+static lv_style_t style_dropdown_clean; // Dropdown button border and background
+static lv_style_t style_dropdown_list;  // Opened dropdown list
+static bool tile_styles_ready = false;
+
 static void apply_tile_colors(lv_obj_t *tile)
 {
   lv_obj_set_style_bg_opa(tile, LV_OPA_COVER, 0);
   lv_obj_set_style_bg_color(tile, lv_color_white(), 0);
 }
 
-static void update_wifi_status()
+// Wi-Fi event task: posts a UI_MSG_WIFI_STATUS whenever the connection comes up or
+// goes down, and wakes the I/O task so fetches start without waiting for its next poll
+static void wifi_status_changed(bool connected)
 {
-  wl_status_t current_status = WiFi.status();
-
-  if (current_status == WL_CONNECTED && !wifi_was_connected)
+  UiMsg msg = {};
+  msg.type = UI_MSG_WIFI_STATUS;
+  msg.wifi.connected = connected;
+  if (connected)
   {
     IPAddress ip = WiFi.localIP();
-    char buf[64];
-    snprintf(buf, sizeof(buf), "Wi-Fi: %s\nIP: %d.%d.%d.%d",
-             WiFi.SSID().c_str(), ip[0], ip[1], ip[2], ip[3]);
-    lv_label_set_text(t4_label, buf);
-    lv_obj_center(t4_label);
-    wifi_was_connected = true;
-  }
-  else if (current_status != WL_CONNECTED && wifi_was_connected)
-  {
-    lv_label_set_text(t4_label, "Wi-Fi: Connecting...");
-    lv_obj_center(t4_label);
-    wifi_was_connected = false;
+    for (int i = 0; i < 4; i++)
+      msg.wifi.ip[i] = ip[i];
+    strncpy(msg.wifi.ssid, WiFi.SSID().c_str(), sizeof(msg.wifi.ssid) - 1);
   }
+  ui_post(msg);
+  if (connected)
+    ui_io_wake();
 }
 
-// Helper to format timestamp string into "YYYY-MM-DD HH:00"
-void formatTimestamp(unsigned long long timestamp, char *output, size_t outputSize)
+static void wifi_start()
 {
-    // 1. Basic Validation: If timestamp is 0, consider it empty
-    if (timestamp == 0) { 
-        snprintf(output, outputSize, "No Data"); 
-        return; 
-    }
-
-    
-    timestamp = timestamp / 1000; 
-
-    // 2. Convert integer to time_t (standard C time type)
-    time_t rawTime = (time_t)timestamp;
-
-    // 3. Convert time_t to a struct tm (broken-down time: year, month, etc.)
-    // We use gmtime for UTC to match your previous "Z" (Zulu/UTC) logic.
-    // If you have configured the ESP32 timezone and want local time, use localtime(&rawTime) instead.
-    struct tm *timeInfo = gmtime(&rawTime);
-
-    if (timeInfo == nullptr) {
-        snprintf(output, outputSize, "Invalid Time");
-        return;
-    }
+  wifi_started = true;
+  Serial.printf("Connecting to WiFi SSID: %s\n", WIFI_SSID);
+  wifi_fast_begin(WIFI_SSID, WIFI_PASSWORD, wifi_status_changed);
+}
 
-    // 4. Format the output
-    // tm_year is years since 1900, tm_mon is 0-11
-    snprintf(output, outputSize, "%04d-%02d-%02d %02d:00", 
-             timeInfo->tm_year + 1900, 
-             timeInfo->tm_mon + 1, 
-             timeInfo->tm_mday, 
-             timeInfo->tm_hour);
+static void show_wifi_status(const UiMsg &msg)
+{
+  if (msg.wifi.connected)
+    snprintf(wifi_status_text, sizeof(wifi_status_text), "Wi-Fi: %s\nIP: %d.%d.%d.%d",
+             msg.wifi.ssid, msg.wifi.ip[0], msg.wifi.ip[1], msg.wifi.ip[2], msg.wifi.ip[3]);
+  else
+    snprintf(wifi_status_text, sizeof(wifi_status_text), "Wi-Fi: Connecting...");
+  if (!t4_label)
+    return;
+  lv_label_set_text(t4_label, wifi_status_text);
+  lv_obj_center(t4_label);
 }
 
-void formatDate(const char *timestamp, char *output, size_t outputSize)
+// Helper to format timestamp string into "YYYY-MM-DD HH:00", local time
+void formatTimestamp(unsigned long long timestamp, char *output, size_t outputSize)
 {
-  if (strlen(timestamp) < 10)
+  if (timestamp == 0)
   {
-    snprintf(output, outputSize, "???");
+    snprintf(output, outputSize, "No Data");
     return;
   }
-  int year, month, day;
-  sscanf(timestamp, "%d-%d-%d", &year, &month, &day);
-  const char *monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
-                              "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
-  if (month >= 1 && month <= 12)
-  {
-    snprintf(output, outputSize, "%s %d", monthNames[month - 1], day);
-  }
-  else
-  {
-    snprintf(output, outputSize, "???");
-  }
+  time_format_hour(timestamp, output, outputSize);
 }
 
 bool is_it_twelve(const char time[])
@@ -347,14 +301,13 @@ bool is_it_twelve(const char time[])
   return true;
 }
 
-// --- Set Chart Range Dynamically ---
-void set_chart_range_by_parameter(int param_index)
-{
-  int min_val, max_val;
-  int tick_count = 5;
+// Y-axis label area for 4-digit numbers (e.g., 1050)
+static const int Y_TICK_LENGTH = 60;
 
-  // Y-axis label area for 4-digit numbers (e.g., 1050)
-  const int Y_TICK_LENGTH = 60;
+// Chart range and major tick count of a parameter
+static void parameter_range(int param_index, int &min_val, int &max_val, int &tick_count)
+{
+  tick_count = 5;
 
   if (param_index == 0)
   { // Temperture (C)
@@ -383,6 +336,13 @@ void set_chart_range_by_parameter(int param_index)
     min_val = 0;
     max_val = 100; // Default safe range
   }
+}
+
+// --- Set Chart Range Dynamically ---
+void set_chart_range_by_parameter(int param_index)
+{
+  int min_val, max_val, tick_count;
+  parameter_range(param_index, min_val, max_val, tick_count);
 
   lv_chart_set_range(history_chart, LV_CHART_AXIS_PRIMARY_Y, min_val, max_val);
 
@@ -390,6 +350,68 @@ void set_chart_range_by_parameter(int param_index)
   lv_chart_set_axis_tick(history_chart, LV_CHART_AXIS_PRIMARY_Y, 10, 5, tick_count, 2, true, Y_TICK_LENGTH);
 }
 
+// "<title>\nmin ..\nmax .." with one statistic per line
+static void format_history_stats(char *buf, size_t size, const char *title, const HistoryStatsSummary &s)
+{
+  snprintf(buf, size, "%s\nmin %.1f\nmax %.1f\nmean %.1f\nsd %.1f\np10 %.1f\np50 %.1f\np90 %.1f", title, s.min,
+           s.max, s.mean, s.stddev, s.p10, s.p50, s.p90);
+}
+
+// Whole-period block; the statistics are cached, so this only formats text
+static void show_period_stats(const HistoricalSeries &series)
+{
+  const HistoryStatsSummary *period = history_stats_period(series);
+  if (!period)
+  {
+    lv_label_set_text(history_period_stats_label, "");
+    return;
+  }
+  char title[24];
+  snprintf(title, sizeof(title), "All %d d", (period->count + 23) / 24);
+  char buf[128];
+  format_history_stats(buf, sizeof(buf), title, *period);
+  lv_label_set_text(history_period_stats_label, buf);
+}
+
+// Window block for the samples the 24 h chart shows, ending at `slider_index`
+static void show_window_stats(const HistoricalSeries &series, int slider_index)
+{
+  window_stats_move(history_window_stats, series, slider_index - (CHART_WINDOW_SIZE - 1), slider_index);
+  HistoryStatsSummary window;
+  window_stats_summary(history_window_stats, window);
+  char title[24];
+  snprintf(title, sizeof(title), "Last %d h", window.count);
+  char buf[128];
+  format_history_stats(buf, sizeof(buf), title, window);
+  lv_label_set_text(history_window_stats_label, buf);
+}
+
+// Aggregates of the `days` days up to and including series index `last`
+static bool history_days_ending_at(const HistoricalSeries &series, int last, int days, HistoryRange &out)
+{
+  unsigned long long span_ms = days * 86400000ULL;
+  unsigned long long at = series.timestamps[last];
+  int first = at >= span_ms ? history_index_find(series, at - span_ms + 1) : 0;
+  return history_index_query(series, first, last, out);
+}
+
+// Week mean and the month's threshold hours, two prefix lookups each
+static void show_range_summary(const HistoricalSeries &series, int slider_index)
+{
+  const HistoryThreshold &threshold = history_thresholds[selectedParamIndex];
+  HistoryRange week, month;
+  if (!history_days_ending_at(series, slider_index, 7, week) ||
+      !history_days_ending_at(series, slider_index, 30, month))
+  {
+    lv_label_set_text(history_range_label, "");
+    return;
+  }
+  int hours = threshold.above ? month.count - month.below : month.below;
+  char buf[96];
+  snprintf(buf, sizeof(buf), "7 d mean %.1f sd %.1f\n30 d: %d %s", week.mean, week.stddev, hours, threshold.text);
+  lv_label_set_text(history_range_label, buf);
+}
+
 // --- LOGIC FOR HISTORY SCROLLING ---
 /**
  * @brief Updates the chart to show a window of data ending at `slider_index`
@@ -421,64 +443,265 @@ void update_history_view(int slider_index)
   // 2. Update the Date/Time Label
   char time_buf[64];
   formatTimestamp(timestamps[slider_index], time_buf, sizeof(time_buf));
+  // How old the sample is, once the wall clock is known
+  int64_t age_s = time_age_s(timestamps[slider_index]);
+  if (age_s >= 0)
+  {
+    int64_t age_h = age_s / 3600;
+    size_t len = strlen(time_buf);
+    if (age_h < 48)
+      snprintf(time_buf + len, sizeof(time_buf) - len, " (%d h ago)", (int)age_h);
+    else
+      snprintf(time_buf + len, sizeof(time_buf) - len, " (%d d ago)", (int)(age_h / 24));
+  }
   lv_label_set_text(history_datetime_label, time_buf);
 
-  // 3. Update the Chart
-  int start_idx = slider_index - (CHART_WINDOW_SIZE - 1);
-  lv_chart_set_point_count(history_chart, CHART_WINDOW_SIZE);
+  // 3. Update the Chart (only the samples that scrolled into the window are converted)
+  if (history_view_mode == HISTORY_VIEW_WINDOW)
+    history_chart_ring_show(history_ring, history_chart, history_series, current_history, slider_index);
+  else if (history_view_mode == HISTORY_VIEW_OVERLAY)
+  {
+    history_chart_ring_show(history_ring, history_chart, history_series, current_history, slider_index);
+    for (int k = 0; k < history_overlay_shown; k++)
+      history_chart_ring_show(history_overlay_rings[k], history_chart, history_overlay_series[k],
+                              history_overlay_column(k), slider_index);
+  }
+  else if (history_view != nullptr)
+    lv_chart_set_cursor_point(history_chart, history_cursor, history_series,
+                              decimated_view_find(*history_view, slider_index));
+
+  // 4. Window statistics, slid along with the chart, and the week and month summary
+  show_window_stats(current_history, slider_index);
+  show_range_summary(current_history, slider_index);
+}
 
-  for (int i = 0; i < CHART_WINDOW_SIZE; i++)
+// Removes the overlay series and the secondary axis
+static void history_overlay_detach()
+{
+  history_overlay_wanted = false;
+  lv_label_set_text(history_legend_label, "");
+  for (int k = 0; k < history_overlay_shown; k++)
   {
-    int current_data_idx = start_idx + i;
+    lv_chart_remove_series(history_chart, history_overlay_series[k]);
+    history_overlay_series[k] = nullptr;
+  }
+  if (history_overlay_shown > 0)
+    lv_chart_set_axis_tick(history_chart, LV_CHART_AXIS_SECONDARY_Y, 0, 0, 0, 0, false, 0);
+  history_overlay_shown = 0;
+}
 
-    if (current_data_idx >= 0 && current_data_idx < total_count)
+/**
+ * @brief Overlays the city's other loaded parameters on `primary`. The first
+ *        keeps its units on the secondary axis, the others are scaled from
+ *        their own range onto it; the legend lists each range.
+ */
+static void history_overlay_attach(const HistoricalSeries &primary)
+{
+  const HistoricalSeries *series[HISTORY_OVERLAY_COLUMNS];
+  float scale[HISTORY_OVERLAY_COLUMNS];
+  float offset[HISTORY_OVERLAY_COLUMNS];
+  int count = 0;
+  int axis_min = 0, axis_max = 0, axis_ticks = 0;
+  bool missing = false;
+  char legend[160] = "";
+  size_t len = 0;
+
+  for (int p = 0; p < PARAM_COUNT && count < HISTORY_OVERLAY_COLUMNS; p++)
+  {
+    const HistoricalSeries &s = cities[selectedCityIndex].history[p];
+    if (p == selectedParamIndex)
+      continue;
+    if (!cities[selectedCityIndex].loaded_historical[p] || s.count == 0)
     {
-      lv_chart_set_next_value(history_chart, history_series, (lv_coord_t)values[current_data_idx]);
+      missing = true;
+      continue;
     }
-    else
+
+    int lo, hi, ticks;
+    parameter_range(p, lo, hi, ticks);
+    if (count == 0)
     {
-      if (total_count > 0 && current_data_idx < 0)
-        lv_chart_set_next_value(history_chart, history_series, (lv_coord_t)values[0]);
-      else
-        lv_chart_set_next_value(history_chart, history_series, 0);
+      axis_min = lo;
+      axis_max = hi;
+      axis_ticks = ticks;
     }
+    series[count] = &s;
+    scale[count] = (float)(axis_max - axis_min) / (hi - lo);
+    offset[count] = axis_min - lo * scale[count];
+    len += snprintf(legend + len, sizeof(legend) - len, "%s#%06X %s %d..%d#", count ? "  " : "",
+                    (unsigned)history_overlay_colors[count], parameters[p].label, lo, hi);
+    count++;
   }
-  lv_chart_refresh(history_chart);
+  history_overlay_wanted = missing; // The I/O task fetches the rest
+
+  if (count == 0)
+  {
+    lv_label_set_text(history_legend_label, "Loading other parameters...");
+    return;
+  }
+
+  // Only rows the last join could not resolve are joined again
+  if (!history_overlay_bind(primary, series, scale, offset, count))
+  {
+    lv_label_set_text(history_legend_label, "Overlay unavailable");
+    return;
+  }
+  history_overlay_update();
+
+  lv_chart_set_range(history_chart, LV_CHART_AXIS_SECONDARY_Y, axis_min, axis_max);
+  lv_chart_set_axis_tick(history_chart, LV_CHART_AXIS_SECONDARY_Y, 10, 5, axis_ticks, 2, true, Y_TICK_LENGTH);
+  for (int k = 0; k < count; k++)
+  {
+    history_overlay_series[k] = lv_chart_add_series(history_chart, lv_color_hex(history_overlay_colors[k]),
+                                                    LV_CHART_AXIS_SECONDARY_Y);
+    history_chart_ring_init(history_overlay_rings[k], history_chart, history_overlay_series[k],
+                            history_overlay_points[k], CHART_WINDOW_SIZE);
+  }
+  history_overlay_shown = count;
+  lv_label_set_text(history_legend_label, legend);
 }
 
-// Callback for Slider Interaction
+/**
+ * @brief Points the chart at the data of the current view mode
+ */
+static void apply_history_view_mode(const HistoricalSeries &series)
+{
+  lv_label_set_text(history_mode_label, history_view_mode_names[history_view_mode]);
+  history_view = nullptr;
+  history_overlay_detach();
+
+  if (history_view_mode != HISTORY_VIEW_WINDOW)
+  {
+    // One chart point per pixel column (two for the min/max envelope)
+    lv_obj_update_layout(history_chart);
+    int width = lv_obj_get_content_width(history_chart);
+    DecimationMode mode = DECIMATION_LTTB;
+    if (history_view_mode == HISTORY_VIEW_ALL_MINMAX)
+    {
+      mode = DECIMATION_MINMAX;
+      width *= 2;
+    }
+    if (history_view_mode != HISTORY_VIEW_OVERLAY)
+      history_view = decimation_cache_get(series, 0, series.count, width, mode);
+  }
+
+  if (history_view == nullptr)
+  {
+    lv_chart_set_cursor_point(history_chart, history_cursor, history_series, LV_CHART_POINT_NONE);
+    lv_obj_remove_local_style_prop(history_chart, LV_STYLE_WIDTH, LV_PART_INDICATOR);
+    lv_obj_remove_local_style_prop(history_chart, LV_STYLE_HEIGHT, LV_PART_INDICATOR);
+    history_chart_ring_init(history_ring, history_chart, history_series, history_points, CHART_WINDOW_SIZE);
+    if (history_view_mode == HISTORY_VIEW_OVERLAY)
+      history_overlay_attach(series);
+    return;
+  }
+
+  lv_obj_set_style_size(history_chart, 0, LV_PART_INDICATOR); // Too many points for dots
+  lv_chart_set_point_count(history_chart, history_view->point_count);
+  lv_chart_set_ext_y_array(history_chart, history_series, history_view->points);
+  lv_chart_set_x_start_point(history_chart, history_series, 0);
+}
+
+// Another parameter of the city arrived: re-joins the overlay where the user
+// is scrubbing instead of rebuilding the tile and jumping back to the latest hour
+static void history_overlay_refresh()
+{
+  const HistoricalSeries &current_history = cities[selectedCityIndex].history[selectedParamIndex];
+  if (!ui_pages[UI_PAGE_HISTORY].built || history_view_mode != HISTORY_VIEW_OVERLAY || !current_history.isLoaded ||
+      current_history.count == 0)
+    return;
+  history_overlay_detach();
+  history_overlay_attach(current_history);
+  update_history_view((int)lv_slider_get_value(history_slider));
+}
+
+// Cycles 24 h window -> whole period (LTTB) -> whole period (min/max) -> overlay
+static void history_mode_event_cb(lv_event_t *e)
+{
+  LV_UNUSED(e);
+  history_view_mode = (history_view_mode + 1) % HISTORY_VIEW_MODE_COUNT;
+
+  HistoricalSeries &current_history = cities[selectedCityIndex].history[selectedParamIndex];
+  if (!current_history.isLoaded || current_history.count == 0)
+  {
+    lv_label_set_text(history_mode_label, history_view_mode_names[history_view_mode]);
+    return;
+  }
+  apply_history_view_mode(current_history);
+  update_history_view((int)lv_slider_get_value(history_slider));
+  history_scrub_pending = -1;
+}
+
+// Callback for Slider Interaction: only remembers the latest position, the
+// view follows once per frame in history_scrub_apply()
 static void history_slider_event_cb(lv_event_t *e)
 {
   lv_obj_t *slider = lv_event_get_target(e);
-  int value = (int)lv_slider_get_value(slider);
-  update_history_view(value);
+  if (history_scrub_pending < 0)
+    history_scrub_since_us = lvglTouchSampleTime();
+  history_scrub_pending = (int)lv_slider_get_value(slider);
+  history_scrub_events++;
 }
 
-/**
- * @brief Updates all UI labels with data from global variables.
- */
-void update_ui()
+// Called once per render step, before LVGL draws the frame
+static void history_scrub_apply()
 {
-  char buffer[2048];
-  char dateStr[16];
+  if (history_scrub_pending < 0)
+    return;
+  uint32_t start = lv_trace_now();
+  update_history_view(history_scrub_pending);
+  lv_trace_complete("scrub apply", start, (int16_t)history_scrub_pending, 0);
+  frame_stats_input_applied(history_scrub_since_us);
+  history_scrub_pending = -1;
+  history_scrub_updates++;
+}
 
-  // --- Update Tile 1: 7-Day Forecast ---
-  snprintf(buffer, sizeof(buffer), "7-Day Forecast (12:00) in %s\n\n", cities[selectedCityIndex].name);
+// Marks `code` on `obj` in the trace; user_data is the event's name in the viewer
+static void trace_event_cb(lv_event_t *e)
+{
+  lv_trace_instant((const char *)lv_event_get_user_data(e), 0, 0);
+}
 
-  for (int i = 0; i < 7; i++)
+static void trace_events(lv_obj_t *obj, lv_event_code_t code, const char *name)
+{
+  lv_obj_add_event_cb(obj, trace_event_cb, code, (void *)name);
+}
+
+static void ui_mark_dirty(uint8_t bits)
+{
+  for (int t = 0; t < UI_TILE_COUNT; t++)
   {
-    formatDate(cities[selectedCityIndex].forecast[i].time, dateStr, sizeof(dateStr));
-    char line[128];
-    snprintf(line, sizeof(line), "%s %s %.1f°C %s\n",
-             getWeatherSymbol(cities[selectedCityIndex].forecast[i].weatherCondition),
-             dateStr, cities[selectedCityIndex].forecast[i].temperature,
-             getWeatherString(cities[selectedCityIndex].forecast[i].weatherCondition));
-    strcat(buffer, line);
+    if ((bits & ui_dirty) & (1 << t))
+      ui_stats[t].coalesced++;
   }
-  lv_label_set_text(t1_label, buffer);
-  lv_obj_center(t1_label);
+  ui_dirty |= bits;
+}
 
-  // --- Update Tile 2 (Historical Data) ---
+static lv_obj_t *ui_tile_obj(int tile)
+{
+  return lv_obj_get_child(tileview, ui_tile_pages[tile]);
+}
+
+// True if any part of `tile` is inside the tileview, including mid-swipe
+static bool tile_is_visible(lv_obj_t *tile)
+{
+  lv_area_t tile_area, view_area, common;
+  lv_obj_get_coords(tile, &tile_area);
+  lv_obj_get_coords(tileview, &view_area);
+  return _lv_area_intersect(&common, &tile_area, &view_area);
+}
+
+// --- Tile 1: 7-Day Forecast (only rows whose day changed) ---
+static void update_forecast_tile()
+{
+  int changed = forecast_table_update(forecast_table, cities[selectedCityIndex]);
+  forecast_rows_changed += changed;
+  forecast_rows_skipped += FORECAST_TABLE_DAYS - changed;
+}
+
+// --- Tile 2: Historical Data ---
+static void update_history_tile()
+{
   int count = cities[selectedCityIndex].history[selectedParamIndex].count;
   
   // 1. Update Location Label
@@ -493,37 +716,157 @@ void update_ui()
     lv_slider_set_range(history_slider, 0, count - 1);
 
     // 3. Set Slider to "Latest" (Far right)
-    lv_slider_set_value(history_slider, count - 1, LV_ANIM_ON);
+    lv_slider_set_value(history_slider, count - 1, ui_animations ? LV_ANIM_ON : LV_ANIM_OFF);
 
     // 4. Enable Slider
     lv_obj_clear_state(history_slider, LV_STATE_DISABLED);
 
-    // 5. Update Chart, Info Label, and Time Label
+    // 5. Update Chart, Info Label, Time Label and statistics
+    window_stats_reset(history_window_stats); // The data may have been replaced
+    show_period_stats(cities[selectedCityIndex].history[selectedParamIndex]);
+    apply_history_view_mode(cities[selectedCityIndex].history[selectedParamIndex]);
     update_history_view(count - 1);
+    history_scrub_pending = -1;
   }
   else
   {
     lv_label_set_text(history_info_label, parameters[selectedParamIndex].label);
     lv_label_set_text(history_datetime_label, "No Data Loaded"); // Clear time label
-    lv_chart_set_point_count(history_chart, 0);       // Clear chart
+    history_chart_ring_clear(history_ring, history_chart, history_series); // Clear chart
+    history_overlay_detach();
     lv_obj_add_state(history_slider, LV_STATE_DISABLED); // Disable slider
+    lv_label_set_text(history_window_stats_label, "");
+    lv_label_set_text(history_period_stats_label, "");
+    lv_label_set_text(history_range_label, "");
   }
+}
 
+// --- Tile 3: Settings ---
+static void update_settings_tile()
+{
   lv_label_set_text(settings_status_label, "");
 }
 
+// --- Tile 5: Forecast verification ---
+static void update_verify_tile()
+{
+  char buf[64];
+  snprintf(buf, sizeof(buf), "Forecast check: %s", cities[selectedCityIndex].name);
+  lv_label_set_text(verify_title_label, buf);
+
+  VerifyLeadStats stats[FORECAST_VERIFY_LEADS];
+  ui_lock();
+  memcpy(stats, forecast_verify_stats(selectedCityIndex), sizeof(stats));
+  int pending = forecast_verify_pending(selectedCityIndex);
+  ui_unlock();
+
+  for (int lead = 0; lead < FORECAST_VERIFY_LEADS; lead++)
+  {
+    int row = lead + 1;
+    if (stats[lead].n == 0)
+    {
+      lv_table_set_cell_value(verify_table, row, 1, "-");
+      lv_table_set_cell_value(verify_table, row, 2, "-");
+      lv_table_set_cell_value(verify_table, row, 3, "0");
+      continue;
+    }
+    lv_table_set_cell_value_fmt(verify_table, row, 1, "%+.1f", stats[lead].bias);
+    lv_table_set_cell_value_fmt(verify_table, row, 2, "%.1f", stats[lead].mae);
+    lv_table_set_cell_value_fmt(verify_table, row, 3, "%u", (unsigned)stats[lead].n);
+  }
+  snprintf(buf, sizeof(buf), "%d forecasts waiting for observations", pending);
+  lv_label_set_text(verify_pending_label, buf);
+}
+
+static void rebuild_tile(int t)
+{
+  uint8_t bit = 1 << t;
+  uint32_t start = lv_trace_now();
+  if (t == UI_TILE_FORECAST)
+    update_forecast_tile();
+  else if (t == UI_TILE_HISTORY)
+    update_history_tile();
+  else if (t == UI_TILE_VERIFY)
+    update_verify_tile();
+  else
+    update_settings_tile();
+  lv_trace_complete("tile rebuild", start, t, 0);
+  ui_stats[t].rebuilds++;
+  ui_dirty &= ~bit;
+  ui_deferred &= ~bit;
+}
+
+/**
+ * @brief Rebuilds the dirty tiles that are on screen. Dirty off-screen tiles
+ *        keep their bit and are rebuilt once they scroll into view; tiles
+ *        whose widgets are not built yet are filled in when they are.
+ */
+void update_ui()
+{
+  for (int t = 0; t < UI_TILE_COUNT; t++)
+  {
+    uint8_t bit = 1 << t;
+    if (!(ui_dirty & bit))
+      continue;
+    if (!ui_pages[ui_tile_pages[t]].built || !tile_is_visible(ui_tile_obj(t)))
+    {
+      if (!(ui_deferred & bit))
+        ui_stats[t].deferred++;
+      ui_deferred |= bit;
+      continue;
+    }
+    rebuild_tile(t);
+  }
+}
+
+static void log_ui_stats()
+{
+  for (int t = 0; t < UI_TILE_COUNT; t++)
+  {
+    Serial.printf("UI %s: %u rebuilt, %u deferred, %u coalesced\n", ui_tile_names[t],
+                  (unsigned)ui_stats[t].rebuilds, (unsigned)ui_stats[t].deferred, (unsigned)ui_stats[t].coalesced);
+  }
+  Serial.printf("UI forecast rows: %u changed, %u unchanged\n",
+                (unsigned)forecast_rows_changed, (unsigned)forecast_rows_skipped);
+  Serial.printf("UI history slider: %u events, %u view updates\n",
+                (unsigned)history_scrub_events, (unsigned)history_scrub_updates);
+  for (int p = 0; p < UI_PAGE_COUNT; p++)
+  {
+    Serial.printf("UI page %s: %s, %u builds (last %.1f ms), %u teardowns\n", ui_page_names[p],
+                  ui_pages[p].built ? "built" : "empty", (unsigned)ui_pages[p].builds, ui_pages[p].build_us / 1000.0f,
+                  (unsigned)ui_pages[p].teardowns);
+  }
+
+  lv_mem_hybrid_stats_t mem;
+  lv_mem_hybrid_get_stats(&mem);
+  Serial.printf("LVGL arena: %u/%u bytes used (peak %u), largest free %u, %u%% fragmented, %u small allocs in PSRAM\n",
+                (unsigned)mem.pool_used, (unsigned)mem.pool_size, (unsigned)mem.pool_peak,
+                (unsigned)mem.pool_free_biggest, (unsigned)mem.pool_frag_pct, (unsigned)mem.small_fallbacks);
+
+  if (amoled.hasLightSensor())
+    Serial.printf("Brightness: level %u at %.0f lux, %u samples, %u level changes, %u panel commands\n",
+                  (unsigned)auto_brightness.level, last_lux, (unsigned)auto_brightness.samples,
+                  (unsigned)auto_brightness.changes, (unsigned)brightness_commands);
+
+  LvglTouchStats touch;
+  lvglTouchStats(&touch, true);
+  Serial.printf("Touch (%s): %u interrupts, %u I2C reads, %u samples dropped\n", touch.irq_mode ? "irq" : "polled",
+                (unsigned)touch.irqs, (unsigned)touch.reads, (unsigned)touch.dropped);
+}
+
 // Settings callbacks
 void settings_value_changed(lv_event_t *e)
 {
-  ui_updated = true;
   lv_obj_t *obj = lv_event_get_target(e);
   if (obj == city_dropdown)
   {
+    ui_mark_dirty(UI_DIRTY_ALL);
     selectedCityIndex = lv_dropdown_get_selected(obj);
     lv_label_set_text(settings_status_label, "City selected - updating UI...");
   }
   else if (obj == param_dropdown)
   {
+    ui_mark_dirty((1 << UI_TILE_HISTORY) | (1 << UI_TILE_SETTINGS));
     selectedParamIndex = lv_dropdown_get_selected(obj);
     lv_label_set_text(settings_status_label, "Parameters selected - updating UI...");
   }
@@ -547,6 +890,7 @@ static void on_reset_deaults(lv_event_t *e)
   selectedParamIndex = 0;
   lv_dropdown_set_selected(city_dropdown, selectedCityIndex);
   lv_dropdown_set_selected(param_dropdown, selectedParamIndex);
+  ui_mark_dirty((1 << UI_TILE_FORECAST) | (1 << UI_TILE_HISTORY) | (1 << UI_TILE_VERIFY));
   preferences.begin("weather", false);
   preferences.clear();
   preferences.end();
@@ -563,18 +907,17 @@ static void get_saved_preferences()
   Serial.printf("Loaded Preferences: city_idx=%d, param_idx=%d\n", selectedCityIndex, selectedParamIndex);
 }
 
-// Function: Creates UI
-static void create_ui()
+static void init_tile_styles()
 {
-  // --- STYLES FOR SETTINGS TILE ---
-  
+  if (tile_styles_ready)
+    return;
+  tile_styles_ready = true;
+
   // Style for all button and dropdown text (using known available font 28)
-  static lv_style_t style_text_large;
   lv_style_init(&style_text_large);
   lv_style_set_text_font(&style_text_large, &montserrat_se_28); 
 
   // Style for the dropdown container/button part (Custom border/bg)
-  static lv_style_t style_dropdown_clean;
   lv_style_init(&style_dropdown_clean);
   lv_style_set_bg_color(&style_dropdown_clean, lv_color_white()); // Fixed args
   lv_style_set_border_width(&style_dropdown_clean, 2); // Fixed args
@@ -583,61 +926,51 @@ static void create_ui()
   lv_style_set_pad_all(&style_dropdown_clean, 5); // Fixed args
 
   // Style for the dropdown list (Menu)
-  static lv_style_t style_dropdown_list;
   lv_style_init(&style_dropdown_list);
   lv_style_set_text_font(&style_dropdown_list, &montserrat_se_28);
+}
 
-  // --- BASE LAYOUT ---
-  tileview = lv_tileview_create(lv_scr_act());
-  lv_obj_set_size(tileview, lv_disp_get_hor_res(NULL), lv_disp_get_ver_res(NULL));
-  lv_obj_set_scrollbar_mode(tileview, LV_SCROLLBAR_MODE_OFF);
-
-  // Add tiles
-  t0 = lv_tileview_add_tile(tileview, 0, 0, LV_DIR_HOR); // Boot
-  t1 = lv_tileview_add_tile(tileview, 1, 0, LV_DIR_HOR); // Forecast
-  t2 = lv_tileview_add_tile(tileview, 2, 0, LV_DIR_HOR); // History (Tile 3)
-  t3 = lv_tileview_add_tile(tileview, 3, 0, LV_DIR_HOR); // Settings
-  t4 = lv_tileview_add_tile(tileview, 4, 0, LV_DIR_HOR); // Wifi
-
-  // Tile #0 - Boot Screen
-  lv_obj_set_style_bg_color(t0, lv_color_black(), 0);
-  lv_obj_set_style_bg_opa(t0, LV_OPA_COVER, 0);
-  t0_label = lv_label_create(t0);
+// Tile #0 - Boot Screen
+static void build_boot_page(lv_obj_t *tile)
+{
+  t0_label = lv_label_create(tile);
   lv_label_set_text(t0_label, "Group 8\nFirmware v1.2.0");
   lv_obj_set_style_text_font(t0_label, &montserrat_se_28, 0);
   lv_obj_set_style_text_color(t0_label, lv_color_white(), 0);
   lv_obj_center(t0_label);
+}
 
-  // Tile #1 - 7-Day Forecast
-  t1_label = lv_label_create(t1);
-  lv_label_set_text(t1_label, "Forecast data: Loading...");
-  lv_obj_set_style_text_font(t1_label, &montserrat_se_28, 0);
-  lv_obj_center(t1_label);
-  apply_tile_colors(t1);
+// Tile #1 - 7-Day Forecast
+static void build_forecast_page(lv_obj_t *tile)
+{
+  forecast_table_create(forecast_table, tile, &montserrat_se_28);
+}
 
-  // --- Tile #2 (Screen 3) - Historical Weather ---
-  apply_tile_colors(t2);
+// --- Tile #2 (Screen 3) - Historical Weather ---
+static void build_history_page(lv_obj_t *tile)
+{
+  init_tile_styles();
 
   // Location Label (Top Center)
-  history_location_label = lv_label_create(t2);
+  history_location_label = lv_label_create(tile);
   lv_label_set_text(history_location_label, cities[selectedCityIndex].name);
   lv_obj_set_style_text_font(history_location_label, &montserrat_se_28, 0);
   lv_obj_align(history_location_label, LV_ALIGN_TOP_MID, 0, 10);
 
   // Info Label (Parameter Value)
-  history_info_label = lv_label_create(t2);
+  history_info_label = lv_label_create(tile);
   lv_label_set_text(history_info_label, "History: Loading...");
   lv_obj_set_style_text_font(history_info_label, &montserrat_se_28, 0);
   lv_obj_align(history_info_label, LV_ALIGN_TOP_MID, 0, 40);
 
   // Date/Time Label (Below Info)
-  history_datetime_label = lv_label_create(t2);
+  history_datetime_label = lv_label_create(tile);
   lv_label_set_text(history_datetime_label, "Date/Time N/A");
   lv_obj_set_style_text_font(history_datetime_label, &montserrat_se_28, 0);
   lv_obj_align(history_datetime_label, LV_ALIGN_TOP_MID, 0, 75); 
 
   // Chart (Middle)
-  history_chart = lv_chart_create(t2);
+  history_chart = lv_chart_create(tile);
   lv_obj_set_size(history_chart, 200, 180); 
   lv_obj_align(history_chart, LV_ALIGN_CENTER, 0, 10);
   lv_chart_set_type(history_chart, LV_CHART_TYPE_LINE);
@@ -645,24 +978,55 @@ static void create_ui()
   // Set initial range based on current selection (default is temp)
   set_chart_range_by_parameter(selectedParamIndex);
 
-  lv_chart_set_point_count(history_chart, CHART_WINDOW_SIZE);
-
   history_series = lv_chart_add_series(history_chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_PRIMARY_Y);
+  history_chart_ring_init(history_ring, history_chart, history_series, history_points, CHART_WINDOW_SIZE);
+  history_cursor = lv_chart_add_cursor(history_chart, lv_palette_main(LV_PALETTE_BLUE), LV_DIR_VER);
+
+  // Overlay legend (Above the chart)
+  history_legend_label = lv_label_create(tile);
+  lv_label_set_text(history_legend_label, "");
+  lv_label_set_recolor(history_legend_label, true);
+  lv_obj_align(history_legend_label, LV_ALIGN_CENTER, 0, -92);
+
+  // View mode button (Right of the chart)
+  history_mode_btn = lv_btn_create(tile);
+  lv_obj_set_size(history_mode_btn, 130, 50);
+  lv_obj_align(history_mode_btn, LV_ALIGN_RIGHT_MID, -20, 10);
+  lv_obj_add_style(history_mode_btn, &style_text_large, LV_PART_MAIN);
+  history_mode_label = lv_label_create(history_mode_btn);
+  lv_label_set_text(history_mode_label, history_view_mode_names[history_view_mode]);
+  lv_obj_center(history_mode_label);
+  lv_obj_add_event_cb(history_mode_btn, history_mode_event_cb, LV_EVENT_CLICKED, NULL);
+
+  // Statistics (Left of the chart for the window, under the mode button for the period)
+  history_window_stats_label = lv_label_create(tile);
+  lv_label_set_text(history_window_stats_label, "");
+  lv_obj_align(history_window_stats_label, LV_ALIGN_LEFT_MID, 20, 10);
+  history_period_stats_label = lv_label_create(tile);
+  lv_label_set_text(history_period_stats_label, "");
+  lv_obj_align_to(history_period_stats_label, history_mode_btn, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 12);
+  history_range_label = lv_label_create(tile);
+  lv_label_set_text(history_range_label, "");
+  lv_obj_align(history_range_label, LV_ALIGN_BOTTOM_LEFT, 20, -10);
 
   // Slider (Bottom)
-  history_slider = lv_slider_create(t2);
+  history_slider = lv_slider_create(tile);
   lv_obj_set_width(history_slider, 200);
   lv_obj_align(history_slider, LV_ALIGN_BOTTOM_MID, 0, -10); 
   lv_obj_add_event_cb(history_slider, history_slider_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
   lv_obj_add_state(history_slider, LV_STATE_DISABLED); // Disabled until data loads
+  trace_events(history_slider, LV_EVENT_VALUE_CHANGED, "slider moved");
+}
 
+// --- Tile #3 - Settings ---
+static void build_settings_page(lv_obj_t *tile)
+{
+  init_tile_styles();
 
-  // --- Tile #3 - Settings ---
-  lv_obj_t *t3_label = lv_label_create(t3);
+  lv_obj_t *t3_label = lv_label_create(tile);
   lv_label_set_text(t3_label, "Settings");
   lv_obj_set_style_text_font(t3_label, &montserrat_se_28, 0); 
   lv_obj_align(t3_label, LV_ALIGN_TOP_MID, 0, 6);
-  apply_tile_colors(t3);
 
   // --- Dropdowns (City & Parameter) ---
   String cityOptions;
@@ -672,7 +1036,7 @@ static void create_ui()
     if (i < CITY_COUNT - 1)
       cityOptions += "\n";
   }
-  city_dropdown = lv_dropdown_create(t3);
+  city_dropdown = lv_dropdown_create(tile);
   lv_dropdown_set_options(city_dropdown, cityOptions.c_str());
   lv_obj_set_size(city_dropdown, 220, 50); // Sized
   lv_obj_align(city_dropdown, LV_ALIGN_TOP_LEFT, 10, 60);
@@ -689,7 +1053,7 @@ static void create_ui()
     if (i < PARAM_COUNT - 1)
       paramOptions += "\n";
   }
-  param_dropdown = lv_dropdown_create(t3);
+  param_dropdown = lv_dropdown_create(tile);
   lv_dropdown_set_options(param_dropdown, paramOptions.c_str());
   lv_obj_set_size(param_dropdown, 220, 50); // Sized
   lv_obj_align(param_dropdown, LV_ALIGN_TOP_LEFT, 10, 130);
@@ -700,7 +1064,7 @@ static void create_ui()
   lv_obj_add_event_cb(param_dropdown, settings_value_changed, LV_EVENT_VALUE_CHANGED, NULL);
 
   // --- Buttons ---
-  btn_save_default = lv_btn_create(t3);
+  btn_save_default = lv_btn_create(tile);
   lv_obj_align(btn_save_default, LV_ALIGN_TOP_RIGHT, -10, 60);
   lv_obj_set_size(btn_save_default, 180, 50); // Sized
   lv_obj_add_style(btn_save_default, &style_text_large, LV_PART_MAIN);
@@ -709,7 +1073,7 @@ static void create_ui()
   lv_obj_center(lbl_save);
   lv_obj_add_event_cb(btn_save_default, on_save_defaults, LV_EVENT_CLICKED, NULL);
 
-  btn_reset_defaults = lv_btn_create(t3);
+  btn_reset_defaults = lv_btn_create(tile);
   lv_obj_align(btn_reset_defaults, LV_ALIGN_TOP_RIGHT, -10, 130); // Aligned next to Parameter
   lv_obj_set_size(btn_reset_defaults, 180, 50); // Sized
   lv_obj_add_style(btn_reset_defaults, &style_text_large, LV_PART_MAIN);
@@ -719,18 +1083,177 @@ static void create_ui()
   lv_obj_add_event_cb(btn_reset_defaults, on_reset_deaults, LV_EVENT_CLICKED, NULL);
 
   // Status label (at bottom)
-  settings_status_label = lv_label_create(t3);
+  settings_status_label = lv_label_create(tile);
   lv_label_set_text(settings_status_label, "");
   lv_obj_set_style_text_font(settings_status_label, &montserrat_se_28, 0); 
   lv_obj_align(settings_status_label, LV_ALIGN_BOTTOM_MID, 0, -10);
 
-  // Tile #4 - Wifi
-  t4_label = lv_label_create(t4);
-  lv_label_set_text(t4_label, "Wi-Fi: Connecting...");
+  trace_events(city_dropdown, LV_EVENT_READY, "city dropdown open");
+  trace_events(city_dropdown, LV_EVENT_VALUE_CHANGED, "city selected");
+  trace_events(param_dropdown, LV_EVENT_READY, "parameter dropdown open");
+  trace_events(param_dropdown, LV_EVENT_VALUE_CHANGED, "parameter selected");
+}
+
+// Tile #4 - Wifi
+static void build_wifi_page(lv_obj_t *tile)
+{
+  t4_label = lv_label_create(tile);
+  lv_label_set_text(t4_label, wifi_status_text);
   lv_obj_set_style_text_font(t4_label, &montserrat_se_28, 0);
   lv_obj_center(t4_label);
+}
+
+// Tile #5 - Forecast verification
+static void build_verify_page(lv_obj_t *tile)
+{
+  verify_title_label = lv_label_create(tile);
+  lv_label_set_text(verify_title_label, "Forecast check");
+  lv_obj_set_style_text_font(verify_title_label, &montserrat_se_28, 0);
+  lv_obj_align(verify_title_label, LV_ALIGN_TOP_MID, 0, 10);
+
+  static const char *headers[] = {"Lead", "Bias C", "MAE C", "Pairs"};
+  verify_table = lv_table_create(tile);
+  lv_table_set_col_cnt(verify_table, 4);
+  lv_table_set_row_cnt(verify_table, FORECAST_VERIFY_LEADS + 1);
+  for (int col = 0; col < 4; col++)
+  {
+    lv_table_set_col_width(verify_table, col, 140);
+    lv_table_set_cell_value(verify_table, 0, col, headers[col]);
+  }
+  for (int lead = 1; lead <= FORECAST_VERIFY_LEADS; lead++)
+    lv_table_set_cell_value_fmt(verify_table, lead, 0, "+%d d", lead);
+  lv_obj_set_style_text_font(verify_table, &montserrat_se_28, LV_PART_ITEMS);
+  lv_obj_set_style_pad_ver(verify_table, 4, LV_PART_ITEMS);
+  lv_obj_set_style_border_width(verify_table, 0, LV_PART_MAIN);
+  lv_obj_clear_flag(verify_table, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_align(verify_table, LV_ALIGN_TOP_MID, 0, 50);
+
+  verify_pending_label = lv_label_create(tile);
+  lv_label_set_text(verify_pending_label, "");
+  lv_obj_align(verify_pending_label, LV_ALIGN_BOTTOM_MID, 0, -10);
+}
+
+static void (*const ui_page_builders[UI_PAGE_COUNT])(lv_obj_t *tile) = {
+    build_boot_page, build_forecast_page, build_history_page, build_settings_page, build_wifi_page, build_verify_page};
+
+// Builds `page` and fills it with the current data in the same step, so it
+// never shows up with placeholder text
+static void ui_page_build(int page)
+{
+  if (ui_pages[page].built)
+    return;
+  uint32_t start = lv_trace_now();
+  ui_page_builders[page](lv_obj_get_child(tileview, page));
+  ui_pages[page].built = true;
+  for (int t = 0; t < UI_TILE_COUNT; t++)
+  {
+    if (ui_tile_pages[t] == page)
+      rebuild_tile(t);
+  }
+  ui_pages[page].builds++;
+  ui_pages[page].build_us = lv_trace_now() - start;
+  lv_trace_complete("tile build", start, page, 0);
+}
+
+// Deletes the widgets of a recyclable page; the tile itself stays in the tileview
+static void ui_page_teardown(int page)
+{
+  lv_obj_clean(lv_obj_get_child(tileview, page));
+  if (page == UI_PAGE_SETTINGS)
+  {
+    city_dropdown = nullptr;
+    param_dropdown = nullptr;
+    btn_save_default = nullptr;
+    btn_reset_defaults = nullptr;
+    settings_status_label = nullptr;
+  }
+  else if (page == UI_PAGE_WIFI)
+  {
+    t4_label = nullptr;
+  }
+  else if (page == UI_PAGE_VERIFY)
+  {
+    verify_title_label = nullptr;
+    verify_table = nullptr;
+    verify_pending_label = nullptr;
+  }
+  ui_pages[page].built = false;
+  ui_pages[page].teardowns++;
+}
+
+// Cleans idle recyclable pages while the arena is short of room. Walks the
+// arena, so it runs on tile changes and with the stats log, not per frame.
+static void ui_reclaim_pages()
+{
+  lv_mem_hybrid_stats_t mem;
+  lv_mem_hybrid_get_stats(&mem);
+  if (mem.pool_free_biggest >= UI_PAGE_RECLAIM_FREE)
+    return;
+  for (int p = 0; p < UI_PAGE_COUNT; p++)
+  {
+    UiPageState &page = ui_pages[p];
+    if (!page.built || !page.recyclable || p == ui_page_active || millis() - page.last_shown < UI_PAGE_IDLE_MS ||
+        tile_is_visible(lv_obj_get_child(tileview, p)))
+      continue;
+    ui_page_teardown(p);
+    Serial.printf("UI page %s torn down, arena had %u bytes in one block\n", ui_page_names[p],
+                  (unsigned)mem.pool_free_biggest);
+  }
+}
+
+// Scrolling builds whatever part of a page comes into view; settling on a
+// tile records the visit and gives memory back if it is short
+static void tile_pages_event_cb(lv_event_t *e)
+{
+  if (lv_event_get_code(e) == LV_EVENT_SCROLL)
+  {
+    for (int p = 0; p < UI_PAGE_COUNT; p++)
+    {
+      if (!ui_pages[p].built && tile_is_visible(lv_obj_get_child(tileview, p)))
+        ui_page_build(p);
+    }
+    return;
+  }
+
+  ui_pages[ui_page_active].last_shown = millis();
+  ui_page_active = (int)lv_obj_get_index(lv_tileview_get_tile_act(tileview));
+  ui_pages[ui_page_active].last_shown = millis();
+  ui_reclaim_pages();
+}
+
+// Function: Creates UI. Only the boot tile's widgets are built here; the
+// others follow on their first visit.
+static void create_ui()
+{
+  // --- BASE LAYOUT ---
+  tileview = lv_tileview_create(lv_scr_act());
+  lv_obj_set_size(tileview, lv_disp_get_hor_res(NULL), lv_disp_get_ver_res(NULL));
+  lv_obj_set_scrollbar_mode(tileview, LV_SCROLLBAR_MODE_OFF);
+
+  // Add tiles
+  t0 = lv_tileview_add_tile(tileview, 0, 0, LV_DIR_HOR); // Boot
+  t1 = lv_tileview_add_tile(tileview, 1, 0, LV_DIR_HOR); // Forecast
+  t2 = lv_tileview_add_tile(tileview, 2, 0, LV_DIR_HOR); // History (Tile 3)
+  t3 = lv_tileview_add_tile(tileview, 3, 0, LV_DIR_HOR); // Settings
+  t4 = lv_tileview_add_tile(tileview, 4, 0, LV_DIR_HOR); // Wifi
+  t5 = lv_tileview_add_tile(tileview, 5, 0, LV_DIR_HOR); // Forecast verification
+
+  // Backgrounds go on the empty tiles so a page being built never flashes
+  lv_obj_set_style_bg_color(t0, lv_color_black(), 0);
+  lv_obj_set_style_bg_opa(t0, LV_OPA_COVER, 0);
+  apply_tile_colors(t1);
+  apply_tile_colors(t2);
+  apply_tile_colors(t3);
   apply_tile_colors(t4);
+  apply_tile_colors(t5);
+
+  // Interactions that show up in the latency trace
+  trace_events(tileview, LV_EVENT_SCROLL_BEGIN, "swipe begin");
+  trace_events(tileview, LV_EVENT_SCROLL_END, "swipe end");
+  lv_obj_add_event_cb(tileview, tile_pages_event_cb, LV_EVENT_SCROLL, NULL);
+  lv_obj_add_event_cb(tileview, tile_pages_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
 
+  ui_page_build(UI_PAGE_BOOT);
   lv_obj_set_tile(tileview, t0, LV_ANIM_OFF);
 }
 
@@ -787,6 +1310,10 @@ struct SpiRamAllocator
 SpiRamAllocator myPsramAllocator;
 using SpiRamJsonDocument = BasicJsonDocument<SpiRamAllocator>;
 
+// Spare series the I/O task parses into; swapped with the city's series under
+// ui_lock(), so the render task never sees a half-written history
+static HistoricalSeries history_staging;
+
 bool fetchForcast(int c)
 {
   if (WiFi.status() != WL_CONNECTED)
@@ -802,6 +1329,8 @@ bool fetchForcast(int c)
   Serial.printf("Fetching Forecast for %s...\n", cities[c].name);
   if (fetchJsonFromServer(forecastUrl, doc))
   {
+    ForcastHourlyWeather days[7];
+    memcpy(days, cities[c].forecast, sizeof(days));
     JsonArray hours = doc["timeSeries"].as<JsonArray>();
     int skip = 0;
     int next_day = 0;
@@ -817,7 +1346,7 @@ bool fetchForcast(int c)
       {
         if (is_it_twelve(time) && next_day < 7)
         {
-          ForcastHourlyWeather &hourly = cities[c].forecast[next_day];
+          ForcastHourlyWeather &hourly = days[next_day];
           hourly.temperature = hour["data"]["air_temperature"].as<float>();
           hourly.weatherCondition = WeatherCondition(hour["data"]["symbol_code"].as<int>());
           strncpy(hourly.time, time, 20);
@@ -825,8 +1354,24 @@ bool fetchForcast(int c)
           next_day++;
         }
       }
-      cities[c].loaded_forcast = true;
     }
+
+    // Logged for verification against the station once the days have passed
+    int64_t issued_s;
+    bool issued = time_parse_iso8601(doc["approvedTime"].as<const char *>(), issued_s);
+
+    ui_lock();
+    memcpy(cities[c].forecast, days, sizeof(days));
+    cities[c].loaded_forcast = true;
+    if (issued)
+      forecast_verify_snapshot(c, issued_s, days, next_day);
+    ui_unlock();
+    forecast_verify_save();
+
+    UiMsg msg = {};
+    msg.type = UI_MSG_FORECAST_READY;
+    msg.forecast.city = (uint8_t)c;
+    ui_post(msg);
     return true;
   }
   return false;
@@ -847,7 +1392,7 @@ bool fetchHistorical(int c, int p)
   Serial.printf("Fetching History (%s) for %s...\n", parameters[p].label, cities[c].name);
   if (fetchJsonFromServer(histUrl, doc))
   {
-    HistoricalSeries &current_history = cities[c].history[p];
+    HistoricalSeries &staged = history_staging;
 
     JsonArray days = doc["value"].as<JsonArray>();
     int idx = 0;
@@ -856,23 +1401,327 @@ bool fetchHistorical(int c, int p)
       if (idx >= HistoricalSeries::MAX_HOURS)
         break;
 
-      current_history.values[idx] = day["value"].as<float>();
+      staged.values[idx] = day["value"].as<float>();
 
       // 1755226800000
-      current_history.timestamps[idx] = day["date"].as<unsigned long long>();
+      staged.timestamps[idx] = day["date"].as<unsigned long long>();
       
       idx++;
     }
-    current_history.count = idx;
-    current_history.isLoaded = true;
+    staged.count = idx;
+    staged.isLoaded = true;
+    history_index_build(staged, history_thresholds[p].value);
+
+    ui_lock();
+    HistoricalSeries &current_history = cities[c].history[p];
+    HistoricalSeries previous = current_history;
+    current_history = staged;
+    staged = previous;
+    decimation_cache_invalidate(current_history);
+    history_stats_invalidate(current_history);
+    history_overlay_invalidate(current_history);
     cities[c].loaded_historical[p] = true;
-    
+    if (p == 0)
+      forecast_verify_join(c, current_history);
+    ui_unlock();
+    forecast_verify_save();
+
+    UiMsg msg = {};
+    msg.type = UI_MSG_HISTORY_READY;
+    msg.history.city = (uint8_t)c;
+    msg.history.param = (uint8_t)p;
+    ui_post(msg);
     return true;
   }
   return false;
 }
 
-void setup()
+// --- RENDER AND I/O STEPS ---
+
+// Render task: keeps the selection for the next wake, turns the panel off and deep sleeps
+static void kiosk_enter_sleep()
+{
+  ui_lock();
+  kiosk_save(cities[selectedCityIndex], selectedCityIndex, selectedParamIndex);
+  ui_unlock();
+  kiosk_log();
+  Serial.flush();
+#if UI_RENDER_TASK
+  WiFi.disconnect(true);
+  amoled.sleep(false); // Touch stays powered, its IRQ is a wake source
+#endif
+  kiosk_sleep(amoled.touchIrqPin());
+}
+
+// Render task: frame pacing and animations for a battery tier
+static void apply_battery_tier(const BatteryTierPolicy &policy)
+{
+  ui_set_render_period(policy.frame_period_ms);
+  lv_disp_t *disp = lv_disp_get_default();
+  if (disp && disp->refr_timer)
+    lv_timer_set_period(disp->refr_timer, policy.frame_period_ms);
+
+  ui_animations = policy.animations;
+  if (policy.animations)
+    lv_obj_add_flag(tileview, LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_ELASTIC);
+  else
+    lv_obj_clear_flag(tileview, LV_OBJ_FLAG_SCROLL_MOMENTUM | LV_OBJ_FLAG_SCROLL_ELASTIC);
+}
+
+// I/O task: posts the panel level, capped by the battery tier, if the cap left it changed
+static void post_brightness()
+{
+  uint8_t cap = battery_policy_current(battery_policy).max_brightness;
+  uint8_t level = brightness_wanted < cap ? brightness_wanted : cap;
+  if (level == brightness_posted)
+    return;
+  brightness_posted = level;
+  UiMsg msg = {};
+  msg.type = UI_MSG_BRIGHTNESS;
+  msg.brightness.level = level;
+  ui_post(msg);
+}
+
+// I/O task: samples the PMU and hands a tier change to the render task
+static void poll_battery()
+{
+  if (millis() - last_battery_sample < BATTERY_SAMPLE_MS)
+    return;
+  last_battery_sample = millis();
+  uint16_t mv = amoled.getBattVoltage();
+  if (!battery_policy_update(battery_policy, mv, amoled.isVbusIn()))
+    return;
+
+  const BatteryTierPolicy &policy = battery_policy_current(battery_policy);
+  Serial.printf("Battery: %u mV (filtered %.0f), %s, tier %s: %u ms frames, animations %s, fetch %s\n",
+                mv, battery_policy.mv, battery_policy.external ? "external power" : "discharging", policy.name,
+                (unsigned)policy.frame_period_ms, policy.animations ? "on" : "off",
+                policy.fetch ? (policy.prefetch ? "eager" : "on demand") : "off");
+  UiMsg msg = {};
+  msg.type = UI_MSG_BATTERY_TIER;
+  msg.battery.tier = (uint8_t)battery_policy.tier;
+  ui_post(msg);
+  post_brightness();
+}
+
+// Render task: applies posted messages, rebuilds visible dirty tiles and runs LVGL.
+// Returns the time in ms until LVGL has work again, the render task idles that long.
+static uint32_t render_step()
+{
+  UiMsg msg;
+  while (ui_receive(msg))
+  {
+    switch (msg.type)
+    {
+    case UI_MSG_FORECAST_READY:
+      if (msg.forecast.city != selectedCityIndex) // A prefetch, drawn when its city is selected
+        break;
+      ui_mark_dirty((1 << UI_TILE_FORECAST) | (1 << UI_TILE_VERIFY));
+      kiosk_data_fetched();
+      break;
+    case UI_MSG_HISTORY_READY:
+      if (msg.history.city != selectedCityIndex)
+        break;
+      if (msg.history.param == 0) // Temperatures are what the forecast is checked against
+        ui_mark_dirty(1 << UI_TILE_VERIFY);
+      if (msg.history.param != selectedParamIndex)
+      {
+        history_overlay_refresh(); // Only the overlay shows other parameters
+        break;
+      }
+      ui_mark_dirty(1 << UI_TILE_HISTORY);
+      kiosk_data_fetched();
+      break;
+    case UI_MSG_WIFI_STATUS:
+      show_wifi_status(msg);
+      break;
+    case UI_MSG_BRIGHTNESS:
+      if (msg.brightness.level != amoled.getBrightness())
+      {
+        amoled.setBrightness(msg.brightness.level);
+        brightness_commands++;
+      }
+      break;
+    case UI_MSG_BATTERY_TIER:
+      apply_battery_tier(battery_tier_policies[msg.battery.tier]);
+      break;
+    }
+  }
+
+  if (ui_dirty)
+    update_ui();
+  history_scrub_apply();
+
+  lvglTouchService();
+  uint32_t idle_ms = lv_timer_handler();
+
+  if (KIOSK_MODE)
+  {
+    bool refresh_pending = !cities[selectedCityIndex].loaded_forcast ||
+                           !cities[selectedCityIndex].loaded_historical[selectedParamIndex];
+    if (kiosk_should_sleep(lv_disp_get_inactive_time(NULL), refresh_pending))
+      kiosk_enter_sleep();
+  }
+
+  if (millis() - last_ui_stats_log > UI_STATS_LOG_MS)
+  {
+    log_ui_stats();
+    frame_stats_log();
+    frame_stats_log_input("Scrub");
+    ui_task_log();
+    power_log();
+    time_service_log();
+    history_stats_log(history_window_stats);
+    history_overlay_log();
+    forecast_verify_log();
+    ui_reclaim_pages();
+    last_ui_stats_log = millis();
+  }
+  return idle_ms;
+}
+
+static void serial_write(const char *text, void *ctx)
+{
+  LV_UNUSED(ctx);
+  Serial.print(text);
+}
+
+// I/O task: Wi-Fi status and fetches for the current selection, which the settings tile may change
+static void io_step()
+{
+  if (wifi_started)
+    wifi_fast_poll();
+  if (wifi_fast_connected())
+    time_service_start_sync();
+  time_service_poll();
+
+  if (amoled.hasLightSensor() && millis() - last_lux_sample >= AUTO_BRIGHTNESS_SAMPLE_MS)
+  {
+    last_lux_sample = millis();
+    last_lux = amoled.getLux();
+    if (auto_brightness_update(auto_brightness, last_lux, brightness_wanted))
+      post_brightness();
+  }
+  poll_battery();
+
+  // Send 't' over serial to dump the touch-to-photon trace as Chrome JSON
+  if (Serial.available() > 0 && Serial.read() == 't')
+    lv_trace_export(serial_write, nullptr);
+
+  const BatteryTierPolicy &policy = battery_policy_current(battery_policy);
+  if (!policy.fetch)
+    return;
+
+  ui_lock();
+  int city = selectedCityIndex;
+  int param = selectedParamIndex;
+  // Loaded data goes stale after the tier's refresh period
+  if (policy.refresh_ms && millis() - last_refresh >= policy.refresh_ms &&
+      cities[city].loaded_forcast && cities[city].loaded_historical[param])
+  {
+    cities[city].loaded_forcast = false;
+    cities[city].loaded_historical[param] = false;
+  }
+  bool need_forecast = !cities[city].loaded_forcast;
+  bool need_history = !cities[city].loaded_historical[param];
+  // The overlay chart wants the city's other parameters, one per step
+  int overlay_param = -1;
+  bool overlay = history_overlay_wanted && !need_forecast && !need_history;
+  for (int p = 0; overlay && p < PARAM_COUNT && overlay_param < 0; p++)
+    if (!cities[city].loaded_historical[p])
+      overlay_param = p;
+  // With nothing else to do, fetch one other city's forecast ahead of a switch
+  int prefetch = -1;
+  for (int i = 0; policy.prefetch && !need_forecast && !need_history && i < CITY_COUNT && prefetch < 0; i++)
+    if (!cities[i].loaded_forcast)
+      prefetch = i;
+  ui_unlock();
+
+  if (overlay_param >= 0 && wifi_started)
+  {
+    power_busy_begin();
+    fetchHistorical(city, overlay_param);
+    power_busy_end();
+    return;
+  }
+
+  if (prefetch >= 0 && wifi_started)
+  {
+    power_busy_begin();
+    fetchForcast(prefetch);
+    power_busy_end();
+    return;
+  }
+
+  // A kiosk wake with fresh data never brings up Wi-Fi
+  if ((need_forecast || need_history) && !wifi_started)
+    wifi_start();
+
+  // TLS and JSON parsing at full clock
+  if (need_forecast || need_history)
+    power_busy_begin();
+  if (need_forecast)
+    fetchForcast(city);
+  if (need_history)
+    fetchHistorical(city, param);
+  if (need_forecast || need_history)
+  {
+    power_busy_end();
+    last_refresh = millis();
+  }
+}
+
+// --- BOOT ---
+// amoled.begin() is mostly panel reset and init-sequence delays; it runs on
+// its own task while setup() allocates, loads settings and starts Wi-Fi.
+#if UI_RENDER_TASK
+static const uint32_t DISPLAY_BRINGUP_STACK = 6144;
+static TaskHandle_t setup_task;
+static volatile bool display_ok = false;
+
+static void display_bringup_task(void *arg)
+{
+  (void)arg;
+  display_ok = amoled.begin();
+  boot_mark("display up");
+  xTaskNotifyGive(setup_task);
+  vTaskDelete(NULL);
+}
+
+static void display_bringup_start()
+{
+  setup_task = xTaskGetCurrentTaskHandle();
+  // Same core as setup(), so the SPI and I2C interrupts land where they always did
+  if (xTaskCreatePinnedToCore(display_bringup_task, "display_up", DISPLAY_BRINGUP_STACK, NULL,
+                              uxTaskPriorityGet(NULL), NULL, UI_RENDER_CORE) != pdPASS)
+  {
+    display_ok = amoled.begin();
+    boot_mark("display up");
+    xTaskNotifyGive(setup_task);
+  }
+}
+
+static bool display_bringup_wait()
+{
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  return display_ok;
+}
+#else
+static bool display_ok = false;
+
+static void display_bringup_start()
+{
+  display_ok = amoled.begin();
+  boot_mark("display up");
+}
+
+static bool display_bringup_wait()
+{
+  return display_ok;
+}
+#endif
+
+static void allocate_history()
 {
   for (int i = 0; i < CITY_COUNT; ++i)
   {
@@ -882,62 +1731,122 @@ void setup()
       cities[i].history[j].values = (float *)ps_malloc(HistoricalSeries::MAX_HOURS * sizeof(float));
       cities[i].history[j].timestamps = (unsigned long long *)ps_malloc(HistoricalSeries::MAX_HOURS * sizeof(unsigned long long));
 
-      if (cities[i].history[j].values == nullptr || cities[i].history[j].timestamps == nullptr)
+      if (cities[i].history[j].values == nullptr || cities[i].history[j].timestamps == nullptr ||
+          !history_index_alloc(cities[i].history[j]))
       {
         Serial.println("FATAL: Failed to allocate historical data memory!");
         while (true)
           ;
       }
-      
     }
   }
+  history_staging.values = (float *)ps_malloc(HistoricalSeries::MAX_HOURS * sizeof(float));
+  history_staging.timestamps = (unsigned long long *)ps_malloc(HistoricalSeries::MAX_HOURS * sizeof(unsigned long long));
+  if (history_staging.values == nullptr || history_staging.timestamps == nullptr || !history_index_alloc(history_staging))
+  {
+    Serial.println("FATAL: Failed to allocate historical data memory!");
+    while (true)
+      ;
+  }
+}
+
+void setup()
+{
+  boot_mark("setup");
+  KioskWake kiosk_wake = KIOSK_MODE ? kiosk_begin() : KIOSK_WAKE_COLD;
+  display_bringup_start();
+
+  // Everything up to display_bringup_wait() overlaps the panel bring-up
   Serial.begin(115200);
-  delay(200);
+  allocate_history();
+  boot_mark("history buffers");
+
+  if (!lv_trace_init())
+  {
+    Serial.println("Failed to allocate the trace buffer, tracing disabled.");
+  }
+
+  if (!decimation_cache_init())
+  {
+    Serial.println("Failed to allocate the chart decimation cache, whole-period view disabled.");
+  }
 
-  if (!amoled.begin())
+  if (!history_overlay_init())
+  {
+    Serial.println("Failed to allocate the history overlay, overlay view disabled.");
+  }
+
+  get_saved_preferences();
+  forecast_verify_begin();
+  bool kiosk_restored = kiosk_wake != KIOSK_WAKE_COLD &&
+                        kiosk_restore(cities, CITY_COUNT, PARAM_COUNT, selectedCityIndex, selectedParamIndex);
+  if (kiosk_restored)
+    history_index_build(cities[selectedCityIndex].history[selectedParamIndex],
+                        history_thresholds[selectedParamIndex].value);
+  boot_mark("preferences");
+
+  // Association and DHCP run in the background from here
+  if (!kiosk_restored || kiosk_refresh_due())
+    wifi_start();
+  boot_mark("wifi started");
+
+  if (!display_bringup_wait())
   {
     Serial.println("Failed to init LilyGO AMOLED.");
     while (true)
       delay(1000);
   }
+  time_service_begin();
   beginLvglHelper(amoled);
-  get_saved_preferences();
+  lvglSetTouchNotify(ui_wake);
+  auto_brightness_init(auto_brightness, amoled.getBrightness());
+  brightness_wanted = amoled.getBrightness();
+  brightness_posted = brightness_wanted;
+  battery_policy_init(battery_policy);
+  frame_stats_attach(lv_disp_get_default());
+  boot_mark("lvgl");
   create_ui();
+  boot_mark("ui built");
 
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-  Serial.printf("Connecting to WiFi SSID: %s\n", WIFI_SSID);
-  update_wifi_status();
-}
-
-void loop()
-{
-  if (ui_updated)
+  // Woken from deep sleep: show the snapshot's forecast rather than the boot tile
+  if (kiosk_restored)
   {
+    lv_obj_set_tile(tileview, t1, LV_ANIM_OFF);
     update_ui();
-    ui_updated = false;
   }
-
-  lv_timer_handler();
-  if (millis() - last_wifi_update > 500)
+  lv_refr_now(NULL);
+  boot_mark("first frame");
+  kiosk_frame_shown();
+  if (kiosk_restored)
   {
-    update_wifi_status();
-    last_wifi_update = millis();
+    Serial.printf("Kiosk wake: snapshot of %s drawn in %.1f ms\n", cities[selectedCityIndex].name, micros() / 1000.0f);
   }
-
-  // Re-fetch data if the user changes city or parameter
-  if (cities[selectedCityIndex].loaded_forcast != true)
+  boot_timeline_print(serial_write, nullptr);
+  lv_mem_hybrid_stats_t boot_mem;
+  lv_mem_hybrid_get_stats(&boot_mem);
+  Serial.printf("LVGL arena at first frame: %u/%u bytes used, %u small allocs in PSRAM\n", (unsigned)boot_mem.pool_used,
+                (unsigned)boot_mem.pool_size, (unsigned)boot_mem.small_fallbacks);
+
+  PowerMode power_mode = power_begin();
+  if (UI_RENDER_TASK && power_mode == POWER_MODE_NONE)
+    Serial.println("esp_pm unavailable in this SDK build, idling at full clock.");
+  else if (UI_RENDER_TASK && power_mode == POWER_MODE_DFS)
+    Serial.println("Light sleep unavailable in this SDK build, idling at a reduced clock.");
+
+  if (UI_RENDER_TASK && !ui_task_start(render_step, io_step, IO_POLL_MS))
   {
-    if (fetchForcast(selectedCityIndex))
-    {
-      update_ui();
-    }
-  }
-  if (cities[selectedCityIndex].loaded_historical[selectedParamIndex] != true)
-  {
-    if (fetchHistorical(selectedCityIndex, selectedParamIndex))
-    {
-      update_ui();
-    }
+    Serial.println("FATAL: Failed to start the render and I/O tasks!");
+    while (true)
+      delay(1000);
   }
 }
+
+void loop()
+{
+#if UI_RENDER_TASK
+  vTaskDelete(NULL); // The render and I/O tasks took over
+#else
+  io_step();
+  render_step();
+#endif
+}
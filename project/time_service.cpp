@@ -0,0 +1,246 @@
+#include "time_service.h"
+
+#include <Arduino.h>
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "ui_task.h"
+
+#if UI_RENDER_TASK
+#include <LilyGo_AMOLED.h>
+#include <esp_sntp.h>
+
+extern LilyGo_Class amoled;
+#endif
+
+static const int TIME_ZONE_YEARS = TIME_ZONE_LAST_YEAR - TIME_ZONE_FIRST_YEAR + 1;
+static const int TIME_CACHE_SIZE = 32; // Power of two, a day and a bit of slider travel
+
+// DST start and end of each year, UTC seconds
+struct DstSpan
+{
+  int64_t start;
+  int64_t end;
+};
+static DstSpan dst_spans[TIME_ZONE_YEARS];
+
+struct HourCacheEntry
+{
+  int64_t hour; // UTC epoch hour, -1 if empty
+  char text[24];
+};
+static HourCacheEntry hour_cache[TIME_CACHE_SIZE];
+static uint32_t cache_hits = 0;
+static uint32_t cache_misses = 0;
+
+enum TimeSource
+{
+  TIME_SOURCE_NONE = 0,
+  TIME_SOURCE_RTC,
+  TIME_SOURCE_SNTP
+};
+static const char *time_source_names[] = {"none", "RTC", "SNTP"};
+static TimeSource source = TIME_SOURCE_NONE;
+static std::atomic<uint32_t> sntp_syncs(0); // Bumped by the SNTP callback
+static uint32_t syncs_seen = 0;
+static uint32_t rtc_corrections = 0;
+static int32_t last_drift_s = 0;
+
+// Days since 1970-01-01 for a proleptic Gregorian date (H. Hinnant's algorithm)
+static int64_t days_from_civil(int y, unsigned m, unsigned d)
+{
+  y -= m <= 2;
+  const int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const unsigned yoe = (unsigned)(y - era * 400);
+  const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int64_t)doe - 719468;
+}
+
+static void civil_from_days(int64_t z, int &y, unsigned &m, unsigned &d)
+{
+  z += 719468;
+  const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const unsigned doe = (unsigned)(z - era * 146097);
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const unsigned mp = (5 * doy + 2) / 153;
+  d = doy - (153 * mp + 2) / 5 + 1;
+  m = mp < 10 ? mp + 3 : mp - 9;
+  y = (int)(yoe + era * 400) + (m <= 2);
+}
+
+static int64_t floor_div(int64_t a, int64_t b)
+{
+  return a / b - (a % b != 0 && (a < 0) != (b < 0));
+}
+
+// 01:00 UTC on the last Sunday of `month` (31 days in both March and October)
+static int64_t last_sunday_0100(int year, unsigned month)
+{
+  int64_t last = days_from_civil(year, month, 31);
+  int64_t weekday = ((last + 4) % 7 + 7) % 7; // 1970-01-01 was a Thursday, 0 = Sunday
+  return (last - weekday) * 86400 + 3600;
+}
+
+int32_t time_local_offset_s(int64_t utc_s)
+{
+  int y;
+  unsigned m, d;
+  civil_from_days(floor_div(utc_s, 86400), y, m, d);
+  DstSpan span;
+  if (y >= TIME_ZONE_FIRST_YEAR && y <= TIME_ZONE_LAST_YEAR)
+    span = dst_spans[y - TIME_ZONE_FIRST_YEAR];
+  else
+    span = {last_sunday_0100(y, 3), last_sunday_0100(y, 10)};
+  return utc_s >= span.start && utc_s < span.end ? TIME_ZONE_DST_S : TIME_ZONE_STANDARD_S;
+}
+
+void time_format_hour(unsigned long long timestamp_ms, char *output, size_t output_size)
+{
+  int64_t hour = (int64_t)(timestamp_ms / 3600000ULL);
+  HourCacheEntry &entry = hour_cache[hour & (TIME_CACHE_SIZE - 1)];
+  if (entry.hour != hour)
+  {
+    int64_t local = hour * 3600 + time_local_offset_s(hour * 3600);
+    int y;
+    unsigned m, d;
+    civil_from_days(floor_div(local, 86400), y, m, d);
+    snprintf(entry.text, sizeof(entry.text), "%04d-%02u-%02u %02d:00", y, m, d,
+             (int)(local - floor_div(local, 86400) * 86400) / 3600);
+    entry.hour = hour;
+    cache_misses++;
+  }
+  else
+  {
+    cache_hits++;
+  }
+  snprintf(output, output_size, "%s", entry.text);
+}
+
+bool time_parse_iso8601(const char *text, int64_t &utc_s)
+{
+  int y, hh, mm, ss;
+  unsigned m, d;
+  if (!text || sscanf(text, "%4d-%2u-%2uT%2d:%2d:%2d", &y, &m, &d, &hh, &mm, &ss) != 6 || m < 1 || m > 12 ||
+      d < 1 || d > 31)
+    return false;
+  utc_s = days_from_civil(y, m, d) * 86400 + hh * 3600 + mm * 60 + ss;
+  return true;
+}
+
+int64_t time_age_s(unsigned long long timestamp_ms)
+{
+  if (!time_service_valid())
+    return -1;
+  return (int64_t)time(nullptr) - (int64_t)(timestamp_ms / 1000ULL);
+}
+
+bool time_service_valid()
+{
+  return source != TIME_SOURCE_NONE;
+}
+
+#if UI_RENDER_TASK
+static bool sync_started = false;
+
+static void sntp_synced(struct timeval *tv)
+{
+  (void)tv;
+  sntp_syncs.fetch_add(1);
+}
+
+static int64_t rtc_read(bool &running)
+{
+  RTC_DateTime now = amoled.getDateTime();
+  running = now.available && now.year >= 2024;
+  return days_from_civil(now.year, now.month, now.day) * 86400 + now.hour * 3600 + now.minute * 60 + now.second;
+}
+
+static void rtc_write(int64_t utc_s)
+{
+  int y;
+  unsigned m, d;
+  int64_t days = floor_div(utc_s, 86400);
+  int64_t secs = utc_s - days * 86400;
+  civil_from_days(days, y, m, d);
+  amoled.setDateTime(y, m, d, secs / 3600, (secs / 60) % 60, secs % 60);
+}
+
+static void seed_from_rtc()
+{
+  if (!amoled.hasRTC())
+    return;
+  bool running;
+  int64_t utc_s = rtc_read(running);
+  if (!running)
+    return;
+  // Deep sleep keeps the system clock; only a cold start needs the RTC
+  if (time(nullptr) < utc_s - (int64_t)TIME_RTC_MAX_DRIFT_S)
+  {
+    struct timeval tv = {(time_t)utc_s, 0};
+    settimeofday(&tv, nullptr);
+  }
+  source = TIME_SOURCE_RTC;
+}
+
+void time_service_start_sync()
+{
+  if (sync_started)
+    return;
+  sync_started = true;
+  sntp_set_time_sync_notification_cb(sntp_synced);
+  configTime(0, 0, "pool.ntp.org", "time.google.com");
+}
+
+void time_service_poll()
+{
+  uint32_t syncs = sntp_syncs.load();
+  if (syncs == syncs_seen)
+    return;
+  syncs_seen = syncs;
+  source = TIME_SOURCE_SNTP;
+  if (!amoled.hasRTC())
+    return;
+
+  bool running;
+  int64_t now = time(nullptr);
+  int64_t rtc = rtc_read(running);
+  last_drift_s = (int32_t)(rtc - now);
+  if (!running || llabs(rtc - now) > (int64_t)TIME_RTC_MAX_DRIFT_S)
+  {
+    rtc_write(now);
+    rtc_corrections++;
+  }
+}
+#else
+static void seed_from_rtc() {}
+void time_service_start_sync() {}
+void time_service_poll() {}
+#endif
+
+void time_service_begin()
+{
+  for (int i = 0; i < TIME_ZONE_YEARS; i++)
+  {
+    dst_spans[i].start = last_sunday_0100(TIME_ZONE_FIRST_YEAR + i, 3);
+    dst_spans[i].end = last_sunday_0100(TIME_ZONE_FIRST_YEAR + i, 10);
+  }
+  for (int i = 0; i < TIME_CACHE_SIZE; i++)
+    hour_cache[i].hour = -1;
+  seed_from_rtc();
+}
+
+void time_service_log()
+{
+  uint32_t lookups = cache_hits + cache_misses;
+  Serial.printf("Time: source %s, %u SNTP syncs, RTC drift %d s at last sync, %u RTC corrections; "
+                "hour format cache %u/%u hits\n",
+                time_source_names[source], (unsigned)syncs_seen, (int)last_drift_s, (unsigned)rtc_corrections,
+                (unsigned)cache_hits, (unsigned)lookups);
+  cache_hits = 0;
+  cache_misses = 0;
+}
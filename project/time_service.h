@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Wall clock and local time. At boot the system clock is seeded from
+ *        the PCF85063 RTC when its oscillator has kept running; once Wi-Fi is
+ *        up SNTP takes over, and every sync writes the RTC back if it drifted.
+ *
+ *        Displayed timestamps are Europe/Stockholm local time. The zone's DST
+ *        transitions (last Sunday of March and October, 01:00 UTC) are
+ *        computed once for TIME_ZONE_FIRST_YEAR..TIME_ZONE_LAST_YEAR, and
+ *        formatted hours are kept in a small cache keyed by the epoch hour, so
+ *        scrubbing the history slider formats each hour once.
+ */
+static const int TIME_ZONE_FIRST_YEAR = 2000;
+static const int TIME_ZONE_LAST_YEAR = 2099;
+static const int32_t TIME_ZONE_STANDARD_S = 3600; // CET
+static const int32_t TIME_ZONE_DST_S = 7200;      // CEST
+static const uint32_t TIME_RTC_MAX_DRIFT_S = 1;   // RTC is rewritten beyond this
+
+// Precomputes the zone table and seeds the clock from the RTC; call once in setup()
+void time_service_begin();
+
+// Starts SNTP; repeated calls are ignored. Call once the network is up.
+void time_service_start_sync();
+
+// I/O task: after a new SNTP sync, compares the RTC with the system clock and corrects it
+void time_service_poll();
+
+// True once the wall clock came from SNTP or a running RTC
+bool time_service_valid();
+
+// UTC offset in seconds for Europe/Stockholm at `utc_s`
+int32_t time_local_offset_s(int64_t utc_s);
+
+// "YYYY-MM-DD HH:00" in local time for a timestamp in ms since the epoch
+void time_format_hour(unsigned long long timestamp_ms, char *output, size_t output_size);
+
+// Parses "YYYY-MM-DDTHH:MM:SSZ" into UTC seconds since the epoch
+bool time_parse_iso8601(const char *text, int64_t &utc_s);
+
+// Seconds from `timestamp_ms` until now, or -1 while the wall clock is unknown
+int64_t time_age_s(unsigned long long timestamp_ms);
+
+// Prints sync state, RTC corrections and the format cache hit rate
+void time_service_log();
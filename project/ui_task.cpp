@@ -0,0 +1,258 @@
+#include "ui_task.h"
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "power.h"
+
+#if UI_RENDER_TASK
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+static const uint32_t UI_RENDER_STACK = 8192;
+static const uint32_t UI_IO_STACK = 8192; // What the Arduino loop task had for HTTPS + JSON
+static const UBaseType_t UI_RENDER_PRIORITY = 2; // Above the Arduino loop and the I/O task
+static const UBaseType_t UI_IO_PRIORITY = 1;
+#endif
+
+// --- Message queue ---
+// Bounded queue after D. Vyukov: every cell carries a sequence number that
+// tells producers and consumers whose turn it is, so posting and receiving
+// are a compare-and-swap each and never block.
+static const uint32_t UI_QUEUE_MASK = UI_QUEUE_SIZE - 1;
+static_assert((UI_QUEUE_SIZE & (UI_QUEUE_SIZE - 1)) == 0, "UI_QUEUE_SIZE must be a power of two");
+
+struct UiQueueCell
+{
+  std::atomic<uint32_t> seq;
+  UiMsg msg;
+};
+
+static UiQueueCell queue_cells[UI_QUEUE_SIZE];
+static std::atomic<uint32_t> queue_head(0); // Next cell to post to
+static std::atomic<uint32_t> queue_tail(0); // Next cell to receive from
+static std::atomic<uint32_t> queue_peak(0);
+static std::atomic<uint32_t> queue_drops(0);
+
+static bool queue_init()
+{
+  for (uint32_t i = 0; i < (uint32_t)UI_QUEUE_SIZE; i++)
+    queue_cells[i].seq.store(i, std::memory_order_relaxed);
+  return true;
+}
+static bool queue_ready = queue_init();
+
+bool ui_post(const UiMsg &msg)
+{
+  uint32_t pos = queue_head.load(std::memory_order_relaxed);
+  UiQueueCell *cell;
+  for (;;)
+  {
+    cell = &queue_cells[pos & UI_QUEUE_MASK];
+    int32_t turn = (int32_t)(cell->seq.load(std::memory_order_acquire) - pos);
+    if (turn == 0)
+    {
+      if (queue_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (turn < 0)
+    {
+      queue_drops.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    else
+    {
+      pos = queue_head.load(std::memory_order_relaxed);
+    }
+  }
+  cell->msg = msg;
+  cell->seq.store(pos + 1, std::memory_order_release);
+  ui_wake();
+
+  uint32_t depth = pos + 1 - queue_tail.load(std::memory_order_relaxed);
+  uint32_t peak = queue_peak.load(std::memory_order_relaxed);
+  while (depth > peak && !queue_peak.compare_exchange_weak(peak, depth, std::memory_order_relaxed))
+    ;
+  return true;
+}
+
+bool ui_receive(UiMsg &msg)
+{
+  uint32_t pos = queue_tail.load(std::memory_order_relaxed);
+  UiQueueCell *cell;
+  for (;;)
+  {
+    cell = &queue_cells[pos & UI_QUEUE_MASK];
+    int32_t turn = (int32_t)(cell->seq.load(std::memory_order_acquire) - (pos + 1));
+    if (turn == 0)
+    {
+      if (queue_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (turn < 0)
+    {
+      return false;
+    }
+    else
+    {
+      pos = queue_tail.load(std::memory_order_relaxed);
+    }
+  }
+  msg = cell->msg;
+  cell->seq.store(pos + UI_QUEUE_SIZE, std::memory_order_release);
+  return true;
+}
+
+// --- Tasks ---
+
+struct UiTaskStats
+{
+  uint32_t steps;
+  uint32_t overruns;   // Steps that took longer than the render period
+  uint32_t max_us;
+  uint32_t idle_waits; // Waits longer than a frame
+  uint64_t idle_ms;    // Sum of the requested idle waits
+};
+static UiTaskStats render_stats;
+static std::atomic<uint32_t> render_period_ms(UI_RENDER_PERIOD_MS);
+
+void ui_set_render_period(uint32_t period_ms)
+{
+  render_period_ms.store(period_ms);
+}
+
+#if UI_RENDER_TASK
+static SemaphoreHandle_t ui_mutex;
+static TaskHandle_t render_handle;
+static TaskHandle_t io_handle;
+static std::atomic<uint32_t> wake_raised_us(0);
+static uint32_t (*render_fn)();
+static void (*io_fn)();
+static uint32_t io_period_ms;
+
+void ui_lock()
+{
+  if (ui_mutex)
+    xSemaphoreTakeRecursive(ui_mutex, portMAX_DELAY);
+}
+
+void ui_unlock()
+{
+  if (ui_mutex)
+    xSemaphoreGiveRecursive(ui_mutex);
+}
+
+void ui_wake()
+{
+  if (!render_handle)
+    return;
+  uint32_t none = 0;
+  wake_raised_us.compare_exchange_strong(none, micros() | 1);
+  xTaskNotifyGive(render_handle);
+}
+
+void ui_io_wake()
+{
+  if (io_handle)
+    xTaskNotifyGive(io_handle);
+}
+
+static void render_task(void *arg)
+{
+  (void)arg;
+  TickType_t wake = xTaskGetTickCount();
+  for (;;)
+  {
+    // Wake-ups raised from here on are for work this step may not see yet
+    ulTaskNotifyTake(pdTRUE, 0);
+    wake_raised_us.store(0);
+
+    uint32_t start = micros();
+    power_busy_begin();
+    ui_lock();
+    uint32_t idle_ms = render_fn();
+    ui_unlock();
+    power_busy_end();
+    uint32_t us = micros() - start;
+    render_stats.steps++;
+    if (us > render_stats.max_us)
+      render_stats.max_us = us;
+
+    uint32_t period_ms = render_period_ms.load();
+    if (idle_ms <= period_ms)
+    {
+      // Animating, scrolling or touched. Late: skip the missed slots instead of running back to back
+      if (xTaskDelayUntil(&wake, pdMS_TO_TICKS(period_ms)) == pdFALSE)
+      {
+        render_stats.overruns++;
+        wake = xTaskGetTickCount();
+      }
+      continue;
+    }
+
+    // Idle: nothing for LVGL until its next timer, unless a message or touch arrives first
+    if (idle_ms > UI_IDLE_MAX_MS)
+      idle_ms = UI_IDLE_MAX_MS;
+    render_stats.idle_waits++;
+    render_stats.idle_ms += idle_ms;
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idle_ms)) > 0)
+    {
+      uint32_t raised = wake_raised_us.load();
+      if (raised)
+        power_record_wake(micros() - raised);
+    }
+    wake = xTaskGetTickCount();
+  }
+}
+
+static void io_task(void *arg)
+{
+  (void)arg;
+  for (;;)
+  {
+    io_fn();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(io_period_ms));
+  }
+}
+
+bool ui_task_start(uint32_t (*render_step)(), void (*io_step)(), uint32_t io_period)
+{
+  ui_mutex = xSemaphoreCreateRecursiveMutex();
+  if (!ui_mutex)
+    return false;
+  render_fn = render_step;
+  io_fn = io_step;
+  io_period_ms = io_period;
+  if (xTaskCreatePinnedToCore(render_task, "ui_render", UI_RENDER_STACK, NULL, UI_RENDER_PRIORITY, &render_handle,
+                              UI_RENDER_CORE) != pdPASS)
+    return false;
+  return xTaskCreatePinnedToCore(io_task, "ui_io", UI_IO_STACK, NULL, UI_IO_PRIORITY, &io_handle, UI_IO_CORE) == pdPASS;
+}
+#else
+void ui_lock() {}
+void ui_unlock() {}
+void ui_wake() {}
+void ui_io_wake() {}
+
+bool ui_task_start(uint32_t (*render_step)(), void (*io_step)(), uint32_t io_period)
+{
+  (void)render_step;
+  (void)io_step;
+  (void)io_period;
+  return false;
+}
+#endif
+
+void ui_task_log()
+{
+  (void)queue_ready;
+  Serial.printf("Render task: %u steps, max %.1f ms, %u over %u ms, %u idle waits (avg %u ms); "
+                "queue peak %u/%d, %u dropped\n",
+                render_stats.steps, render_stats.max_us / 1000.0f, render_stats.overruns, (unsigned)render_period_ms.load(),
+                render_stats.idle_waits,
+                render_stats.idle_waits ? (unsigned)(render_stats.idle_ms / render_stats.idle_waits) : 0,
+                queue_peak.load(), UI_QUEUE_SIZE, queue_drops.load());
+  memset(&render_stats, 0, sizeof(render_stats));
+  queue_peak.store(0);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Threading model of the sketch. A render task pinned to
+ *        UI_RENDER_CORE owns LVGL and calls the render step at a fixed
+ *        cadence; an I/O task on the other core fetches data and samples
+ *        sensors every poll period, or sooner when woken by ui_io_wake().
+ *        Other tasks never touch widgets directly, they post a UiMsg that the
+ *        render step drains. Shared data (cities[]) and any LVGL call made
+ *        outside the render step are guarded by ui_lock()/ui_unlock().
+ *
+ *        The render step returns how long LVGL can wait (lv_timer_handler()).
+ *        While that is within a frame the task keeps a steady cadence; when
+ *        the UI is idle it blocks until that deadline or until ui_wake(), so
+ *        the power governor can drop the clock or light sleep in between.
+ *
+ *        The host build has no tasks: loop() runs both steps in turn, the
+ *        lock is a no-op and the queue behaves the same.
+ */
+#ifdef HOST_BUILD
+#define UI_RENDER_TASK 0
+#else
+#define UI_RENDER_TASK 1
+#endif
+
+static const int UI_RENDER_CORE = 1;        // Same core as the Arduino loop, Wi-Fi stays on core 0
+static const int UI_IO_CORE = 0;
+static const uint32_t UI_RENDER_PERIOD_MS = 16; // Default cadence, matches LV_DISP_DEF_REFR_PERIOD
+static const uint32_t UI_IDLE_MAX_MS = 1000;    // Longest idle wait, keeps the stats log on time
+static const int UI_QUEUE_SIZE = 16;        // Power of two
+
+enum UiMsgType : uint8_t
+{
+  UI_MSG_FORECAST_READY = 0, // cities[city].forecast was replaced
+  UI_MSG_HISTORY_READY,      // cities[city].history[param] was replaced
+  UI_MSG_WIFI_STATUS,        // Connection came up or went down
+  UI_MSG_BRIGHTNESS,         // Auto-brightness picked a new panel level
+  UI_MSG_BATTERY_TIER        // The battery policy moved to another BatteryTier
+};
+
+struct UiMsg
+{
+  UiMsgType type;
+  union
+  {
+    struct
+    {
+      uint8_t city;
+    } forecast;
+    struct
+    {
+      uint8_t city;
+      uint8_t param;
+    } history;
+    struct
+    {
+      bool connected;
+      uint8_t ip[4];
+      char ssid[33];
+    } wifi;
+    struct
+    {
+      uint8_t level;
+    } brightness;
+    struct
+    {
+      uint8_t tier;
+    } battery;
+  };
+};
+
+// Recursive, so a render step that is already holding it may call helpers that lock again
+void ui_lock();
+void ui_unlock();
+
+// Lock-free, any number of producers and consumers; false (and counted) when the queue is full.
+// Wakes the render task.
+bool ui_post(const UiMsg &msg);
+bool ui_receive(UiMsg &msg);
+
+// Ends an idle wait of the render task early, e.g. on touch input; any task, not ISRs
+void ui_wake();
+
+// Runs the I/O step now instead of after the rest of its poll period; any task, not ISRs
+void ui_io_wake();
+
+// Frame cadence of the render task while LVGL is busy; any task
+void ui_set_render_period(uint32_t period_ms);
+
+// Starts the render and I/O tasks; both steps run forever. Returns false on the host
+// or if a task could not be created, in which case the caller drives the steps itself.
+bool ui_task_start(uint32_t (*render_step)(), void (*io_step)(), uint32_t io_period_ms);
+
+// Prints worst render step time, missed frames, idle waits and queue high water mark, then starts over
+void ui_task_log();
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdint.h>
+
+// --- WEATHER STRUCTURES ---
+struct WeatherCondition
+{
+  enum Value : int
+  {
+    Unknown = 0,
+    ClearSky = 1,
+    NearlyClearSky = 2,
+    VariableCloudiness = 3,
+    HalfClearSky = 4,
+    CloudySky = 5,
+    Overcast = 6,
+    Fog = 7,
+    LightRainShowers = 8,
+    ModerateRainShowers = 9,
+    HeavyRainShowers = 10,
+    Thunderstorm = 11,
+    LightSleetShowers = 12,
+    ModerateSleetShowers = 13,
+    HeavySleetShowers = 14,
+    LightSnowShowers = 15,
+    ModerateSnowShowers = 16,
+    HeavySnowShowers = 17,
+    LightRain = 18,
+    ModerateRain = 19,
+    HeavyRain = 20,
+    Thunder = 21,
+    LightSleet = 22,
+    ModerateSleet = 23,
+    HeavySleet = 24,
+    LightSnowfall = 25,
+    ModerateSnowfall = 26,
+    HeavySnowfall = 27
+  };
+  Value value;
+  WeatherCondition() = default;
+  WeatherCondition(int code) { value = static_cast<Value>(code); }
+};
+
+const int FORCAST_TIMESTAMP_SIZE = 20;
+
+struct ForcastHourlyWeather
+{
+  float temperature;
+  char time[FORCAST_TIMESTAMP_SIZE + 1];
+  WeatherCondition weatherCondition;
+};
+
+struct Parameter
+{
+  const char *label;
+  const char *apiCode;
+};
+
+// Prefix aggregates over a series' first `count` values, see history_index.h.
+// Entry i covers values[0, i); sums are of (value - shift) to keep precision.
+struct HistoryIndex
+{
+  double *sums = nullptr;    // MAX_HOURS + 1 entries each
+  double *squares = nullptr;
+  uint16_t *below = nullptr; // Values under `threshold`
+  float shift = 0;
+  float threshold = 0;
+  int count = 0;
+};
+
+struct HistoricalSeries
+{
+  static constexpr int MAX_HOURS = 4000;
+  float *values = nullptr;
+  unsigned long long *timestamps = nullptr;
+  int count = 0;
+  bool isLoaded = false;
+  HistoryIndex index;
+};
+
+struct City
+{
+  const char *name;
+  const char *lat;
+  const char *lon;
+  const char *stationID;
+  ForcastHourlyWeather forecast[7];
+  HistoricalSeries history[4];
+  bool loaded_forcast;
+  bool loaded_historical[4];
+};
@@ -0,0 +1,3862 @@
+/*
+ * Weather condition icons, 32x32 LV_IMG_CF_TRUE_COLOR_ALPHA (RGB565 + alpha).
+ * Generated by scripts/gen_weather_icons.py - do not edit.
+ */
+#include "weather_icons.h"
+
+#if LV_COLOR_DEPTH != 16
+#error "weather_icons.c is generated for LV_COLOR_DEPTH 16"
+#endif
+
+/* RGB565 in the byte order LVGL expects, followed by the alpha byte */
+#if LV_COLOR_16_SWAP == 0
+#define P(c, a) ((c) & 0xFF), ((c) >> 8), (a)
+#else
+#define P(c, a) ((c) >> 8), ((c) & 0xFF), (a)
+#endif
+#define T 0, 0, 0
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_unknown_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x40), P(0x9cf3, 0x70), P(0x9cf3, 0x80),
+    P(0x9cf3, 0x80), P(0x9cf3, 0x70), P(0x9cf3, 0x40), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x9cf3, 0x40), P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), P(0x9cf3, 0x40), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0x10), P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf), P(0x9cf3, 0x10),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x9cf3, 0x30),
+    P(0x9cf3, 0xef), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), P(0x9cf3, 0x50), P(0x9cf3, 0x20), T,
+    T, P(0x9cf3, 0x20), P(0x9cf3, 0x50), P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xef),
+    P(0x9cf3, 0x30), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xef),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf), P(0x9cf3, 0x20), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x20), P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xef), P(0x9cf3, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x10), P(0x9cf3, 0xef), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x9cf3, 0x60), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xef), P(0x9cf3, 0x10), T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x9cf3, 0x60),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf), T, T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x40), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x40), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x20),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0x20), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), T, T, T, T,
+    T, T, T, P(0x9cf3, 0x40), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x50), T,
+    T, T, T, T, T, T, P(0x9cf3, 0x10), P(0x9cf3, 0x70),
+    P(0x9cf3, 0x70), P(0x9cf3, 0x10), T, T, T, T, T, T,
+    T, P(0x9cf3, 0x50), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x40), T, T, T,
+    T, T, T, P(0x9cf3, 0x70), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x20), T,
+    T, T, T, T, T, P(0x9cf3, 0x10), P(0x9cf3, 0xef), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xef), P(0x9cf3, 0x10), T, T, T, T, T,
+    T, P(0x9cf3, 0x20), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x70), T, T, T,
+    T, T, T, P(0x9cf3, 0x80), P(0x9cf3, 0xff), P(0x9cf3, 0xff), T, T,
+    T, T, T, T, T, P(0x9cf3, 0x70), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x70), T, T, T, T, T,
+    T, T, P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x80), T, T, T,
+    T, T, T, P(0x9cf3, 0x80), P(0x9cf3, 0xff), P(0x9cf3, 0xff), T, T,
+    T, T, T, T, T, P(0x9cf3, 0x70), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x70), T, T, T, T, T,
+    T, T, P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x80), T, T, T,
+    T, T, T, P(0x9cf3, 0x70), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x20), T,
+    T, T, T, T, T, P(0x9cf3, 0x10), P(0x9cf3, 0xef), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xef), P(0x9cf3, 0x10), T, T, T, T, T,
+    T, P(0x9cf3, 0x20), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x70), T, T, T,
+    T, T, T, P(0x9cf3, 0x40), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x50), T,
+    T, T, T, T, T, T, P(0x9cf3, 0x10), P(0x9cf3, 0x70),
+    P(0x9cf3, 0x70), P(0x9cf3, 0x10), T, T, T, T, T, T,
+    T, P(0x9cf3, 0x50), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x40), T, T, T,
+    T, T, T, T, P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x20),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0x20), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x40), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x40), T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x9cf3, 0x60),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf), T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x10), P(0x9cf3, 0xef), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x9cf3, 0x60), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xef), P(0x9cf3, 0x10), T, T, T, T, T,
+    T, T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xef),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf), P(0x9cf3, 0x20), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x20), P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xef), P(0x9cf3, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x9cf3, 0x30),
+    P(0x9cf3, 0xef), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), P(0x9cf3, 0x50), P(0x9cf3, 0x20), T,
+    T, P(0x9cf3, 0x20), P(0x9cf3, 0x50), P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xef),
+    P(0x9cf3, 0x30), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0x10), P(0x9cf3, 0xaf), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xaf), P(0x9cf3, 0x10),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x9cf3, 0x40), P(0x9cf3, 0x9f), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x9f), P(0x9cf3, 0x40), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x40), P(0x9cf3, 0x70), P(0x9cf3, 0x80),
+    P(0x9cf3, 0x80), P(0x9cf3, 0x70), P(0x9cf3, 0x40), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_unknown = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_unknown_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_clear_sky_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0x80),
+    P(0xfdc2, 0x80), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0x9f), P(0xfdc2, 0x10),
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    P(0xfdc2, 0x10), P(0xfdc2, 0x9f), P(0xfdc2, 0x30), T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x9f), P(0xfdc2, 0xff), P(0xfdc2, 0xcf),
+    P(0xfdc2, 0x10), T, T, T, T, T, T, P(0xfdc2, 0x9f),
+    P(0xfdc2, 0x9f), T, T, T, T, T, T, P(0xfdc2, 0x10),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0x9f), T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0x10),
+    P(0xfdc2, 0xaf), P(0xfdc2, 0x80), T, T, P(0xfdc2, 0x20), P(0xfdc2, 0x8f), P(0xfdc2, 0xcf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x8f), P(0xfdc2, 0x20), T, T, P(0xfdc2, 0x80), P(0xfdc2, 0xaf),
+    P(0xfdc2, 0x10), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xfdc2, 0x60), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x60), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x20), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x8f), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x8f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x9f), T,
+    T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), T,
+    T, P(0xfdc2, 0x9f), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x80), T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x9f), T,
+    T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), T,
+    T, P(0xfdc2, 0x9f), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x80), T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x8f), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x8f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x20), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x60), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xfdc2, 0x60), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0x10),
+    P(0xfdc2, 0xaf), P(0xfdc2, 0x80), T, T, P(0xfdc2, 0x20), P(0xfdc2, 0x8f), P(0xfdc2, 0xcf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x8f), P(0xfdc2, 0x20), T, T, P(0xfdc2, 0x80), P(0xfdc2, 0xaf),
+    P(0xfdc2, 0x10), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x9f), P(0xfdc2, 0xff), P(0xfdc2, 0xcf),
+    P(0xfdc2, 0x10), T, T, T, T, T, T, P(0xfdc2, 0x9f),
+    P(0xfdc2, 0x9f), T, T, T, T, T, T, P(0xfdc2, 0x10),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0x9f), T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0x9f), P(0xfdc2, 0x10),
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    P(0xfdc2, 0x10), P(0xfdc2, 0x9f), P(0xfdc2, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0x80),
+    P(0xfdc2, 0x80), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_clear_sky = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_clear_sky_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_nearly_clear_sky_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x8f), P(0xfdc2, 0x8f), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0x10), T, T,
+    T, T, T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, T,
+    T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x30), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T,
+    T, T, T, T, P(0xfdc2, 0xef), P(0xfdc2, 0xef), T, T,
+    T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10),
+    T, T, T, T, P(0xfdc2, 0x20), P(0xfdc2, 0x20), T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xaf),
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xaf), P(0xfdc2, 0x80),
+    T, T, P(0xfdc2, 0x70), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x70),
+    T, T, P(0xfdc2, 0x80), P(0xfdc2, 0xaf), P(0xfdc2, 0x10), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0x70),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x70), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xcf),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0x8f), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, P(0xfdc2, 0x20), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0x8f), T, T, T, T, T, T,
+    P(0xfdc2, 0x8f), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, P(0xfdc2, 0x20), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0x8f), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0xcf),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0x70),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x70), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xb5f8, 0x30), P(0xb5f8, 0x70), P(0xb5f8, 0x80), P(0xb5f8, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xaf), P(0xfdc2, 0x80),
+    T, T, P(0xfdc2, 0x70), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x70),
+    T, T, P(0xf5c5, 0x87), P(0xbdf4, 0xeb), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xbf), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xaf),
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xbdf5, 0xf0), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xdf), P(0xb5f8, 0x10), T, T, T, T, T,
+    T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10),
+    T, T, T, T, P(0xfdc2, 0x20), P(0xfdc2, 0x20), T, T,
+    T, P(0xb5f8, 0x60), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T, T, T, T,
+    T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T,
+    T, T, T, T, P(0xfdc2, 0xef), P(0xfdc2, 0xef), T, T,
+    P(0xb5f8, 0x10), P(0xb5f8, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xef), P(0xb5f8, 0xaf), P(0xb5f8, 0x30), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0x10), T, T,
+    T, T, T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, P(0xb5f8, 0x8f),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x40), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xb5f8, 0x8f), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xb5f8, 0xef), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x8f), P(0xfdc2, 0x8f), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xb5f8, 0x50),
+    P(0xb5f8, 0xbf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x40), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_nearly_clear_sky = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_nearly_clear_sky_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_variable_cloudiness_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x30), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T,
+    T, T, P(0xfdc2, 0xff), P(0xfdc2, 0xff), T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T,
+    T, T, P(0xfdc2, 0xcf), P(0xfdc2, 0xcf), T, T, T, T,
+    P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0x80), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, P(0xfdc2, 0x10),
+    P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0x40), T,
+    T, P(0xfdc2, 0x50), P(0xfdc2, 0x80), P(0xfdc2, 0x80), P(0xfdc2, 0x50), T, T, P(0xfdc2, 0x40),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x40), T, P(0xfdc2, 0x40),
+    P(0xfdc2, 0xdf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xdf), P(0xfdc2, 0x40), T,
+    P(0xfdc2, 0x40), P(0xfdc2, 0x10), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0x40), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0x40),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0xdf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x50), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xf5c5, 0xff),
+    P(0xbdf4, 0xb2), P(0xb5f8, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T,
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xd5cd, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xcdf0, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x9f), T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfdc2, 0x50), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0x50), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0xdf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xdf), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfdc2, 0x40), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x40), T, P(0xfdc2, 0x40),
+    P(0xfdc2, 0xdf), P(0xfdc2, 0xff), P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T,
+    T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0x40), T,
+    P(0xb5f8, 0x40), P(0xb5f7, 0xe9), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), P(0xb5f8, 0x40),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T,
+    T, T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20),
+    T, T, P(0xfdc2, 0x30), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, P(0xb5f8, 0x50), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70),
+    T, T, T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80),
+    T, T, T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70),
+    T, T, T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20),
+    T, T, T, T, T, T, T, P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T,
+    T, T, T, T, T, T, T, P(0xb5f8, 0x40),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x40), P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_variable_cloudiness = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_variable_cloudiness_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_cloudy_sky_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x10), P(0x7c93, 0x40), P(0x7c93, 0x80), P(0x7c93, 0x50), P(0x7c93, 0x20), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x80), P(0x7c93, 0xef), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x9f), P(0x7c93, 0x10),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x7c93, 0xcf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf),
+    P(0x7c93, 0x10), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xbf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x10), P(0x7c93, 0xef), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x60), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x7c93, 0x70), P(0x7c93, 0xef), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x50), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x70), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7cb4, 0xff),
+    P(0x9d56, 0xff), P(0xa5b7, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xa5b7, 0xfc), P(0xadf8, 0x96), P(0xb5f8, 0x20), T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x10), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x9536, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80),
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x9d76, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x9f), T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x70), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x8cf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0x50), T, T, T, T, T, T,
+    T, P(0x7c93, 0x30), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0xadd8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xdf), T, T, T, T, T, T,
+    T, T, P(0x7c93, 0xbf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x84d4, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T,
+    T, T, P(0x7c93, 0x10), P(0x7c93, 0xcf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x8cf5, 0xff), P(0x9d97, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T,
+    T, T, T, T, P(0x7c93, 0x60), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x8d15, 0x9f), P(0xadd8, 0xef), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T,
+    T, T, T, T, T, T, T, P(0xb5f8, 0x40),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T,
+    T, T, T, T, T, T, T, P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20),
+    T, T, T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70),
+    T, T, T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80),
+    T, T, T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70),
+    T, T, T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20),
+    T, T, T, T, T, T, T, P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T,
+    T, T, T, T, T, T, T, P(0xb5f8, 0x40),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x40), P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_cloudy_sky = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_cloudy_sky_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_overcast_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x10), P(0x7c93, 0x40), P(0x7c93, 0x80), P(0x7c93, 0x50), P(0x7c93, 0x20), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x80), P(0x7c93, 0xef), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x9f), P(0x7c93, 0x10),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x7c93, 0xcf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf),
+    P(0x7c93, 0x10), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xbf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x10), P(0x7c93, 0xef), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x60), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x7c93, 0x70), P(0x7c93, 0xef), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x50), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x70), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xfc), P(0x7c93, 0x96), P(0x7c93, 0x20), T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x10), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80),
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0x9f), T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x70), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0x50), T, T, T, T, T, T,
+    T, P(0x7c93, 0x30), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xdf), T, T, T, T, T, T,
+    T, T, P(0x7c93, 0xbf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T,
+    T, T, P(0x7c93, 0x10), P(0x7c93, 0xcf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T,
+    T, T, T, T, P(0x7c93, 0x60), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x9f), P(0x7c93, 0xef), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T,
+    T, T, T, T, T, T, T, P(0x7c93, 0x40),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T,
+    T, T, T, T, T, T, T, P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20),
+    T, T, T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70),
+    T, T, T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80),
+    T, T, T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70),
+    T, T, T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20),
+    T, T, T, T, T, T, T, P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T,
+    T, T, T, T, T, T, T, P(0x7c93, 0x40),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x40), P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x50), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_overcast = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_overcast_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_fog_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T, T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30), T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T, T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30), T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T, T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30), T, T, T, T,
+    T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30), T, T, T, T,
+    T, T, T, T, T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x9cf3, 0x30), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff),
+    P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0xff), P(0x9cf3, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x9cf3, 0x30), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40),
+    P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x40), P(0x9cf3, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_fog = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_fog_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_light_rain_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_light_rain_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_light_rain_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_moderate_rain_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T,
+    T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T,
+    T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T,
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T,
+    T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T,
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T,
+    T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_moderate_rain_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_moderate_rain_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_heavy_rain_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, P(0x24be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf),
+    P(0x24be, 0x30), T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30),
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_heavy_rain_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_heavy_rain_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_thunderstorm_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x20), P(0x7c93, 0x8f), P(0x7c93, 0xcf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x8f), P(0x7c93, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x7c93, 0x9f), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x30), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0xaf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0xacac, 0xff), P(0xfd00, 0xff), P(0xdce4, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x948f, 0xff),
+    P(0xf4e1, 0xff), P(0xfd00, 0xff), P(0xa4ad, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x8c91, 0x87), P(0xf4e2, 0xe7),
+    P(0xfd00, 0xff), P(0xf4e1, 0xef), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfd00, 0x9f), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfd00, 0x60), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xef), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0x30), T, T, P(0xfd00, 0x30), P(0xfd00, 0xef), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xcf), P(0xfd00, 0x80), P(0xfd00, 0x80), P(0xfd00, 0x80), P(0xfd00, 0x70), T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xbf), T, P(0xfd00, 0x10), P(0xfd00, 0xcf), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xef), P(0xfd00, 0x30), T, T, T,
+    T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, P(0xfd00, 0x9f), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0x30), T, T, T, T,
+    P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, P(0xfd00, 0xaf),
+    P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0x60), T, T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, T, T, P(0xfd00, 0x20), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0x60), T, T, T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, T, T, P(0xfd00, 0x70), P(0xfd00, 0xff),
+    P(0xfd00, 0x9f), T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60),
+    T, T, T, T, T, T, P(0xfd00, 0xdf), P(0xfd00, 0x9f),
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T,
+    T, T, T, T, T, P(0xfd00, 0x40), P(0xfd00, 0xcf), T,
+    T, T, T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, P(0xfd00, 0x70), P(0xfd00, 0x10), T,
+    T, T, T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf),
+    P(0x24be, 0x30), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_thunderstorm = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_thunderstorm_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_light_sleet_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T,
+    T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T,
+    T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T,
+    P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T,
+    T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T,
+    T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T,
+    P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T,
+    T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_light_sleet_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_light_sleet_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_moderate_sleet_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf),
+    P(0x24be, 0x30), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_moderate_sleet_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_moderate_sleet_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_heavy_sleet_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xbf), T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T,
+    P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), P(0x65be, 0x30), T,
+    P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x65be, 0x40), T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf),
+    P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T,
+    T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, P(0x65be, 0x60), P(0x65be, 0xdf),
+    P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, P(0x65be, 0x60), P(0x65be, 0xdf),
+    P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60),
+    T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x34fe, 0x87), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf),
+    P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T,
+    T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T,
+    T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, P(0x65be, 0x30), T,
+    P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T,
+    P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_heavy_sleet_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_heavy_sleet_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_light_snow_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_light_snow_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_light_snow_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_moderate_snow_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T,
+    T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x40),
+    P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T,
+    T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x65be, 0x40), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x40),
+    P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T,
+    T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x65be, 0x40), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T,
+    T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_moderate_snow_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_moderate_snow_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_heavy_snow_showers_map[] = {
+    T, T, T, T, T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T, T, T, P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), T, T, T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xfdc2, 0x10), T, T, P(0xfdc2, 0xef),
+    P(0xfdc2, 0xef), T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xf5c5, 0xff), P(0xc5f2, 0xc7), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xfdc2, 0xbf), T, T, P(0xfdc2, 0x20),
+    P(0xfdc2, 0x20), T, T, P(0xfdc2, 0xbf), P(0xd5cd, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xfdc2, 0x30), P(0xfdc2, 0xaf), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xaf), P(0xfdc2, 0x30), P(0xc5f3, 0xcf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xfdc2, 0xef), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xe5c9, 0xf4), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xbdf5, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xfdc2, 0xff), P(0xedc6, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xef), P(0xfdc2, 0x20), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff), P(0xfdc2, 0xff),
+    P(0xe5c9, 0xff), P(0xcdf1, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, P(0xfdc2, 0xaf), P(0xfdc2, 0xff), P(0xedc8, 0xff), P(0xbdf5, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, P(0xfdc2, 0x30), P(0xedc8, 0xf3), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, P(0xfdc2, 0x10), P(0xfdc2, 0xbf), P(0xfdc2, 0x80), P(0xb5f8, 0xe5), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0xcf), P(0xfdc2, 0xff), P(0xe5ca, 0xd3), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, P(0xfdc2, 0x80), P(0xfdc2, 0xff), P(0xfdc2, 0xcf), P(0xb5f7, 0x87), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, P(0xfdc2, 0x10), P(0xfdc2, 0x80), P(0xfdc2, 0x10), P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_heavy_snow_showers = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_heavy_snow_showers_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_light_rain_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x20), P(0xb5f8, 0x8f), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xb5f8, 0x9f), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xb5f8, 0x30), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0xaf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_light_rain = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_light_rain_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_moderate_rain_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x20), P(0xb5f8, 0x8f), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xb5f8, 0x9f), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xb5f8, 0x30), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0xaf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T,
+    T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T,
+    T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T,
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T,
+    T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T,
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T,
+    T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_moderate_rain = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_moderate_rain_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_heavy_rain_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x20), P(0x7c93, 0x8f), P(0x7c93, 0xcf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x8f), P(0x7c93, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x7c93, 0x9f), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x30), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0xaf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, P(0x24be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf),
+    P(0x24be, 0x30), T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30),
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_heavy_rain = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_heavy_rain_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_thunder_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x20), P(0x7c93, 0x8f), P(0x7c93, 0xcf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x8f), P(0x7c93, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x7c93, 0x9f), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x30), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0xaf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0xacac, 0xff), P(0xfd00, 0xff), P(0xdce4, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x948f, 0xff),
+    P(0xf4e1, 0xff), P(0xfd00, 0xff), P(0xa4ad, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x8c91, 0x87), P(0xf4e2, 0xe7),
+    P(0xfd00, 0xff), P(0xf4e1, 0xef), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfd00, 0x9f), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfd00, 0x60), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xef), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xfd00, 0x30), P(0xfd00, 0xef), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xcf), P(0xfd00, 0x80), P(0xfd00, 0x80), P(0xfd00, 0x80), P(0xfd00, 0x70), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xfd00, 0x10), P(0xfd00, 0xcf), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xef), P(0xfd00, 0x30), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xfd00, 0x9f), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0xfd00, 0xaf),
+    P(0xfd00, 0xff), P(0xfd00, 0xff), P(0xfd00, 0x60), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfd00, 0x20), P(0xfd00, 0xff),
+    P(0xfd00, 0xff), P(0xfd00, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfd00, 0x70), P(0xfd00, 0xff),
+    P(0xfd00, 0x9f), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0xfd00, 0xdf), P(0xfd00, 0x9f),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfd00, 0x40), P(0xfd00, 0xcf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xfd00, 0x70), P(0xfd00, 0x10), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_thunder = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_thunder_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_light_sleet_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x20), P(0xb5f8, 0x8f), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xb5f8, 0x9f), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xb5f8, 0x30), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0xaf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T,
+    T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T,
+    T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T,
+    P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T,
+    T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T,
+    T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, T,
+    P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, T,
+    T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_light_sleet = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_light_sleet_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_moderate_sleet_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x20), P(0xb5f8, 0x8f), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xb5f8, 0x9f), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xb5f8, 0x30), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0xaf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xbf), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x60),
+    P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf),
+    P(0x24be, 0x30), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_moderate_sleet = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_moderate_sleet_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_heavy_sleet_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x20), P(0x7c93, 0x8f), P(0x7c93, 0xcf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x8f), P(0x7c93, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x7c93, 0x9f), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x30), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0xaf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T, T,
+    T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x24be, 0xdf),
+    P(0x24be, 0xff), P(0x24be, 0xbf), T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xbf), T, T,
+    P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff),
+    P(0x24be, 0xff), P(0x24be, 0x60), P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), P(0x65be, 0x30), T,
+    P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T,
+    T, T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff),
+    P(0x24be, 0xdf), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x65be, 0x40), T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf),
+    P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T,
+    T, T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff),
+    P(0x24be, 0x60), T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, P(0x65be, 0x60), P(0x65be, 0xdf),
+    P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf),
+    T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, P(0x24be, 0xdf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, P(0x65be, 0x60), P(0x65be, 0xdf),
+    P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, P(0x24be, 0x60), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60),
+    T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x34fe, 0x87), P(0x24be, 0xff), P(0x24be, 0xff), P(0x24be, 0x60), T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf),
+    P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T,
+    T, T, T, T, P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T,
+    T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    P(0x24be, 0xbf), P(0x24be, 0xff), P(0x24be, 0xdf), T, T, T, P(0x65be, 0x30), T,
+    P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T,
+    T, T, T, T, P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T,
+    T, T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    P(0x24be, 0x30), P(0x24be, 0xbf), P(0x24be, 0x30), T, T, T, T, T,
+    P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_heavy_sleet = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_heavy_sleet_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_light_snowfall_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x20), P(0xb5f8, 0x8f), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xb5f8, 0x9f), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xb5f8, 0x30), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0xaf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_light_snowfall = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_light_snowfall_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_moderate_snowfall_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x20), P(0xb5f8, 0x8f), P(0xb5f8, 0xcf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x8f), P(0xb5f8, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0xb5f8, 0x9f), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0xb5f8, 0x30), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0xaf), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x80), T, T,
+    T, T, T, T, P(0xb5f8, 0x80), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x70), T, T,
+    T, T, T, T, P(0xb5f8, 0x50), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0x20), T, T,
+    T, T, T, T, T, P(0xb5f8, 0xdf), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), T, T, T,
+    T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xcf), P(0xb5f8, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0xb5f8, 0x40), P(0xb5f8, 0xdf),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xff),
+    P(0xb5f8, 0xff), P(0xb5f8, 0xff), P(0xb5f8, 0xaf), P(0xb5f8, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0xb5f8, 0x50), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80), P(0xb5f8, 0x80),
+    P(0xb5f8, 0x80), P(0xb5f8, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T,
+    T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x40),
+    P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T,
+    T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x65be, 0x40), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff), P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x40),
+    P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T,
+    T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf), P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff),
+    P(0x65be, 0x40), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T,
+    T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf), P(0x65be, 0xbf), T, P(0x65be, 0x30),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T, T, T,
+    T, T, T, T, P(0x65be, 0x60), P(0x65be, 0x60), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_moderate_snowfall = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_moderate_snowfall_map,
+};
+
+static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_heavy_snowfall_map[] = {
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x20), P(0x7c93, 0x8f), P(0x7c93, 0xcf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x8f), P(0x7c93, 0x20), T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, P(0x7c93, 0x9f), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x9f), T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x50),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xdf),
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, P(0x7c93, 0x30), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0xaf), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x80), T, T,
+    T, T, T, T, P(0x7c93, 0x80), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x70), T, T,
+    T, T, T, T, P(0x7c93, 0x50), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0x20), T, T,
+    T, T, T, T, T, P(0x7c93, 0xdf), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), T, T, T,
+    T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xcf), P(0x7c93, 0x10), T, T, T,
+    T, T, T, T, T, T, P(0x7c93, 0x40), P(0x7c93, 0xdf),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xff),
+    P(0x7c93, 0xff), P(0x7c93, 0xff), P(0x7c93, 0xaf), P(0x7c93, 0x10), T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    P(0x7c93, 0x50), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80), P(0x7c93, 0x80),
+    P(0x7c93, 0x80), P(0x7c93, 0x20), T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, P(0x65be, 0x60), P(0x65be, 0xdf), P(0x65be, 0xff),
+    P(0x65be, 0xff), P(0x65be, 0xdf), P(0x65be, 0x60), T, T, T, T, T,
+    T, T, T, T, P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), P(0x65be, 0x40), P(0x65be, 0xff), P(0x65be, 0xaf), P(0x65be, 0xcf),
+    P(0x65be, 0xcf), P(0x65be, 0xaf), P(0x65be, 0xff), P(0x65be, 0x40), T, T, T, T,
+    T, T, T, T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, P(0x65be, 0x30), T, P(0x65be, 0xbf),
+    P(0x65be, 0xbf), T, P(0x65be, 0x30), T, T, T, T, T,
+    T, T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, P(0x65be, 0x60),
+    P(0x65be, 0x60), T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+    T, T, T, T, T, T, T, T,
+};
+
+static const lv_img_dsc_t icon_heavy_snowfall = {
+    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+    .header.always_zero = 0,
+    .header.reserved = 0,
+    .header.w = 32,
+    .header.h = 32,
+    .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+    .data = icon_heavy_snowfall_map,
+};
+
+static const lv_img_dsc_t *const icons[28] = {
+    &icon_unknown, /* 0 */
+    &icon_clear_sky, /* 1 */
+    &icon_nearly_clear_sky, /* 2 */
+    &icon_variable_cloudiness, /* 3 */
+    &icon_variable_cloudiness, /* 4 */
+    &icon_cloudy_sky, /* 5 */
+    &icon_overcast, /* 6 */
+    &icon_fog, /* 7 */
+    &icon_light_rain_showers, /* 8 */
+    &icon_moderate_rain_showers, /* 9 */
+    &icon_heavy_rain_showers, /* 10 */
+    &icon_thunderstorm, /* 11 */
+    &icon_light_sleet_showers, /* 12 */
+    &icon_moderate_sleet_showers, /* 13 */
+    &icon_heavy_sleet_showers, /* 14 */
+    &icon_light_snow_showers, /* 15 */
+    &icon_moderate_snow_showers, /* 16 */
+    &icon_heavy_snow_showers, /* 17 */
+    &icon_light_rain, /* 18 */
+    &icon_moderate_rain, /* 19 */
+    &icon_heavy_rain, /* 20 */
+    &icon_thunder, /* 21 */
+    &icon_light_sleet, /* 22 */
+    &icon_moderate_sleet, /* 23 */
+    &icon_heavy_sleet, /* 24 */
+    &icon_light_snowfall, /* 25 */
+    &icon_moderate_snowfall, /* 26 */
+    &icon_heavy_snowfall, /* 27 */
+};
+
+const lv_img_dsc_t *weather_icon_get(int code)
+{
+    if (code < 0 || code >= (int)(sizeof(icons) / sizeof(icons[0])))
+        code = 0;
+    return icons[code];
+}
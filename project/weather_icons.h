@@ -0,0 +1,20 @@
+#pragma once
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WEATHER_ICON_SIZE 32
+
+/**
+ * @brief Pre-rasterized icon for an SMHI symbol code (WeatherCondition::Value).
+ *        Unknown codes get the "unknown" icon. Images live in flash, see
+ *        scripts/gen_weather_icons.py.
+ */
+const lv_img_dsc_t *weather_icon_get(int code);
+
+#ifdef __cplusplus
+}
+#endif
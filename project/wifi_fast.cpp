@@ -0,0 +1,186 @@
+#include "wifi_fast.h"
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <atomic>
+#include <string.h>
+
+// One remembered access point, stored as a blob under "wifi"/"ap"
+struct WifiCache
+{
+  uint8_t version;
+  char ssid[33];
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint8_t ip[4];
+  uint8_t gateway[4];
+  uint8_t mask[4];
+  uint8_t dns[4];
+};
+static const uint8_t WIFI_CACHE_VERSION = 1;
+
+enum WifiPath
+{
+  WIFI_PATH_NONE = 0,
+  WIFI_PATH_FAST, // Cached BSSID and channel
+  WIFI_PATH_SCAN  // Full scan and DHCP
+};
+static const char *wifi_path_names[] = {"none", "cached BSSID", "full scan"};
+
+static const char *wifi_ssid;
+static const char *wifi_password;
+static void (*wifi_on_change)(bool connected);
+
+static WifiCache cache;
+static bool cache_valid = false;
+static WifiPath path = WIFI_PATH_NONE;
+static uint32_t begin_ms;
+static uint32_t fallbacks = 0;
+
+// Written by the Wi-Fi event task
+static std::atomic<bool> connected(false);
+static std::atomic<bool> fast_rejected(false);
+static std::atomic<bool> got_ip(false);
+static std::atomic<bool> settled(false); // First GOT_IP seen; later drops are left to the stack's reconnect
+static std::atomic<uint32_t> connect_ms(0);
+
+static void wifi_event(arduino_event_id_t event, arduino_event_info_t info)
+{
+  (void)info;
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP)
+  {
+    if (!settled.exchange(true))
+      connect_ms.store(millis() - begin_ms);
+    connected.store(true);
+    got_ip.store(true);
+    if (wifi_on_change)
+      wifi_on_change(true);
+  }
+  else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED)
+  {
+    if (path == WIFI_PATH_FAST && !settled.load() && !connected.load())
+      fast_rejected.store(true);
+    if (connected.exchange(false) && wifi_on_change)
+      wifi_on_change(false);
+  }
+}
+
+static void ip_bytes(const IPAddress &ip, uint8_t *out)
+{
+  for (int i = 0; i < 4; i++)
+    out[i] = ip[i];
+}
+
+static IPAddress ip_from(const uint8_t *b)
+{
+  return IPAddress(b[0], b[1], b[2], b[3]);
+}
+
+static bool load_cache()
+{
+  Preferences prefs;
+  prefs.begin("wifi", true);
+  bool ok = prefs.getBytesLength("ap") == sizeof(cache) && prefs.getBytes("ap", &cache, sizeof(cache)) == sizeof(cache);
+  prefs.end();
+  return ok && cache.version == WIFI_CACHE_VERSION && strncmp(cache.ssid, wifi_ssid, sizeof(cache.ssid)) == 0 &&
+         cache.channel != 0;
+}
+
+static void forget_cache()
+{
+  Preferences prefs;
+  prefs.begin("wifi", false);
+  prefs.remove("ap");
+  prefs.end();
+  cache_valid = false;
+}
+
+// Stores the current association; flash is only written when something changed
+static void save_cache()
+{
+  WifiCache now = {};
+  now.version = WIFI_CACHE_VERSION;
+  strncpy(now.ssid, wifi_ssid, sizeof(now.ssid) - 1);
+  const uint8_t *bssid = WiFi.BSSID();
+  if (bssid)
+    memcpy(now.bssid, bssid, sizeof(now.bssid));
+  now.channel = (uint8_t)WiFi.channel();
+  ip_bytes(WiFi.localIP(), now.ip);
+  ip_bytes(WiFi.gatewayIP(), now.gateway);
+  ip_bytes(WiFi.subnetMask(), now.mask);
+  ip_bytes(WiFi.dnsIP(), now.dns);
+  if (cache_valid && memcmp(&now, &cache, sizeof(now)) == 0)
+    return;
+
+  Preferences prefs;
+  prefs.begin("wifi", false);
+  prefs.putBytes("ap", &now, sizeof(now));
+  prefs.end();
+  cache = now;
+  cache_valid = true;
+}
+
+static void begin_scan()
+{
+  path = WIFI_PATH_SCAN;
+  begin_ms = millis();
+  if (WIFI_REUSE_LEASE)
+    WiFi.config(IPAddress(), IPAddress(), IPAddress()); // Back to DHCP
+  WiFi.begin(wifi_ssid, wifi_password);
+}
+
+void wifi_fast_begin(const char *ssid, const char *password, void (*on_change)(bool connected))
+{
+  wifi_ssid = ssid;
+  wifi_password = password;
+  wifi_on_change = on_change;
+  WiFi.onEvent(wifi_event);
+  WiFi.mode(WIFI_STA);
+
+  cache_valid = load_cache();
+  if (!cache_valid)
+  {
+    begin_scan();
+    return;
+  }
+  path = WIFI_PATH_FAST;
+  begin_ms = millis();
+  if (WIFI_REUSE_LEASE)
+    WiFi.config(ip_from(cache.ip), ip_from(cache.gateway), ip_from(cache.mask), ip_from(cache.dns));
+  WiFi.begin(wifi_ssid, wifi_password, cache.channel, cache.bssid);
+}
+
+void wifi_fast_poll()
+{
+  if (got_ip.exchange(false))
+  {
+    save_cache();
+    wifi_fast_log();
+  }
+
+  // The AP moved, changed channel or the lease is taken: start over the slow way.
+  // Only the first attempt is judged, a drop after that is not the cache's fault
+  if (path != WIFI_PATH_FAST || settled.load())
+    return;
+  bool timed_out = !connected.load() && millis() - begin_ms > WIFI_FAST_TIMEOUT_MS;
+  if (fast_rejected.exchange(false) || timed_out)
+  {
+    Serial.printf("Wi-Fi: cached BSSID failed after %u ms, scanning\n", (unsigned)(millis() - begin_ms));
+    fallbacks++;
+    forget_cache();
+    WiFi.disconnect();
+    begin_scan();
+  }
+}
+
+bool wifi_fast_connected()
+{
+  return connected.load();
+}
+
+void wifi_fast_log()
+{
+  Serial.printf("Wi-Fi: connected via %s (channel %u) in %u ms, %u fallbacks\n", wifi_path_names[path],
+                (unsigned)WiFi.channel(), (unsigned)connect_ms.load(), (unsigned)fallbacks);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Wi-Fi fast connect. After a successful association the access
+ *        point's BSSID and channel, and the DHCP lease, are kept in
+ *        Preferences. The next start joins that BSSID directly, which skips
+ *        the channel scan; with WIFI_REUSE_LEASE it also reuses the lease as a
+ *        static IP, which skips DHCP. If the fast path has not got an IP within
+ *        WIFI_FAST_TIMEOUT_MS, or the AP rejects it, the cache is dropped and
+ *        the station falls back to a full scan with DHCP.
+ *
+ *        Connection changes arrive as Wi-Fi events; `on_change` runs in the
+ *        Wi-Fi event task, so it should only post and wake.
+ */
+#ifndef WIFI_REUSE_LEASE
+#define WIFI_REUSE_LEASE 0
+#endif
+
+static const uint32_t WIFI_FAST_TIMEOUT_MS = 3000;
+
+void wifi_fast_begin(const char *ssid, const char *password, void (*on_change)(bool connected));
+
+// I/O task: falls back to a scan when the fast path failed and stores a new cache entry
+void wifi_fast_poll();
+
+bool wifi_fast_connected();
+
+// Prints the last connect time and path
+void wifi_fast_log();
@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+"""
+Generates project/weather_icons.c: one 32x32 RGB565+alpha image for every SMHI
+weather symbol code (WeatherCondition::Value), as const arrays in flash.
+
+Icons are drawn from simple shapes (sun, cloud, drops, flakes, bolt, fog) with
+4x4 supersampling, so no image library or source artwork is needed.
+
+Runs as a PlatformIO pre-build script (extra_scripts in platformio.ini) and
+only rewrites the output when this script is newer. It can also be run by
+hand:  python3 scripts/gen_weather_icons.py [--force]
+"""
+import math
+import os
+import sys
+
+SIZE = 32
+SUPERSAMPLE = 4
+
+SUN = (0xFD, 0xB8, 0x13)
+CLOUD = (0xB0, 0xBE, 0xC5)
+CLOUD_DARK = (0x78, 0x90, 0x9C)
+RAIN = (0x21, 0x96, 0xF3)
+SNOW = (0x64, 0xB5, 0xF6)
+BOLT = (0xFF, 0xA0, 0x00)
+FOG = (0x9E, 0x9E, 0x9E)
+UNKNOWN = (0x9E, 0x9E, 0x9E)
+
+
+# --- Shapes: functions (x, y) -> bool, with a bounding box to skip work ---
+
+class Shape:
+    def __init__(self, fn, box):
+        self.fn = fn
+        self.box = box  # x0, y0, x1, y1
+
+    def __or__(self, other):
+        a, b = self, other
+        box = (min(a.box[0], b.box[0]), min(a.box[1], b.box[1]),
+               max(a.box[2], b.box[2]), max(a.box[3], b.box[3]))
+        return Shape(lambda x, y: a.fn(x, y) or b.fn(x, y), box)
+
+
+def circle(cx, cy, r):
+    r2 = r * r
+    return Shape(lambda x, y: (x - cx) ** 2 + (y - cy) ** 2 <= r2,
+                 (cx - r, cy - r, cx + r, cy + r))
+
+
+def ring(cx, cy, r_in, r_out):
+    a, b = r_in * r_in, r_out * r_out
+    return Shape(lambda x, y: a <= (x - cx) ** 2 + (y - cy) ** 2 <= b,
+                 (cx - r_out, cy - r_out, cx + r_out, cy + r_out))
+
+
+def segment(x0, y0, x1, y1, width):
+    dx, dy = x1 - x0, y1 - y0
+    length2 = dx * dx + dy * dy or 1e-9
+    h2 = (width / 2.0) ** 2
+
+    def fn(x, y):
+        t = max(0.0, min(1.0, ((x - x0) * dx + (y - y0) * dy) / length2))
+        px, py = x0 + t * dx - x, y0 + t * dy - y
+        return px * px + py * py <= h2
+
+    w = width / 2.0
+    return Shape(fn, (min(x0, x1) - w, min(y0, y1) - w, max(x0, x1) + w, max(y0, y1) + w))
+
+
+def polygon(points):
+    def fn(x, y):
+        inside = False
+        j = len(points) - 1
+        for i in range(len(points)):
+            xi, yi = points[i]
+            xj, yj = points[j]
+            if (yi > y) != (yj > y) and x < (xj - xi) * (y - yi) / (yj - yi) + xi:
+                inside = not inside
+            j = i
+        return inside
+
+    xs = [p[0] for p in points]
+    ys = [p[1] for p in points]
+    return Shape(fn, (min(xs), min(ys), max(xs), max(ys)))
+
+
+# --- Icon parts ---
+
+def sun(cx, cy, r):
+    s = circle(cx, cy, r)
+    for k in range(8):
+        a = k * math.pi / 4
+        s = s | segment(cx + math.cos(a) * r * 1.45, cy + math.sin(a) * r * 1.45,
+                        cx + math.cos(a) * r * 1.95, cy + math.sin(a) * r * 1.95, 2.0)
+    return [(SUN, s)]
+
+
+def cloud(dx=0.0, dy=0.0, scale=1.0, color=CLOUD):
+    def c(x, y, r):
+        return circle(dx + x * scale, dy + y * scale, r * scale)
+    s = (c(10, 19, 5.5) | c(17, 14.5, 7.5) | c(23.5, 18.5, 6) |
+         segment(dx + 10 * scale, dy + 21 * scale, dx + 24 * scale, dy + 21 * scale, 7 * scale))
+    return [(color, s)]
+
+
+def drops(n, color=RAIN, xs=None):
+    xs = xs or {1: [16], 2: [12, 20], 3: [9, 16, 23]}[n]
+    return [(color, segment(x + 1.5, 23.5, x - 1.5, 29.5, 2.4)) for x in xs]
+
+
+def flake(cx, cy, color=SNOW):
+    s = None
+    for k in range(3):
+        a = k * math.pi / 3 + math.pi / 2
+        seg = segment(cx - math.cos(a) * 3, cy - math.sin(a) * 3,
+                      cx + math.cos(a) * 3, cy + math.sin(a) * 3, 1.4)
+        s = seg if s is None else s | seg
+    return [(color, s)]
+
+
+def flakes(n):
+    xs = {1: [16], 2: [11, 21], 3: [8, 16, 24]}[n]
+    out = []
+    for x in xs:
+        out += flake(x, 27)
+    return out
+
+
+def sleet(n):
+    xs = {1: [12, 20], 2: [9, 16, 23], 3: [7, 13, 19, 25]}[n]
+    out = []
+    for i, x in enumerate(xs):
+        if i % 2 == 0:
+            out += [(RAIN, segment(x + 1.5, 23.5, x - 1.5, 29.5, 2.4))]
+        else:
+            out += flake(x, 27)
+    return out
+
+
+def bolt():
+    return [(BOLT, polygon([(17, 17), (11, 25), (15.5, 25), (13, 31.5), (21, 22.5), (16.5, 22.5), (19, 17)]))]
+
+
+def fog():
+    return [(FOG, segment(6, y, 26, y, 2.6)) for y in (11, 16, 21)] + \
+           [(FOG, segment(10, 26, 22, 26, 2.6))]
+
+
+def unknown():
+    return [(UNKNOWN, ring(16, 16, 10, 12.5) | circle(16, 16, 2.5))]
+
+
+# Cloud raised to make room for precipitation below it
+def rain_cloud(color=CLOUD):
+    return cloud(0, -5, 1.0, color)
+
+
+def showers_sun():
+    return sun(8, 8, 4)
+
+
+# --- Icon per symbol code (index == WeatherCondition::Value) ---
+
+ICONS = [
+    ("unknown", unknown()),
+    ("clear_sky", sun(16, 16, 7)),
+    ("nearly_clear_sky", sun(13, 13, 6) + cloud(11, 13, 0.65)),
+    ("variable_cloudiness", sun(11, 11, 5.5) + cloud(2, 2)),
+    ("half_clear_sky", sun(11, 11, 5.5) + cloud(2, 2)),
+    ("cloudy_sky", cloud(-2, -3, 0.8, CLOUD_DARK) + cloud(2, 2)),
+    ("overcast", cloud(-2, -3, 0.8, CLOUD_DARK) + cloud(2, 2, 1.0, CLOUD_DARK)),
+    ("fog", fog()),
+    ("light_rain_showers", showers_sun() + rain_cloud() + drops(1)),
+    ("moderate_rain_showers", showers_sun() + rain_cloud() + drops(2)),
+    ("heavy_rain_showers", showers_sun() + rain_cloud() + drops(3)),
+    ("thunderstorm", rain_cloud(CLOUD_DARK) + bolt() + drops(2, xs=[7, 25])),
+    ("light_sleet_showers", showers_sun() + rain_cloud() + sleet(1)),
+    ("moderate_sleet_showers", showers_sun() + rain_cloud() + sleet(2)),
+    ("heavy_sleet_showers", showers_sun() + rain_cloud() + sleet(3)),
+    ("light_snow_showers", showers_sun() + rain_cloud() + flakes(1)),
+    ("moderate_snow_showers", showers_sun() + rain_cloud() + flakes(2)),
+    ("heavy_snow_showers", showers_sun() + rain_cloud() + flakes(3)),
+    ("light_rain", rain_cloud() + drops(1)),
+    ("moderate_rain", rain_cloud() + drops(2)),
+    ("heavy_rain", rain_cloud(CLOUD_DARK) + drops(3)),
+    ("thunder", rain_cloud(CLOUD_DARK) + bolt()),
+    ("light_sleet", rain_cloud() + sleet(1)),
+    ("moderate_sleet", rain_cloud() + sleet(2)),
+    ("heavy_sleet", rain_cloud(CLOUD_DARK) + sleet(3)),
+    ("light_snowfall", rain_cloud() + flakes(1)),
+    ("moderate_snowfall", rain_cloud() + flakes(2)),
+    ("heavy_snowfall", rain_cloud(CLOUD_DARK) + flakes(3)),
+]
+
+
+def rasterize(layers):
+    """Returns SIZE*SIZE (r, g, b, a) tuples, layers composited back to front."""
+    n = SUPERSAMPLE
+    offsets = [(i + 0.5) / n for i in range(n)]
+    pixels = []
+    for py in range(SIZE):
+        for px in range(SIZE):
+            r = g = b = a = 0.0
+            for color, shape in layers:
+                x0, y0, x1, y1 = shape.box
+                if px + 1 < x0 or px > x1 or py + 1 < y0 or py > y1:
+                    continue
+                hits = sum(1 for oy in offsets for ox in offsets if shape.fn(px + ox, py + oy))
+                cov = hits / float(n * n)
+                if cov == 0:
+                    continue
+                # "over" compositing with premultiplied accumulation
+                r = color[0] * cov + r * (1 - cov)
+                g = color[1] * cov + g * (1 - cov)
+                b = color[2] * cov + b * (1 - cov)
+                a = cov + a * (1 - cov)
+            if a > 0:
+                pixels.append((r / a, g / a, b / a, a))
+            else:
+                pixels.append((0, 0, 0, 0))
+    return pixels
+
+
+def rgb565(r, g, b):
+    return ((int(r + 0.5) >> 3) << 11) | ((int(g + 0.5) >> 2) << 5) | (int(b + 0.5) >> 3)
+
+
+def c_pixels(pixels):
+    """One P(rgb565, alpha) or T (transparent) per pixel, 8 pixels per line."""
+    cells = []
+    for r, g, b, a in pixels:
+        alpha = int(a * 255 + 0.5)
+        cells.append("P(0x%04x, 0x%02x)" % (rgb565(r, g, b), alpha) if alpha else "T")
+    lines = []
+    for i in range(0, len(cells), 8):
+        lines.append("    " + ", ".join(cells[i:i + 8]) + ",")
+    return "\n".join(lines)
+
+
+def generate():
+    parts = [
+        "/*",
+        " * Weather condition icons, %dx%d LV_IMG_CF_TRUE_COLOR_ALPHA (RGB565 + alpha)." % (SIZE, SIZE),
+        " * Generated by scripts/gen_weather_icons.py - do not edit.",
+        " */",
+        '#include "weather_icons.h"',
+        "",
+        "#if LV_COLOR_DEPTH != 16",
+        "#error \"weather_icons.c is generated for LV_COLOR_DEPTH 16\"",
+        "#endif",
+        "",
+        "/* RGB565 in the byte order LVGL expects, followed by the alpha byte */",
+        "#if LV_COLOR_16_SWAP == 0",
+        "#define P(c, a) ((c) & 0xFF), ((c) >> 8), (a)",
+        "#else",
+        "#define P(c, a) ((c) >> 8), ((c) & 0xFF), (a)",
+        "#endif",
+        "#define T 0, 0, 0",
+        "",
+    ]
+    seen = {}
+    table = []
+    for name, layers in ICONS:
+        pixels = rasterize(layers)
+        key = tuple(pixels)
+        if key in seen:
+            table.append(seen[key])
+            continue
+        seen[key] = name
+        table.append(name)
+        parts += [
+            "static LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST const uint8_t icon_%s_map[] = {" % name,
+            c_pixels(pixels),
+            "};",
+            "",
+            "static const lv_img_dsc_t icon_%s = {" % name,
+            "    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,",
+            "    .header.always_zero = 0,",
+            "    .header.reserved = 0,",
+            "    .header.w = %d," % SIZE,
+            "    .header.h = %d," % SIZE,
+            "    .data_size = %d * LV_IMG_PX_SIZE_ALPHA_BYTE," % (SIZE * SIZE),
+            "    .data = icon_%s_map," % name,
+            "};",
+            "",
+        ]
+    parts += ["static const lv_img_dsc_t *const icons[%d] = {" % len(ICONS)]
+    parts += ["    &icon_%s, /* %d */" % (name, code) for code, name in enumerate(table)]
+    parts += [
+        "};",
+        "",
+        "const lv_img_dsc_t *weather_icon_get(int code)",
+        "{",
+        "    if (code < 0 || code >= (int)(sizeof(icons) / sizeof(icons[0])))",
+        "        code = 0;",
+        "    return icons[code];",
+        "}",
+        "",
+    ]
+    return "\n".join(parts)
+
+
+def run(project_dir, script_path, force=False):
+    out_path = os.path.join(project_dir, "project", "weather_icons.c")
+    if (not force and os.path.exists(out_path) and script_path and
+            os.path.getmtime(out_path) >= os.path.getmtime(script_path)):
+        return
+    text = generate()
+    with open(out_path, "w") as f:
+        f.write(text)
+    print("Generated %s" % os.path.relpath(out_path, project_dir))
+
+
+try:
+    Import("env")  # noqa: F821 - injected by PlatformIO
+    run(env.subst("$PROJECT_DIR"), os.path.join(env.subst("$PROJECT_DIR"), "scripts", "gen_weather_icons.py"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        here = os.path.abspath(__file__)
+        run(os.path.dirname(os.path.dirname(here)), here, force="--force" in sys.argv)
@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+"""
+Subsets the montserrat_se fonts to the glyphs the firmware can actually draw.
+
+assets/fonts/montserrat_se_*.c are the full lv_font_conv outputs (Latin-1 plus
+weather emoji). This script:
+
+  * collects the character set: printable ASCII (numbers, SSIDs, IPs), the
+    Swedish letters and every non-ASCII character in a string literal under
+    project/ (city names, "°C", ...)
+  * writes src/montserrat_se_<N>.c, with only those glyphs, for each font that
+    project/ references or that lv_conf.h uses as LV_FONT_DEFAULT. Bitmaps,
+    glyph descriptions, character maps and kerning classes are rebuilt.
+  * writes src/lv_conf_fonts.h, which declares the subsetted fonts and turns
+    on only the LVGL built-in Montserrat sizes that are referenced.
+
+Runs as a PlatformIO pre-build script and only rewrites files whose content
+changes. It can also be run by hand:  python3 scripts/subset_fonts.py
+"""
+import glob
+import os
+import re
+
+FONT_PREFIX = "montserrat_se_"
+ALWAYS = "".join(chr(c) for c in range(0x20, 0x7F)) + "ÅÄÖåäö°"
+BUILTIN_SIZES = range(8, 50, 2)
+GENERATED_MARK = "Subset by scripts/subset_fonts.py"
+
+
+# --- Source scanning ---
+
+def string_literals(text):
+    """Yields the contents of C string literals, skipping comments."""
+    i, n = 0, len(text)
+    while i < n:
+        c = text[i]
+        if text.startswith("//", i):
+            i = text.find("\n", i)
+            i = n if i < 0 else i
+        elif text.startswith("/*", i):
+            i = text.find("*/", i + 2)
+            i = n if i < 0 else i + 2
+        elif c == "'":
+            i += 2 if text[i + 1] != "\\" else 3
+            i = text.find("'", i) + 1
+        elif c == '"':
+            j = i + 1
+            while j < n and text[j] != '"':
+                j += 2 if text[j] == "\\" else 1
+            yield text[i + 1:j]
+            i = j + 1
+        else:
+            i += 1
+
+
+def project_sources(project_dir):
+    files = []
+    for ext in ("*.cpp", "*.c", "*.h"):
+        files += glob.glob(os.path.join(project_dir, "project", ext))
+    return sorted(f for f in files if not f.endswith("weather_icons.c"))
+
+
+def read(path):
+    with open(path, encoding="utf-8") as f:
+        return f.read()
+
+
+# --- lv_font_conv (LVGL 8 format) parsing ---
+
+def c_array(text, name):
+    m = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if not m:
+        raise ValueError("array %s not found" % name)
+    body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+
+def c_field(text, name):
+    m = re.search(r"\.%s\s*=\s*(-?\d+)" % name, text)
+    if not m:
+        raise ValueError("field %s not found" % name)
+    return int(m.group(1))
+
+
+class Font:
+    def __init__(self, path):
+        text = read(path)
+        self.name = os.path.splitext(os.path.basename(path))[0]
+        self.opts = re.search(r"\* Opts: (.*)", text).group(1).strip()
+        self.bpp = c_field(text, "bpp")
+        if c_field(text, "bitmap_format") != 0:
+            raise ValueError("%s: compressed fonts are not supported" % path)
+        if c_field(text, "kern_classes") != 1:
+            raise ValueError("%s: only class based kerning is supported" % path)
+        self.kern_scale = c_field(text, "kern_scale")
+        self.public = {k: int(v) for k, v in re.findall(
+            r"\.(line_height|base_line|underline_position|underline_thickness)\s*=\s*(-?\d+)", text)}
+
+        bitmap = c_array(text, "glyph_bitmap")
+        dsc_body = re.search(r"glyph_dsc\[\]\s*=\s*\{(.*?)\n\};", text, re.S).group(1)
+        dsc = [dict((k, int(v)) for k, v in re.findall(r"\.(\w+)\s*=\s*(-?\d+)", entry))
+               for entry in re.findall(r"\{([^{}]*)\}", dsc_body)]
+        # A glyph's bitmap runs up to the next glyph's start
+        starts = sorted(set(d["bitmap_index"] for d in dsc) | {len(bitmap)})
+        end_of = dict(zip(starts, starts[1:]))
+        self.glyphs = []
+        for d in dsc:
+            data = bitmap[d["bitmap_index"]:end_of[d["bitmap_index"]]] if d["box_w"] else []
+            self.glyphs.append((d, data))
+
+        self.cmap = {}
+        cmaps_body = re.search(r"cmaps\[\]\s*=\s*\{(.*?)\n\};", text, re.S).group(1)
+        for entry in re.findall(r"\{([^{}]*)\}", cmaps_body):
+            start = int(re.search(r"\.range_start\s*=\s*(\d+)", entry).group(1))
+            length = int(re.search(r"\.range_length\s*=\s*(\d+)", entry).group(1))
+            gid = int(re.search(r"\.glyph_id_start\s*=\s*(\d+)", entry).group(1))
+            kind = re.search(r"\.type\s*=\s*(\w+)", entry).group(1)
+            ulist = re.search(r"\.unicode_list\s*=\s*(\w+)", entry).group(1)
+            olist = re.search(r"\.glyph_id_ofs_list\s*=\s*(\w+)", entry).group(1)
+            if kind.endswith("FORMAT0_TINY"):
+                for i in range(length):
+                    self.cmap[start + i] = gid + i
+            elif kind.endswith("FORMAT0_FULL"):
+                for i, ofs in enumerate(c_array(text, olist)):
+                    if ofs or i == 0:
+                        self.cmap[start + i] = gid + ofs
+            elif kind.endswith("SPARSE_TINY"):
+                for i, ofs in enumerate(c_array(text, ulist)):
+                    self.cmap[start + ofs] = gid + i
+            else:
+                ofs_list = c_array(text, olist)
+                for i, ofs in enumerate(c_array(text, ulist)):
+                    self.cmap[start + ofs] = gid + ofs_list[i]
+
+        self.kern_left = c_array(text, "kern_left_class_mapping")
+        self.kern_right = c_array(text, "kern_right_class_mapping")
+        self.kern_values = c_array(text, "kern_class_values")
+        self.left_cnt = c_field(text, "left_class_cnt")
+        self.right_cnt = c_field(text, "right_class_cnt")
+
+
+# --- Subset output ---
+
+def hex_rows(values, per_row=16, fmt="0x%x"):
+    return ["    " + ", ".join(fmt % v for v in values[i:i + per_row]) + ","
+            for i in range(0, len(values), per_row)]
+
+
+def build_cmaps(codepoints):
+    """Consecutive runs become FORMAT0_TINY maps, short runs are gathered in
+    into SPARSE_TINY maps. Returns (range_start, range_length, glyph_id_start,
+    unicode_list or None) tuples."""
+    runs = []
+    for cp in codepoints:
+        if runs and runs[-1][-1] + 1 == cp:
+            runs[-1].append(cp)
+        else:
+            runs.append([cp])
+    cmaps, loose = [], []
+    gid = 1
+    for run in runs:
+        if len(run) >= 3:
+            cmaps.append((run[0], len(run), gid, None))
+        else:
+            loose += [(cp, gid + i) for i, cp in enumerate(run)]
+        gid += len(run)
+    # Sparse maps can span at most 65535 code points and need consecutive ids
+    group = []
+    for cp, g in loose + [(None, None)]:
+        if group and (cp is None or cp - group[0][0] > 0xFFFF or g != group[-1][1] + 1):
+            cmaps.append((group[0][0], group[-1][0] - group[0][0] + 1, group[0][1],
+                          [c - group[0][0] for c, _ in group]))
+            group = []
+        if cp is not None:
+            group.append((cp, g))
+    cmaps.sort(key=lambda c: c[2])
+    return cmaps
+
+
+def subset(font, charset):
+    codepoints = sorted(cp for cp in set(ord(c) for c in charset) if cp in font.cmap)
+    old_ids = [0] + [font.cmap[cp] for cp in codepoints]
+
+    # Keep only the kerning classes the remaining glyphs use, renumbered
+    left_used = sorted(set(font.kern_left[g] for g in old_ids) - {0})
+    right_used = sorted(set(font.kern_right[g] for g in old_ids) - {0})
+    left_new = {c: i + 1 for i, c in enumerate(left_used)}
+    right_new = {c: i + 1 for i, c in enumerate(right_used)}
+    kern_values = [font.kern_values[(l - 1) * font.right_cnt + (r - 1)]
+                   for l in left_used for r in right_used]
+
+    out = [
+        "/*******************************************************************************",
+        " * Size: %s" % font.name[len(FONT_PREFIX):] + " px",
+        " * Bpp: %d" % font.bpp,
+        " * Opts: %s" % font.opts,
+        " * %s from assets/fonts/%s.c - do not edit." % (GENERATED_MARK, font.name),
+        " * Glyphs: %d of %d" % (len(codepoints), len(font.cmap)),
+        " ******************************************************************************/",
+        "",
+        '#include "lvgl.h"',
+        "",
+        "/*Store the image of the glyphs*/",
+        "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {",
+    ]
+    dsc_lines = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,"]
+    index = 0
+    for cp, gid in zip(codepoints, old_ids[1:]):
+        d, data = font.glyphs[gid]
+        out.append("    /* U+%04X */" % cp)
+        out += hex_rows(data)
+        dsc_lines.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d},"
+                         % (index, d["adv_w"], d["box_w"], d["box_h"], d["ofs_x"], d["ofs_y"]))
+        index += len(data)
+    out += ["};", "", "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {"] + dsc_lines + ["};", ""]
+
+    cmaps = build_cmaps(codepoints)
+    entries = []
+    for i, (start, length, gid, ulist) in enumerate(cmaps):
+        if ulist is None:
+            entries.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                           "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                           ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n    }" % (start, length, gid))
+        else:
+            out += ["static const uint16_t unicode_list_%d[] = {" % i] + hex_rows(ulist, 8) + ["};", ""]
+            entries.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                           "        .unicode_list = unicode_list_%d, .glyph_id_ofs_list = NULL, .list_length = %d, "
+                           ".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }" % (start, length, gid, i, len(ulist)))
+    out += ["static const lv_font_fmt_txt_cmap_t cmaps[] = {", ",\n".join(entries), "};", ""]
+
+    out += ["static const uint8_t kern_left_class_mapping[] = {"]
+    out += hex_rows([left_new.get(font.kern_left[g], 0) for g in old_ids], 16, "%d") + ["};", ""]
+    out += ["static const uint8_t kern_right_class_mapping[] = {"]
+    out += hex_rows([right_new.get(font.kern_right[g], 0) for g in old_ids], 16, "%d") + ["};", ""]
+    out += ["static const int8_t kern_class_values[] = {"] + hex_rows(kern_values or [0], 16, "%d") + ["};", ""]
+    out += [
+        "static const lv_font_fmt_txt_kern_classes_t kern_classes = {",
+        "    .class_pair_values   = kern_class_values,",
+        "    .left_class_mapping  = kern_left_class_mapping,",
+        "    .right_class_mapping = kern_right_class_mapping,",
+        "    .left_class_cnt      = %d," % len(left_used),
+        "    .right_class_cnt     = %d," % len(right_used),
+        "};",
+        "",
+        "static lv_font_fmt_txt_glyph_cache_t cache;",
+        "",
+        "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+        "    .glyph_bitmap = glyph_bitmap,",
+        "    .glyph_dsc = glyph_dsc,",
+        "    .cmaps = cmaps,",
+        "    .kern_dsc = &kern_classes,",
+        "    .kern_scale = %d," % font.kern_scale,
+        "    .cmap_num = %d," % len(cmaps),
+        "    .bpp = %d," % font.bpp,
+        "    .kern_classes = 1,",
+        "    .bitmap_format = 0,",
+        "    .cache = &cache",
+        "};",
+        "",
+        "const lv_font_t %s = {" % font.name,
+        "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,",
+        "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,",
+        "    .line_height = %d," % font.public["line_height"],
+        "    .base_line = %d," % font.public["base_line"],
+        "    .subpx = LV_FONT_SUBPX_NONE,",
+        "    .underline_position = %d," % font.public["underline_position"],
+        "    .underline_thickness = %d," % font.public["underline_thickness"],
+        "    .dsc = &font_dsc,",
+        "    .fallback = NULL,",
+        "    .user_data = NULL,",
+        "};",
+        "",
+    ]
+    return "\n".join(out), len(codepoints), index
+
+
+def fonts_header(custom, builtin):
+    lines = [
+        "/**",
+        " * Font selection for lv_conf.h.",
+        " * Generated by scripts/subset_fonts.py from the fonts referenced in project/ - do not edit.",
+        " */",
+        "#pragma once",
+        "",
+    ]
+    lines += ["#define LV_FONT_MONTSERRAT_%-2d %d" % (s, 1 if s in builtin else 0) for s in BUILTIN_SIZES]
+    lines += ["", "#define LV_FONT_CUSTOM_DECLARE " + " ".join("LV_FONT_DECLARE(%s)" % n for n in custom), ""]
+    return "\n".join(lines)
+
+
+def write_if_changed(path, text, project_dir):
+    if os.path.exists(path) and read(path) == text:
+        return
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("Generated %s" % os.path.relpath(path, project_dir))
+
+
+def run(project_dir):
+    sources = [read(p) for p in project_sources(project_dir)]
+    code = "\n".join(sources)
+    charset = set(ALWAYS)
+    for text in sources:
+        for literal in string_literals(text):
+            charset.update(literal)
+
+    lv_conf = read(os.path.join(project_dir, "src", "lv_conf.h"))
+    default = re.search(r"#define\s+LV_FONT_DEFAULT\s+&(\w+)", lv_conf).group(1)
+    available = sorted(glob.glob(os.path.join(project_dir, "assets", "fonts", FONT_PREFIX + "*.c")))
+    used = [p for p in available
+            if re.search(r"\b%s\b" % os.path.splitext(os.path.basename(p))[0], code)
+            or os.path.splitext(os.path.basename(p))[0] == default]
+    builtin = set(int(s) for s in re.findall(r"\blv_font_montserrat_(\d+)\b", code + default))
+
+    src_dir = os.path.join(project_dir, "src")
+    names = []
+    for path in used:
+        font = Font(path)
+        text, glyphs, size = subset(font, charset)
+        write_if_changed(os.path.join(src_dir, font.name + ".c"), text, project_dir)
+        names.append(font.name)
+    # Drop subsets of fonts that are no longer referenced
+    for path in glob.glob(os.path.join(src_dir, FONT_PREFIX + "*.c")):
+        if os.path.splitext(os.path.basename(path))[0] not in names and GENERATED_MARK in read(path):
+            os.remove(path)
+            print("Removed %s" % os.path.relpath(path, project_dir))
+    write_if_changed(os.path.join(src_dir, "lv_conf_fonts.h"), fonts_header(names, builtin), project_dir)
+
+
+try:
+    Import("env")  # noqa: F821 - injected by PlatformIO
+    run(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        run(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
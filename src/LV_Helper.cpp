@@ -8,6 +8,14 @@
  */
 #include <Arduino.h>
 #include "LV_Helper.h"
+#include "lv_trace.h"
+
+#if LV_HELPER_TOUCH_IRQ
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#endif
 
 
 #if LVGL_VERSION_MAJOR == 8
@@ -20,13 +28,17 @@ static lv_indev_t  *kb_indev = NULL;
 static lv_indev_drv_t indev_mouse;
 static lv_indev_drv_t indev_keypad;
 static struct InputParams params_copy;
+static struct LvglTouchStats touch_stats;  /* Counters are bumped by the ISR and touch task on core 0 */
+static uint32_t touch_sample_us;           /* micros() when the sample LVGL got last was read */
 
 /* Display flushing */
 static void disp_flush( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p )
 {
     uint32_t w = ( area->x2 - area->x1 + 1 );
     uint32_t h = ( area->y2 - area->y1 + 1 );
+    uint32_t start = lv_trace_now();
     static_cast<LilyGo_Display *>(disp_drv->user_data)->pushColors(area->x1, area->y1, w, h, (uint16_t *)color_p);
+    lv_trace_complete("flush", start, (int16_t)w, (int16_t)h);
     lv_disp_flush_ready( disp_drv );
 }
 
@@ -34,8 +46,10 @@ static void disp_flushDMA( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_co
 {
     uint32_t w = ( area->x2 - area->x1 + 1 );
     uint32_t h = ( area->y2 - area->y1 + 1 );
+    uint32_t start = lv_trace_now();
     static_cast<LilyGo_Display *>(disp_drv->user_data)->setAddrWindow(area->x1, area->y1, area->x2, area->y2);
     static_cast<LilyGo_Display *>(disp_drv->user_data)->pushColorsDMA((uint16_t *)color_p, w * h);
+    lv_trace_complete("flush", start, (int16_t)w, (int16_t)h);
 
     lv_disp_flush_ready( disp_drv );
 }
@@ -44,7 +58,15 @@ static void disp_flushDMA( lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_co
 static void touchpad_read( lv_indev_drv_t *indev_driver, lv_indev_data_t *data )
 {
     static int16_t x, y;
+    static bool was_touched = false;
+    uint32_t start = lv_trace_now();
     uint8_t touched =   static_cast<LilyGo_Display *>(indev_driver->user_data)->getPoint(&x, &y, 1);
+    __atomic_fetch_add(&touch_stats.reads, 1, __ATOMIC_RELAXED);
+    touch_sample_us = start;
+    if ( touched || was_touched ) {
+        lv_trace_complete(touched ? "touch" : "release", start, x, y);
+    }
+    was_touched = touched;
     if ( touched ) {
         data->point.x = x;
         data->point.y = y;
@@ -54,6 +76,198 @@ static void touchpad_read( lv_indev_drv_t *indev_driver, lv_indev_data_t *data )
     data->state = LV_INDEV_STATE_REL;
 }
 
+#if LV_HELPER_TOUCH_IRQ
+#define TOUCH_RING_SIZE         8       /* Power of two */
+#define TOUCH_ACTIVE_POLL_MS    10      /* Controller poll interval while a finger is down */
+#define TOUCH_TASK_STACK        3072
+#define TOUCH_TASK_PRIORITY     3       /* Above the UI, a read is a single short I2C transfer */
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    bool pressed;
+    uint32_t us;        /* micros() when read from the controller */
+} touch_sample_t;
+
+/* Single producer (touch task), single consumer (LVGL read callback) */
+static touch_sample_t touch_ring[TOUCH_RING_SIZE];
+static uint8_t touch_head;
+static uint8_t touch_tail;
+static TaskHandle_t touch_task_handle = NULL;
+static gpio_num_t touch_irq_pin;
+static void (*touch_notify)(void) = NULL;
+#endif
+
+#if LV_HELPER_TOUCH_IRQ
+/* Level triggered, so it can also end light sleep; masked until the task has read the point */
+static void IRAM_ATTR touch_isr(void)
+{
+    BaseType_t woken = pdFALSE;
+    gpio_intr_disable(touch_irq_pin);
+    __atomic_fetch_add(&touch_stats.irqs, 1, __ATOMIC_RELAXED);
+    vTaskNotifyGiveFromISR(touch_task_handle, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static bool touch_push(int16_t x, int16_t y, bool pressed, uint32_t us)
+{
+    uint8_t head = touch_head;
+    if ((uint8_t)(head - __atomic_load_n(&touch_tail, __ATOMIC_ACQUIRE)) == TOUCH_RING_SIZE) {
+        __atomic_fetch_add(&touch_stats.dropped, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+    touch_sample_t *s = &touch_ring[head & (TOUCH_RING_SIZE - 1)];
+    s->x = x;
+    s->y = y;
+    s->pressed = pressed;
+    s->us = us;
+    __atomic_store_n(&touch_head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+/*
+ * Sleeps until the controller raises its IRQ line, then reads the point. While
+ * a finger is down it also polls, since not every controller interrupts on
+ * release. A release that does not fit in the ring is retried on the next poll.
+ */
+static void touch_task(void *arg)
+{
+    LilyGo_Display *board = static_cast<LilyGo_Display *>(arg);
+    bool active = false;
+    bool masked = false;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, (active || masked) ? pdMS_TO_TICKS(TOUCH_ACTIVE_POLL_MS) : portMAX_DELAY);
+        int16_t x = 0, y = 0;
+        uint32_t start = lv_trace_now();
+        bool pressed = board->getPoint(&x, &y, 1) > 0;
+        __atomic_fetch_add(&touch_stats.reads, 1, __ATOMIC_RELAXED);
+        if (pressed || active) {
+            lv_trace_complete(pressed ? "touch" : "release", start, x, y);
+        }
+        if ((pressed || active) && touch_push(x, y, pressed, start)) {
+            active = pressed;
+            if (touch_notify) {
+                touch_notify();
+            }
+        }
+        // Re-arm once the controller has let go of the line, poll until then
+        masked = digitalRead(touch_irq_pin) == LOW;
+        if (!masked) {
+            gpio_intr_enable(touch_irq_pin);
+        }
+    }
+}
+
+static void touchpad_read_irq( lv_indev_drv_t *indev_driver, lv_indev_data_t *data )
+{
+    static touch_sample_t last = {0, 0, false, 0};
+    uint8_t tail = touch_tail;
+    uint8_t head = __atomic_load_n(&touch_head, __ATOMIC_ACQUIRE);
+    if (tail != head) {
+        last = touch_ring[tail & (TOUCH_RING_SIZE - 1)];
+        touch_sample_us = last.us;
+        lv_trace_instant(last.pressed ? "indev pressed" : "indev released", last.x, last.y);
+        tail++;
+        __atomic_store_n(&touch_tail, tail, __ATOMIC_RELEASE);
+        // Hand LVGL every buffered sample, so quick taps are not merged away
+        data->continue_reading = tail != head;
+    }
+    data->point.x = last.x;
+    data->point.y = last.y;
+    data->state = last.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+
+    // Nothing buffered, finger up and no scroll throw or snap left to run: stop
+    // the read timer so an idle UI has no periodic LVGL work; lvglTouchService()
+    // restarts it once the touch task buffers the next sample
+    lv_indev_t *indev = lv_indev_get_act();
+    if (tail == head && !last.pressed && indev && !indev->proc.types.pointer.scroll_obj) {
+        lv_timer_pause(indev_driver->read_timer);
+    }
+}
+
+static bool touch_irq_begin(LilyGo_Display &board)
+{
+    int pin = board.touchIrqPin();
+    if (pin < 0) {
+        return false;
+    }
+    if (xTaskCreatePinnedToCore(touch_task, "touch", TOUCH_TASK_STACK, &board,
+                                TOUCH_TASK_PRIORITY, &touch_task_handle, 0) != pdPASS) {
+        return false;
+    }
+    touch_irq_pin = (gpio_num_t)pin;
+    pinMode(pin, INPUT_PULLUP);
+    attachInterrupt(pin, touch_isr, ONLOW);
+    // A touch also ends automatic light sleep, if the application enables it
+    gpio_wakeup_enable(touch_irq_pin, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    return true;
+}
+#endif
+
+static void register_touch(LilyGo_Display &board)
+{
+    lv_indev_drv_init( &indev_drv );
+    indev_drv.type = LV_INDEV_TYPE_POINTER;
+    indev_drv.read_cb = touchpad_read;
+    indev_drv.user_data = &board;
+#if LV_HELPER_TOUCH_IRQ
+    touch_stats.irq_mode = touch_irq_begin(board);
+    if (touch_stats.irq_mode) {
+        indev_drv.read_cb = touchpad_read_irq;
+    }
+#endif
+    lv_indev_t *indev = lv_indev_drv_register( &indev_drv );
+    // Draining the ring costs nothing, so check it every frame instead of every 30 ms
+    if (touch_stats.irq_mode) {
+        lv_timer_set_period(indev->driver->read_timer, LV_DISP_DEF_REFR_PERIOD);
+    }
+}
+
+void lvglSetTouchNotify(void (*notify)(void))
+{
+#if LV_HELPER_TOUCH_IRQ
+    touch_notify = notify;
+#else
+    (void)notify;
+#endif
+}
+
+void lvglTouchService(void)
+{
+#if LV_HELPER_TOUCH_IRQ
+    if (!touch_stats.irq_mode || !indev_drv.read_timer) {
+        return;
+    }
+    if (__atomic_load_n(&touch_head, __ATOMIC_ACQUIRE) != touch_tail && indev_drv.read_timer->paused) {
+        lv_timer_resume(indev_drv.read_timer);
+        lv_timer_ready(indev_drv.read_timer);
+    }
+#endif
+}
+
+uint32_t lvglTouchSampleTime(void)
+{
+    return touch_sample_us;
+}
+
+void lvglTouchStats(struct LvglTouchStats *stats, bool reset)
+{
+    // Swapped out atomically, so a count taken between read and reset is not lost
+    stats->irq_mode = touch_stats.irq_mode;
+    if (reset) {
+        stats->irqs = __atomic_exchange_n(&touch_stats.irqs, 0, __ATOMIC_RELAXED);
+        stats->reads = __atomic_exchange_n(&touch_stats.reads, 0, __ATOMIC_RELAXED);
+        stats->dropped = __atomic_exchange_n(&touch_stats.dropped, 0, __ATOMIC_RELAXED);
+    } else {
+        stats->irqs = __atomic_load_n(&touch_stats.irqs, __ATOMIC_RELAXED);
+        stats->reads = __atomic_load_n(&touch_stats.reads, __ATOMIC_RELAXED);
+        stats->dropped = __atomic_load_n(&touch_stats.dropped, __ATOMIC_RELAXED);
+    }
+}
+
 #ifndef BOARD_HAS_PSRAM
 #error "Please turn on PSRAM to OPI !"
 #else
@@ -157,11 +371,7 @@ void beginLvglHelperDMA(LilyGo_Display &board, bool debug) {
     lv_disp_drv_register( &disp_drv );
 
     if (board.hasTouch()) {
-        lv_indev_drv_init( &indev_drv );
-        indev_drv.type = LV_INDEV_TYPE_POINTER;
-        indev_drv.read_cb = touchpad_read;
-        indev_drv.user_data = &board;
-        lv_indev_drv_register( &indev_drv );
+        register_touch(board);
     }
 
     lv_group_set_default(lv_group_create());
@@ -200,11 +410,7 @@ void beginLvglHelper(LilyGo_Display &board, bool debug)
     lv_disp_drv_register( &disp_drv );
 
     if (board.hasTouch()) {
-        lv_indev_drv_init( &indev_drv );
-        indev_drv.type = LV_INDEV_TYPE_POINTER;
-        indev_drv.read_cb = touchpad_read;
-        indev_drv.user_data = &board;
-        lv_indev_drv_register( &indev_drv );
+        register_touch(board);
     }
 
     lv_group_set_default(lv_group_create());
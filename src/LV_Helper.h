@@ -12,9 +12,45 @@
 #include "LilyGo_Display.h"
 #include "InputParams.h"
 
+/*
+ * Touch input mode. With LV_HELPER_TOUCH_IRQ the touch controller's IRQ line
+ * wakes a small task that reads the point over I2C into a ring buffer, and the
+ * LVGL read callback only drains that buffer; the controller is polled only
+ * while a finger is down, to catch the release. Boards without an IRQ pin fall
+ * back to polling getPoint() every LV_INDEV_DEF_READ_PERIOD.
+ */
+#ifndef LV_HELPER_TOUCH_IRQ
+#define LV_HELPER_TOUCH_IRQ 1
+#endif
+
 
 void beginLvglHelper(LilyGo_Display &board, bool debug = false);
 void beginLvglHelperDMA(LilyGo_Display &board, bool debug = false);
 void beginLvglInputDevice(struct InputParams prams);
 
+struct LvglTouchStats {
+    uint32_t irqs;          // Touch controller interrupts
+    uint32_t reads;         // I2C point reads, IRQ triggered or active polling
+    uint32_t dropped;       // Samples lost because LVGL did not drain the buffer in time
+    bool irq_mode;          // false: plain polling
+};
+
+void lvglTouchStats(struct LvglTouchStats *stats, bool reset = false);
+
+/*
+ * micros() at which the touch sample LVGL is processing was read from the
+ * controller. Called from an input event callback it gives the start of the
+ * input's latency, including the IRQ ring and indev polling delay.
+ */
+uint32_t lvglTouchSampleTime(void);
+
+/*
+ * IRQ mode only. The LVGL read timer pauses while no finger is down, so an
+ * idle UI can sleep past LV_INDEV_DEF_READ_PERIOD. `notify` is called from
+ * the touch task whenever a sample is buffered, e.g. to wake the UI task,
+ * which then calls lvglTouchService() before lv_timer_handler().
+ */
+void lvglSetTouchNotify(void (*notify)(void));
+void lvglTouchService(void);
+
 
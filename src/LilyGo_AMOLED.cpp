@@ -8,6 +8,7 @@
  */
 
 #include "LilyGo_AMOLED.h"
+#include "boot_timeline.h"
 #include <driver/gpio.h>
 
 #if ESP_ARDUINO_VERSION < ESP_ARDUINO_VERSION_VAL(3,0,0)
@@ -44,11 +45,16 @@
 #define LCD_CMD_BRIGHTNESS   (0x51)
 #endif
 
+#ifndef LCD_CMD_RDDPM
+#define LCD_CMD_RDDPM        (0x0A) // Read display power mode
+#endif
+#define LCD_RDDPM_SLPOUT_DISPON  (0x14) // Sleep out and display on bits
+
 #define SEND_BUF_SIZE           (16384)
 #define TFT_SPI_MODE            SPI_MODE0
 #define DEFAULT_SPI_HANDLER    (SPI3_HOST)
 
-LilyGo_AMOLED::LilyGo_AMOLED() : boards(NULL), _hasRTC(false), _disableTouch(false)
+LilyGo_AMOLED::LilyGo_AMOLED() : boards(NULL), _hasRTC(false), _hasLightSensor(false), _disableTouch(false)
 {
     spiDev = NULL;
     pBuffer = NULL;
@@ -418,6 +424,7 @@ bool LilyGo_AMOLED::initBUS(DriverBusType type)
     delay(300);
     digitalWrite(boards->display.rst, HIGH);
     delay(200);
+    boot_mark("panel reset");
 
     if (type == QSPI_DRIVER) {
         spi_bus_config_t buscfg = {
@@ -459,7 +466,10 @@ bool LilyGo_AMOLED::initBUS(DriverBusType type)
         assert(spiDev);
         spiDev->begin(boards->display.sck, -1 /*miso */, boards->display.d0);
     }
-    // prevent initialization failure
+    boot_mark("panel bus");
+
+    // prevent initialization failure: send the sequence again, unless the
+    // panel already reports sleep out and display on
     int retry = 2;
     while (retry--) {
         const lcd_cmd_t *t = boards->display.initSequence;
@@ -472,6 +482,14 @@ bool LilyGo_AMOLED::initBUS(DriverBusType type)
                 delay(10);
             }
         }
+        boot_mark("panel init sequence");
+        uint8_t mode = 0;
+        if (readCommand(LCD_CMD_RDDPM, &mode, 1) && mode != 0xFF &&
+                (mode & LCD_RDDPM_SLPOUT_DISPON) == LCD_RDDPM_SLPOUT_DISPON) {
+            log_i("Panel power mode 0x%02X, init verified", mode);
+            boot_mark("panel verified");
+            break;
+        }
     }
     return true;
 }
@@ -479,6 +497,8 @@ bool LilyGo_AMOLED::initBUS(DriverBusType type)
 
 bool LilyGo_AMOLED::begin()
 {
+    boot_mark("display begin");
+
     //Try find 1.47 inch i2c devices
     Wire.begin(1, 2);
     Wire.beginTransmission(AXP2101_SLAVE_ADDRESS);
@@ -539,6 +559,7 @@ bool LilyGo_AMOLED::beginAutomatic()
 bool LilyGo_AMOLED::beginAMOLED_191(bool touchFunc)
 {
     boards = &BOARD_AMOLED_191;
+    boot_mark("board detected: 1.91-inch QSPI");
 
     initBUS();
 
@@ -575,6 +596,7 @@ bool LilyGo_AMOLED::beginAMOLED_191(bool touchFunc)
 bool LilyGo_AMOLED::beginAMOLED_191_SPI(bool touchFunc)
 {
     boards = &BOARD_AMOLED_191_SPI;
+    boot_mark("board detected: 1.91-inch SPI");
 
     initBUS(SPI_DRIVER);
 
@@ -651,6 +673,7 @@ bool LilyGo_AMOLED::beginAMOLED_191_SPI(bool touchFunc)
 bool LilyGo_AMOLED::beginAMOLED_241(bool disable_sd, bool disable_state_led)
 {
     boards = &BOARD_AMOLED_241;
+    boot_mark("board detected: 2.41-inch");
 
     initBUS();
 
@@ -756,11 +779,13 @@ void LilyGo_AMOLED::uninstallSD()
 bool LilyGo_AMOLED::beginAMOLED_147()
 {
     boards = &BOARD_AMOLED_147;
+    boot_mark("board detected: 1.47-inch");
 
     if (!initPMU()) {
         log_e("Failed to find AXP2101 - check your wiring!");
         return false;
     }
+    boot_mark("pmu");
 
     if (ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO) {
         deviceScan(&Wire, &Serial);
@@ -804,11 +829,32 @@ bool LilyGo_AMOLED::beginAMOLED_147()
         */
         SensorCM32181::setSampling(SensorCM32181::SAMPLING_X2),
                       powerOn();
+        _hasLightSensor = true;
     }
 
     return true;
 }
 
+bool LilyGo_AMOLED::readCommand(uint32_t cmd, uint8_t *pdat, uint32_t length)
+{
+    // The 4-wire SPI boards have no MISO wired to the panel
+    if (spiDev || !spi) {
+        return false;
+    }
+
+    // Single line read: 0x03 plus the register in the address phase, data on D1
+    setCS();
+    spi_transaction_t t;
+    memset(&t, 0, sizeof(t));
+    t.cmd = 0x03;
+    t.addr = cmd << 8;
+    t.rxlength = 8 * length;
+    t.rx_buffer = pdat;
+    esp_err_t ret = spi_device_polling_transmit(spi, &t);
+    clrCS();
+    return ret == ESP_OK;
+}
+
 void LilyGo_AMOLED::writeCommand(uint32_t cmd, uint8_t *pdat, uint32_t length)
 {
     if (spiDev) {
@@ -1163,6 +1209,14 @@ bool LilyGo_AMOLED::hasTouch()
     return false;
 }
 
+int LilyGo_AMOLED::touchIrqPin()
+{
+    if (!hasTouch()) {
+        return -1;
+    }
+    return boards->touch->irq;
+}
+
 bool LilyGo_AMOLED::hasOTG()
 {
     uint8_t board = getBoardID();
@@ -1294,4 +1348,9 @@ bool LilyGo_AMOLED::needFullRefresh()
 bool LilyGo_AMOLED::hasRTC()
 {
     return _hasRTC;
+}
+
+bool LilyGo_AMOLED::hasLightSensor()
+{
+    return _hasLightSensor;
 }
\ No newline at end of file
@@ -407,12 +407,16 @@ public:
     void disp_sleep();
     void disp_wakeup();
     bool hasTouch();
+    int touchIrqPin() override;
     bool hasOTG();
 
     bool needFullRefresh();
 
 
     bool hasRTC();
+
+    // CM32181 ambient light sensor found at begin(), read it with getLux()
+    bool hasLightSensor();
 private:
 
     enum DriverBusType {
@@ -425,6 +429,7 @@ private:
     void inline setCS();
     void inline clrCS();
     void writeCommand(uint32_t cmd, uint8_t *pdat, uint32_t length);
+    bool readCommand(uint32_t cmd, uint8_t *pdat, uint32_t length);
     uint16_t *pBuffer;
     spi_device_handle_t spi;
     uint8_t _brightness;
@@ -438,6 +443,8 @@ private:
 
     bool  _hasRTC;
 
+    bool _hasLightSensor;
+
     bool _disableTouch;
 
     SPIClass *spiDev;
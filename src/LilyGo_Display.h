@@ -30,6 +30,11 @@ public:
 
     virtual uint8_t getPoint(int16_t *x, int16_t *y, uint8_t get_point ) = 0;
     virtual bool    hasTouch() = 0;
+    // GPIO of the touch controller's interrupt line, -1 if there is none
+    virtual int     touchIrqPin()
+    {
+        return -1;
+    }
 
     virtual bool needFullRefresh() = 0;
 
@@ -0,0 +1,84 @@
+/**
+ * @file      boot_timeline.cpp
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Fixed table behind boot_timeline.h. Bring-up runs on several
+ *            tasks at once, so a mark claims its slot with an atomic
+ *            increment; printing sorts by timestamp instead of slot order.
+ */
+#include "boot_timeline.h"
+
+#include <Arduino.h>
+#include <string.h>
+
+typedef struct {
+    const char *stage;
+    uint32_t us;
+    const char *task;
+} boot_stage_t;
+
+static boot_stage_t stages[BOOT_TIMELINE_CAPACITY];
+static uint32_t count = 0;
+
+static const char *current_task(void)
+{
+#if defined(ARDUINO_ARCH_ESP32)
+    return pcTaskGetName(NULL);
+#else
+    return "main";
+#endif
+}
+
+void boot_mark(const char *stage)
+{
+    uint32_t us = micros();
+    uint32_t slot = __atomic_fetch_add(&count, 1, __ATOMIC_RELAXED);
+    if (slot >= BOOT_TIMELINE_CAPACITY) {
+        return;
+    }
+    stages[slot].stage = stage;
+    stages[slot].task = current_task();
+    __atomic_store_n(&stages[slot].us, us, __ATOMIC_RELEASE);
+}
+
+uint32_t boot_mark_us(const char *stage)
+{
+    uint32_t n = __atomic_load_n(&count, __ATOMIC_ACQUIRE);
+    n = n < BOOT_TIMELINE_CAPACITY ? n : BOOT_TIMELINE_CAPACITY;
+    for (uint32_t i = n; i-- > 0;) {
+        if (stages[i].stage && strcmp(stages[i].stage, stage) == 0) {
+            return stages[i].us;
+        }
+    }
+    return 0;
+}
+
+void boot_timeline_print(void (*write)(const char *text, void *ctx), void *ctx)
+{
+    uint32_t n = __atomic_load_n(&count, __ATOMIC_ACQUIRE);
+    n = n < BOOT_TIMELINE_CAPACITY ? n : BOOT_TIMELINE_CAPACITY;
+
+    /* Insertion sort on a copy, a few dozen entries */
+    boot_stage_t sorted[BOOT_TIMELINE_CAPACITY];
+    memcpy(sorted, stages, n * sizeof(boot_stage_t));
+    for (uint32_t i = 1; i < n; i++) {
+        boot_stage_t s = sorted[i];
+        uint32_t j = i;
+        while (j > 0 && sorted[j - 1].us > s.us) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = s;
+    }
+
+    char line[96];
+    write("Boot timeline (ms since app start, +gap, task):\n", ctx);
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        snprintf(line, sizeof(line), "  %8.1f  +%7.1f  %-12s %s\n",
+                 sorted[i].us / 1000.0f, (sorted[i].us - prev) / 1000.0f,
+                 sorted[i].task ? sorted[i].task : "?", sorted[i].stage);
+        write(line, ctx);
+        prev = sorted[i].us;
+    }
+}
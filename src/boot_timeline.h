@@ -0,0 +1,39 @@
+/**
+ * @file      boot_timeline.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Boot timeline: named stages stamped in microseconds since the
+ *            application started, from any task. Bring-up code marks the end
+ *            of each stage; the sketch prints the timeline once the first
+ *            frame is on the panel, which gives time-to-first-frame and where
+ *            it went. Stage names must be string literals.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Stages kept; later marks are dropped */
+#ifndef BOOT_TIMELINE_CAPACITY
+#define BOOT_TIMELINE_CAPACITY 48
+#endif
+
+/* Records that `stage` ended now */
+void boot_mark(const char *stage);
+
+/* Microseconds of the last mark named `stage`, 0 if it was never marked */
+uint32_t boot_mark_us(const char *stage);
+
+/*
+ * Writes the stages in time order, each with its timestamp, the gap since
+ * the previous stage and the task that marked it, through `write`
+ */
+void boot_timeline_print(void (*write)(const char *text, void *ctx), void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -60,10 +60,12 @@
 #endif
 
 #else       /*LV_MEM_CUSTOM*/
-#define LV_MEM_CUSTOM_INCLUDE <esp32-hal-psram.h>   /*Header for the dynamic memory function*/
-#define LV_MEM_CUSTOM_ALLOC   ps_malloc
-#define LV_MEM_CUSTOM_FREE    free
-#define LV_MEM_CUSTOM_REALLOC ps_realloc
+/*Small allocations from an internal SRAM arena, large ones from PSRAM.
+ *Arena size and the small/large threshold are set in lv_mem_hybrid.h*/
+#define LV_MEM_CUSTOM_INCLUDE "lv_mem_hybrid.h"   /*Header for the dynamic memory function*/
+#define LV_MEM_CUSTOM_ALLOC   lv_mem_hybrid_alloc
+#define LV_MEM_CUSTOM_FREE    lv_mem_hybrid_free
+#define LV_MEM_CUSTOM_REALLOC lv_mem_hybrid_realloc
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -141,7 +143,7 @@
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  *However the opened images might consume additional RAM.
  *0: to disable caching*/
-#define LV_IMG_CACHE_DEF_SIZE 0
+#define LV_IMG_CACHE_DEF_SIZE 8
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -331,8 +333,16 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /*Compiler prefix for a big array declaration in RAM*/
 #define LV_ATTRIBUTE_LARGE_RAM_ARRAY
 
-/*Place performance critical functions into a faster memory (e.g RAM)*/
+/*Place performance critical functions into a faster memory (e.g RAM)
+ *LV_IRAM_PROFILE (set by [env:T-Display-AMOLED-iram]) moves the LVGL functions marked with
+ *this attribute - software blend/fill, mask, letter, line and rect drawing, lv_color_fill and
+ *lv_memcpy/lv_memset - into IRAM, away from the flash cache that Wi-Fi and PSRAM contend for.*/
+#if defined(LV_IRAM_PROFILE) && LV_IRAM_PROFILE
+#include "esp_attr.h"
+#define LV_ATTRIBUTE_FAST_MEM IRAM_ATTR
+#else
 #define LV_ATTRIBUTE_FAST_MEM
+#endif
 
 /*Prefix variables that are used in GPU accelerated operations, often these need to be placed in RAM sections that are DMA accessible*/
 #define LV_ATTRIBUTE_DMA
@@ -349,28 +359,11 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
  *===================*/
 
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
- *https://fonts.google.com/specimen/Montserrat*/
-#define LV_FONT_MONTSERRAT_8  0
-#define LV_FONT_MONTSERRAT_10 0
-#define LV_FONT_MONTSERRAT_12 1
-#define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_18 1
-#define LV_FONT_MONTSERRAT_20 1
-#define LV_FONT_MONTSERRAT_22 1
-#define LV_FONT_MONTSERRAT_24 1
-#define LV_FONT_MONTSERRAT_26 1
-#define LV_FONT_MONTSERRAT_28 1
-#define LV_FONT_MONTSERRAT_30 1
-#define LV_FONT_MONTSERRAT_32 1
-#define LV_FONT_MONTSERRAT_34 1
-#define LV_FONT_MONTSERRAT_36 1
-#define LV_FONT_MONTSERRAT_38 1
-#define LV_FONT_MONTSERRAT_40 1
-#define LV_FONT_MONTSERRAT_42 1
-#define LV_FONT_MONTSERRAT_44 1
-#define LV_FONT_MONTSERRAT_46 1
-#define LV_FONT_MONTSERRAT_48 1
+ *https://fonts.google.com/specimen/Montserrat
+ *LV_FONT_MONTSERRAT_<size> and LV_FONT_CUSTOM_DECLARE come from lv_conf_fonts.h,
+ *generated by scripts/subset_fonts.py: only sizes referenced in project/ are enabled
+ *and the montserrat_se fonts are subsetted to the glyphs the UI can draw.*/
+#include "lv_conf_fonts.h"
 
 /*Demonstrate special features*/
 #define LV_FONT_MONTSERRAT_12_SUBPX      0
@@ -384,8 +377,8 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
- *E.g. #define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(my_font_1) LV_FONT_DECLARE(my_font_2)*/
-#define LV_FONT_CUSTOM_DECLARE LV_FONT_DECLARE(montserrat_se_16) LV_FONT_DECLARE(montserrat_se_20) LV_FONT_DECLARE(montserrat_se_28) 
+ *E.g. #define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(my_font_1) LV_FONT_DECLARE(my_font_2)
+ *Declared in lv_conf_fonts.h (see above).*/
 
 /*Always set a default font*/
 #define LV_FONT_DEFAULT &montserrat_se_16
@@ -0,0 +1,369 @@
+/**
+ * @file      lv_mem_hybrid.c
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Two-level segregated fit (TLSF) arena in internal SRAM for small
+ *            LVGL allocations, PSRAM for the rest. See lv_mem_hybrid.h.
+ *
+ *            Every block starts with a header holding its previous physical
+ *            block and its payload size; free blocks additionally link into
+ *            one of FL_COUNT * SL_COUNT size-class lists. Allocation, free and
+ *            coalescing are O(1): two bitmaps find the first non-empty list
+ *            that is guaranteed to fit. LVGL is single threaded, so there is
+ *            no locking here.
+ */
+#include "lv_mem_hybrid.h"
+
+#include <stdbool.h>
+#include <string.h>
+#include <esp_heap_caps.h>
+#include <esp32-hal-psram.h>
+
+#define ALIGN_SIZE      sizeof(void *)
+#define SL_COUNT_LOG2   4
+#define SL_COUNT        (1U << SL_COUNT_LOG2)
+#define FL_SHIFT        (SL_COUNT_LOG2 + (ALIGN_SIZE == 8 ? 3 : 2))
+#define FL_MAX          20      /* Blocks up to 1 MiB */
+#define FL_COUNT        (FL_MAX - FL_SHIFT + 1)
+#define SMALL_BLOCK     (1U << FL_SHIFT)
+
+#define BLOCK_FREE      ((size_t)1)
+
+#if LV_MEM_HYBRID_POOL_SIZE >= (1UL << FL_MAX)
+#error "LV_MEM_HYBRID_POOL_SIZE must be below 1 MiB"
+#endif
+
+typedef struct block {
+    struct block *prev_phys;    /* NULL for the first block */
+    size_t size;                /* Payload bytes | BLOCK_FREE */
+    struct block *next_free;    /* Free blocks only, overlaps the payload */
+    struct block *prev_free;
+} block_t;
+
+#define BLOCK_HDR       offsetof(block_t, next_free)
+#define BLOCK_MIN       (sizeof(block_t) - BLOCK_HDR)
+
+typedef struct {
+    uint8_t *start;
+    uint8_t *end;
+    uint32_t fl_bitmap;
+    uint32_t sl_bitmap[FL_COUNT];
+    block_t *lists[FL_COUNT][SL_COUNT];
+} arena_t;
+
+static arena_t arena;
+static bool arena_tried;
+static lv_mem_hybrid_stats_t counters;
+
+// --- Block helpers ---
+
+static inline size_t block_size(const block_t *b)
+{
+    return b->size & ~BLOCK_FREE;
+}
+
+static inline bool block_is_free(const block_t *b)
+{
+    return (b->size & BLOCK_FREE) != 0;
+}
+
+static inline void *block_payload(block_t *b)
+{
+    return (uint8_t *)b + BLOCK_HDR;
+}
+
+static inline block_t *block_from_payload(const void *p)
+{
+    return (block_t *)((uint8_t *)p - BLOCK_HDR);
+}
+
+static inline block_t *block_next(block_t *b)
+{
+    return (block_t *)((uint8_t *)block_payload(b) + block_size(b));
+}
+
+static inline size_t align_up(size_t x)
+{
+    return (x + ALIGN_SIZE - 1) & ~(ALIGN_SIZE - 1);
+}
+
+static inline int fls_u32(uint32_t x)
+{
+    return x ? 31 - __builtin_clz(x) : -1;
+}
+
+static inline int ffs_u32(uint32_t x)
+{
+    return __builtin_ffs((int)x) - 1;
+}
+
+// --- Size classes ---
+
+static void mapping_insert(size_t size, int *fl, int *sl)
+{
+    if (size < SMALL_BLOCK) {
+        *fl = 0;
+        *sl = (int)(size / (SMALL_BLOCK / SL_COUNT));
+    } else {
+        int f = fls_u32((uint32_t)size);
+        *sl = (int)((size >> (f - SL_COUNT_LOG2)) ^ SL_COUNT);
+        *fl = f - (FL_SHIFT - 1);
+    }
+}
+
+// Rounds `size` up to the next class boundary so any block in the class fits
+static void mapping_search(size_t size, int *fl, int *sl)
+{
+    if (size >= SMALL_BLOCK) {
+        size += ((size_t)1 << (fls_u32((uint32_t)size) - SL_COUNT_LOG2)) - 1;
+    }
+    mapping_insert(size, fl, sl);
+}
+
+static void list_insert(block_t *b)
+{
+    int fl, sl;
+    mapping_insert(block_size(b), &fl, &sl);
+    block_t *head = arena.lists[fl][sl];
+    b->next_free = head;
+    b->prev_free = NULL;
+    if (head) {
+        head->prev_free = b;
+    }
+    arena.lists[fl][sl] = b;
+    arena.fl_bitmap |= 1U << fl;
+    arena.sl_bitmap[fl] |= 1U << sl;
+}
+
+static void list_remove(block_t *b)
+{
+    int fl, sl;
+    mapping_insert(block_size(b), &fl, &sl);
+    if (b->prev_free) {
+        b->prev_free->next_free = b->next_free;
+    } else {
+        arena.lists[fl][sl] = b->next_free;
+        if (!b->next_free) {
+            arena.sl_bitmap[fl] &= ~(1U << sl);
+            if (!arena.sl_bitmap[fl]) {
+                arena.fl_bitmap &= ~(1U << fl);
+            }
+        }
+    }
+    if (b->next_free) {
+        b->next_free->prev_free = b->prev_free;
+    }
+}
+
+static block_t *find_free(size_t size)
+{
+    int fl, sl;
+    mapping_search(size, &fl, &sl);
+    if (fl >= (int)FL_COUNT) {
+        return NULL;
+    }
+    uint32_t sl_map = arena.sl_bitmap[fl] & (~0U << sl);
+    if (!sl_map) {
+        uint32_t fl_map = fl + 1 < 32 ? arena.fl_bitmap & (~0U << (fl + 1)) : 0;
+        if (!fl_map) {
+            return NULL;
+        }
+        fl = ffs_u32(fl_map);
+        sl_map = arena.sl_bitmap[fl];
+    }
+    return arena.lists[fl][ffs_u32(sl_map)];
+}
+
+// Splits the tail of a used block beyond `size` off into a free block
+static void trim(block_t *b, size_t size)
+{
+    if (block_size(b) < size + BLOCK_HDR + BLOCK_MIN) {
+        return;
+    }
+    block_t *rest = (block_t *)((uint8_t *)block_payload(b) + size);
+    rest->prev_phys = b;
+    rest->size = (block_size(b) - size - BLOCK_HDR) | BLOCK_FREE;
+    b->size = size | (b->size & BLOCK_FREE);
+    block_t *after = block_next(rest);
+    after->prev_phys = rest;
+    if (block_is_free(after)) {
+        list_remove(after);
+        rest->size += BLOCK_HDR + block_size(after);
+        block_next(rest)->prev_phys = rest;
+    }
+    list_insert(rest);
+}
+
+// --- Arena ---
+
+static bool arena_init(void)
+{
+    arena_tried = true;
+    if (LV_MEM_HYBRID_POOL_SIZE < 4 * sizeof(block_t)) {
+        return false;
+    }
+    uint8_t *mem = (uint8_t *)heap_caps_malloc(LV_MEM_HYBRID_POOL_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!mem) {
+        return false;
+    }
+    // One free block spanning the arena, then a zero-sized used sentinel
+    uint8_t *start = (uint8_t *)align_up((size_t)mem);
+    uint8_t *end = mem + LV_MEM_HYBRID_POOL_SIZE;
+    block_t *first = (block_t *)start;
+    size_t payload = ((size_t)(end - start) - 2 * BLOCK_HDR) & ~(ALIGN_SIZE - 1);
+    first->prev_phys = NULL;
+    first->size = payload | BLOCK_FREE;
+    block_t *sentinel = block_next(first);
+    sentinel->prev_phys = first;
+    sentinel->size = 0;
+
+    arena.start = start;
+    arena.end = (uint8_t *)sentinel;
+    counters.pool_size = (uint32_t)payload;
+    list_insert(first);
+    return true;
+}
+
+static inline bool in_arena(const void *p)
+{
+    return (const uint8_t *)p >= arena.start && (const uint8_t *)p < arena.end;
+}
+
+static void *arena_alloc(size_t size)
+{
+    if (!arena.start && (arena_tried || !arena_init())) {
+        return NULL;
+    }
+    size = size < BLOCK_MIN ? BLOCK_MIN : align_up(size);
+    block_t *b = find_free(size);
+    if (!b) {
+        return NULL;
+    }
+    list_remove(b);
+    b->size &= ~BLOCK_FREE;
+    trim(b, size);
+
+    counters.pool_used += (uint32_t)block_size(b);
+    if (counters.pool_used > counters.pool_peak) {
+        counters.pool_peak = counters.pool_used;
+    }
+    return block_payload(b);
+}
+
+static void arena_free(void *p)
+{
+    block_t *b = block_from_payload(p);
+    counters.pool_used -= (uint32_t)block_size(b);
+    b->size |= BLOCK_FREE;
+
+    block_t *prev = b->prev_phys;
+    if (prev && block_is_free(prev)) {
+        list_remove(prev);
+        prev->size += BLOCK_HDR + block_size(b);
+        b = prev;
+        block_next(b)->prev_phys = b;
+    }
+    block_t *next = block_next(b);
+    if (block_is_free(next)) {
+        list_remove(next);
+        b->size += BLOCK_HDR + block_size(next);
+        block_next(b)->prev_phys = b;
+    }
+    list_insert(b);
+}
+
+// Grows or shrinks an arena block in place; false if it has to move
+static bool arena_resize(void *p, size_t size)
+{
+    block_t *b = block_from_payload(p);
+    size_t old = block_size(b);
+    size = size < BLOCK_MIN ? BLOCK_MIN : align_up(size);
+    if (size > old) {
+        block_t *next = block_next(b);
+        if (!block_is_free(next) || old + BLOCK_HDR + block_size(next) < size) {
+            return false;
+        }
+        list_remove(next);
+        b->size += BLOCK_HDR + block_size(next);
+        block_next(b)->prev_phys = b;
+    }
+    trim(b, size);
+    counters.pool_used += (uint32_t)block_size(b);
+    counters.pool_used -= (uint32_t)old;
+    if (counters.pool_used > counters.pool_peak) {
+        counters.pool_peak = counters.pool_used;
+    }
+    return true;
+}
+
+// --- LV_MEM_CUSTOM interface ---
+
+void *lv_mem_hybrid_alloc(size_t size)
+{
+    if (size <= LV_MEM_HYBRID_SMALL_MAX) {
+        void *p = arena_alloc(size);
+        if (p) {
+            counters.small_allocs++;
+            return p;
+        }
+        counters.small_fallbacks++;
+    } else {
+        counters.large_allocs++;
+    }
+    return ps_malloc(size);
+}
+
+void lv_mem_hybrid_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    if (in_arena(ptr)) {
+        arena_free(ptr);
+    } else {
+        free(ptr);
+    }
+}
+
+void *lv_mem_hybrid_realloc(void *ptr, size_t size)
+{
+    if (!ptr) {
+        return lv_mem_hybrid_alloc(size);
+    }
+    if (!in_arena(ptr)) {
+        return ps_realloc(ptr, size);
+    }
+    if (size <= LV_MEM_HYBRID_SMALL_MAX && arena_resize(ptr, size)) {
+        return ptr;
+    }
+    void *moved = lv_mem_hybrid_alloc(size);
+    if (!moved) {
+        return NULL;
+    }
+    size_t old = block_size(block_from_payload(ptr));
+    memcpy(moved, ptr, old < size ? old : size);
+    arena_free(ptr);
+    return moved;
+}
+
+void lv_mem_hybrid_get_stats(lv_mem_hybrid_stats_t *stats)
+{
+    *stats = counters;
+    stats->pool_free_biggest = 0;
+    stats->pool_frag_pct = 0;
+    if (!arena.start) {
+        return;
+    }
+    uint32_t free_total = 0;
+    for (block_t *b = (block_t *)arena.start; (uint8_t *)b < arena.end; b = block_next(b)) {
+        if (block_is_free(b)) {
+            free_total += (uint32_t)block_size(b);
+            if (block_size(b) > stats->pool_free_biggest) {
+                stats->pool_free_biggest = (uint32_t)block_size(b);
+            }
+        }
+    }
+    if (free_total) {
+        stats->pool_frag_pct = (uint8_t)(100 - (uint64_t)stats->pool_free_biggest * 100 / free_total);
+    }
+}
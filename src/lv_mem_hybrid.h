@@ -0,0 +1,52 @@
+/**
+ * @file      lv_mem_hybrid.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      LVGL allocator (LV_MEM_CUSTOM_ALLOC/FREE/REALLOC) that serves
+ *            small allocations - objects, styles, label text, draw
+ *            descriptors - from a TLSF arena in internal SRAM and everything
+ *            larger, or anything that no longer fits, from PSRAM.
+ *
+ *            Set LV_MEM_HYBRID_POOL_SIZE to 0 to send every allocation to
+ *            PSRAM, e.g. to benchmark against the hybrid layout.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Internal SRAM arena, allocated on first use */
+#ifndef LV_MEM_HYBRID_POOL_SIZE
+#define LV_MEM_HYBRID_POOL_SIZE (32U * 1024U)
+#endif
+
+/* Requests up to this many bytes go to the arena */
+#ifndef LV_MEM_HYBRID_SMALL_MAX
+#define LV_MEM_HYBRID_SMALL_MAX 256U
+#endif
+
+typedef struct {
+    uint32_t pool_size;         /* Arena bytes available for blocks */
+    uint32_t pool_used;         /* Payload bytes currently allocated from the arena */
+    uint32_t pool_peak;         /* Highest pool_used seen */
+    uint32_t pool_free_biggest; /* Largest free block, i.e. largest request that still fits */
+    uint8_t  pool_frag_pct;     /* 100 - biggest free block / total free, like lv_mem_monitor() */
+    uint32_t small_allocs;      /* Allocations served by the arena */
+    uint32_t small_fallbacks;   /* Small requests sent to PSRAM because the arena was full */
+    uint32_t large_allocs;      /* Allocations above LV_MEM_HYBRID_SMALL_MAX, served by PSRAM */
+} lv_mem_hybrid_stats_t;
+
+void *lv_mem_hybrid_alloc(size_t size);
+void lv_mem_hybrid_free(void *ptr);
+void *lv_mem_hybrid_realloc(void *ptr, size_t size);
+
+/* Fills `stats`; walks the arena, so call it from a status log, not per frame */
+void lv_mem_hybrid_get_stats(lv_mem_hybrid_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
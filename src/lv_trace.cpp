@@ -0,0 +1,127 @@
+/**
+ * @file      lv_trace.cpp
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      PSRAM ring behind lv_trace.h. Writers claim a slot with an atomic
+ *            increment of a free-running counter, so the ring needs no lock;
+ *            the counter also tells the exporter where the oldest event is.
+ *            The exporter stops recording and waits for writers already past
+ *            the check, so it never reads a slot that is being written.
+ *            Durations are stored as Chrome "X" (complete) events so spans
+ *            from tasks preempting each other on one core never mis-nest.
+ */
+#include "lv_trace.h"
+
+#include <Arduino.h>
+#include <esp32-hal-psram.h>
+
+typedef struct {
+    uint32_t ts;        /* Start, microseconds */
+    uint32_t dur;       /* TRACE_INSTANT for instant events */
+    const char *name;
+    int16_t a0;
+    int16_t a1;
+    uint8_t core;       /* Shown as the thread lane */
+} trace_event_t;
+
+#define TRACE_INSTANT   UINT32_MAX
+
+static trace_event_t *ring = NULL;
+static uint32_t head = 0;       /* Total events claimed, slot = head % capacity */
+static bool recording = false; /* Accessed with __atomic builtins, writers run on both cores */
+static uint32_t writers = 0;    /* record() calls in progress */
+
+static inline uint8_t current_core(void)
+{
+#if defined(ARDUINO_ARCH_ESP32)
+    return (uint8_t)xPortGetCoreID();
+#else
+    return 0;
+#endif
+}
+
+static void record(const char *name, uint32_t ts, uint32_t dur, int16_t a0, int16_t a1)
+{
+    __atomic_fetch_add(&writers, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&recording, __ATOMIC_SEQ_CST)) {
+        uint32_t slot = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED) % LV_TRACE_CAPACITY;
+        trace_event_t *e = &ring[slot];
+        e->ts = ts;
+        e->dur = dur;
+        e->name = name;
+        e->a0 = a0;
+        e->a1 = a1;
+        e->core = current_core();
+    }
+    __atomic_fetch_sub(&writers, 1, __ATOMIC_RELEASE);
+}
+
+bool lv_trace_init(void)
+{
+    if (!ring) {
+        ring = (trace_event_t *)ps_malloc(LV_TRACE_CAPACITY * sizeof(trace_event_t));
+    }
+    __atomic_store_n(&recording, ring != NULL, __ATOMIC_SEQ_CST);
+    return ring != NULL;
+}
+
+void lv_trace_enable(bool enable)
+{
+    __atomic_store_n(&recording, enable && ring != NULL, __ATOMIC_SEQ_CST);
+}
+
+bool lv_trace_enabled(void)
+{
+    return __atomic_load_n(&recording, __ATOMIC_RELAXED);
+}
+
+uint32_t lv_trace_now(void)
+{
+    return micros();
+}
+
+void lv_trace_instant(const char *name, int16_t a0, int16_t a1)
+{
+    record(name, micros(), TRACE_INSTANT, a0, a1);
+}
+
+void lv_trace_complete(const char *name, uint32_t start_us, int16_t a0, int16_t a1)
+{
+    record(name, start_us, micros() - start_us, a0, a1);
+}
+
+void lv_trace_export(void (*write)(const char *text, void *ctx), void *ctx)
+{
+    bool was_recording = __atomic_exchange_n(&recording, false, __ATOMIC_SEQ_CST);
+    /* A writer preempted mid-event on this core needs the CPU to finish */
+    while (__atomic_load_n(&writers, __ATOMIC_ACQUIRE) != 0) {
+        delay(1);
+    }
+
+    write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", ctx);
+    if (ring) {
+        uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+        uint32_t begin = end > LV_TRACE_CAPACITY ? end - LV_TRACE_CAPACITY : 0;
+        char line[160];
+        for (uint32_t i = begin; i < end; i++) {
+            const trace_event_t *e = &ring[i % LV_TRACE_CAPACITY];
+            const char *sep = i + 1 < end ? ",\n" : "\n";
+            if (e->dur == TRACE_INSTANT) {
+                snprintf(line, sizeof(line),
+                         "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%u,\"pid\":1,\"tid\":%u,"
+                         "\"args\":{\"a0\":%d,\"a1\":%d}}%s",
+                         e->name, (unsigned)e->ts, (unsigned)e->core, e->a0, e->a1, sep);
+            } else {
+                snprintf(line, sizeof(line),
+                         "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%u,\"dur\":%u,\"pid\":1,\"tid\":%u,"
+                         "\"args\":{\"a0\":%d,\"a1\":%d}}%s",
+                         e->name, (unsigned)e->ts, (unsigned)e->dur, (unsigned)e->core, e->a0, e->a1, sep);
+            }
+            write(line, ctx);
+        }
+    }
+    write("]}\n", ctx);
+
+    __atomic_store_n(&head, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&recording, was_recording, __ATOMIC_SEQ_CST);
+}
@@ -0,0 +1,54 @@
+/**
+ * @file      lv_trace.h
+ * @license   MIT
+ * @date      2026-10-18
+ * @note      Always-on event tracer for the touch-to-photon path: input
+ *            samples, event callbacks, LVGL render and panel flush. Events go
+ *            into a fixed ring in PSRAM (the oldest are overwritten) and are
+ *            exported as Chrome trace-event JSON, which chrome://tracing and
+ *            ui.perfetto.dev open directly.
+ *
+ *            Recording is one timestamp read and one atomic increment, safe
+ *            from any task on either core. Names must be string literals (or
+ *            otherwise outlive the trace), only the pointer is stored.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Ring capacity in events, 20 bytes each */
+#ifndef LV_TRACE_CAPACITY
+#define LV_TRACE_CAPACITY 8192
+#endif
+
+/* Allocates the ring and starts recording; false if PSRAM is exhausted */
+bool lv_trace_init(void);
+
+/* Pauses or resumes recording; events recorded while paused are dropped */
+void lv_trace_enable(bool enable);
+bool lv_trace_enabled(void);
+
+/* Timestamp in microseconds, the clock all events use */
+uint32_t lv_trace_now(void);
+
+/* Point in time, e.g. a touch sample; a0/a1 show up as args in the viewer */
+void lv_trace_instant(const char *name, int16_t a0, int16_t a1);
+
+/* Span from `start_us` (taken with lv_trace_now()) until now */
+void lv_trace_complete(const char *name, uint32_t start_us, int16_t a0, int16_t a1);
+
+/*
+ * Writes the buffered events, oldest first, as one JSON document through
+ * `write`, then clears the ring. Recording is paused meanwhile.
+ */
+void lv_trace_export(void (*write)(const char *text, void *ctx), void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,4400 +2,1009 @@
  * Size: 28 px
  * Bpp: 4
  * Opts: --bpp 4 --size 28 --no-compress --stride 1 --align 1 --font Montserrat.ttf --symbols ÅÄÖ --range 32-255 --font NotoEmoji-VariableFont_wght.ttf --symbols ☀⛅☁🌫🌧⛈⚡🌨❄ --format lvgl -o montserrat_se_28.c
+ * Subset by scripts/subset_fonts.py from assets/fonts/montserrat_se_28.c - do not edit.
+ * Glyphs: 102 of 200
  ******************************************************************************/
 
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#ifdef LV_LVGL_H_INCLUDE_SIMPLE
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-
-#ifndef MONTSERRAT_SE_28
-#define MONTSERRAT_SE_28 1
-#endif
-
-#if MONTSERRAT_SE_28
-
-/*-----------------
- *    BITMAPS
- *----------------*/
+#include "lvgl.h"
 
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x8f, 0xc0, 0x7f, 0xc0, 0x7f, 0xb0, 0x6f, 0xb0,
-    0x6f, 0xa0, 0x6f, 0xa0, 0x5f, 0x90, 0x5f, 0x90,
-    0x4f, 0x80, 0x4f, 0x80, 0x3f, 0x70, 0x3f, 0x70,
-    0x2f, 0x60, 0x2e, 0x50, 0x0, 0x0, 0x0, 0x0,
+    /* U+0020 */
+    /* U+0021 */
+    0x8f, 0xc0, 0x7f, 0xc0, 0x7f, 0xb0, 0x6f, 0xb0, 0x6f, 0xa0, 0x6f, 0xa0, 0x5f, 0x90, 0x5f, 0x90,
+    0x4f, 0x80, 0x4f, 0x80, 0x3f, 0x70, 0x3f, 0x70, 0x2f, 0x60, 0x2e, 0x50, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x5d, 0x80, 0xcf, 0xf0, 0x6f, 0xa0,
-
-    /* U+0022 "\"" */
-    0xf, 0xb0, 0x4, 0xf7, 0xf, 0xa0, 0x4, 0xf7,
-    0xf, 0xa0, 0x3, 0xf6, 0xf, 0xa0, 0x3, 0xf6,
-    0xf, 0x90, 0x3, 0xf6, 0xf, 0x90, 0x2, 0xf6,
-    0xf, 0x90, 0x2, 0xf5, 0x6, 0x40, 0x1, 0x72,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
-    0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x90, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf7, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x2, 0x99, 0x9b, 0xfa, 0x99, 0x99, 0x9f,
-    0xc9, 0x99, 0x50, 0x0, 0x0, 0x6f, 0x20, 0x0,
-    0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
-    0x0, 0x0, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x9e, 0x0, 0x0, 0x5, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xc0, 0x0, 0x0, 0x7f, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xda, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0,
-    0xad, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x19, 0x99, 0xaf,
-    0xb9, 0x99, 0x99, 0xfc, 0x99, 0x96, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x10, 0x0, 0x2, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0,
-    0x6, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x7, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7c, 0xef, 0xfe, 0xc7, 0x20, 0x0, 0x5, 0xff,
-    0xfe, 0xfe, 0xef, 0xff, 0x90, 0x4, 0xff, 0x81,
-    0xf, 0x60, 0x17, 0xdc, 0x0, 0xdf, 0x70, 0x0,
-    0xf6, 0x0, 0x0, 0x20, 0x1f, 0xf0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0xbf, 0xc2, 0x0, 0xf6, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xfa, 0x4f, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xfc, 0x72, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xfc, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xf9, 0x8e, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xf, 0x60, 0x6, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xf6, 0x0, 0x7, 0xfb, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x2f, 0xd0, 0x0,
-    0x0, 0x0, 0xf6, 0x0, 0x3, 0xfd, 0x2c, 0x10,
-    0x0, 0xf, 0x60, 0x0, 0xaf, 0x97, 0xff, 0x82,
-    0x0, 0xf6, 0x2, 0xaf, 0xf1, 0x7, 0xef, 0xfe,
-    0xdf, 0xdd, 0xff, 0xe3, 0x0, 0x0, 0x6a, 0xdf,
-    0xff, 0xec, 0x71, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x73, 0x0,
+    /* U+0022 */
+    0xf, 0xb0, 0x4, 0xf7, 0xf, 0xa0, 0x4, 0xf7, 0xf, 0xa0, 0x3, 0xf6, 0xf, 0xa0, 0x3, 0xf6,
+    0xf, 0x90, 0x3, 0xf6, 0xf, 0x90, 0x2, 0xf6, 0xf, 0x90, 0x2, 0xf5, 0x6, 0x40, 0x1, 0x72,
+    /* U+0023 */
+    0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
+    0x5f, 0x20, 0x0, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x7, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0x90, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf7, 0x0, 0x0, 0xc, 0xc0, 0x0, 0x0,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2, 0x99, 0x9b, 0xfa, 0x99, 0x99, 0x9f,
+    0xc9, 0x99, 0x50, 0x0, 0x0, 0x6f, 0x20, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf0,
+    0x0, 0x0, 0x3f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x5, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xc0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0xda, 0x0, 0x0, 0x9, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0xad, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x19, 0x99, 0xaf, 0xb9, 0x99, 0x99, 0xfc, 0x99, 0x96, 0x0, 0x0,
+    0x5, 0xf3, 0x0, 0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x10, 0x0, 0x2, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0,
+    0x6, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0,
+    /* U+0024 */
+    0x0, 0x0, 0x0, 0x7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x7c, 0xef, 0xfe, 0xc7, 0x20, 0x0, 0x5, 0xff, 0xfe, 0xfe, 0xef, 0xff, 0x90, 0x4, 0xff, 0x81,
+    0xf, 0x60, 0x17, 0xdc, 0x0, 0xdf, 0x70, 0x0, 0xf6, 0x0, 0x0, 0x20, 0x1f, 0xf0, 0x0, 0xf,
+    0x60, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0xf6, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0xf, 0x60,
+    0x0, 0x0, 0x0, 0xbf, 0xc2, 0x0, 0xf6, 0x0, 0x0, 0x0, 0x2, 0xef, 0xfa, 0x4f, 0x60, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0xfc, 0x72, 0x0, 0x0, 0x0, 0x0, 0x16, 0xbf, 0xff, 0xfc, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0xf9, 0x8e, 0xff, 0x80, 0x0, 0x0, 0x0, 0xf, 0x60, 0x6, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0xf6, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x2f, 0xd0, 0x0,
+    0x0, 0x0, 0xf6, 0x0, 0x3, 0xfd, 0x2c, 0x10, 0x0, 0xf, 0x60, 0x0, 0xaf, 0x97, 0xff, 0x82,
+    0x0, 0xf6, 0x2, 0xaf, 0xf1, 0x7, 0xef, 0xfe, 0xdf, 0xdd, 0xff, 0xe3, 0x0, 0x0, 0x6a, 0xdf,
+    0xff, 0xec, 0x71, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x73, 0x0,
     0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x6d, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x8, 0xf8, 0x47, 0xeb, 0x0,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x3f, 0x50, 0x0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x8e, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x8,
-    0xf0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xd9,
-    0x0, 0x0, 0x6, 0xf0, 0x0, 0x3f, 0x70, 0x0,
-    0x0, 0x0, 0xca, 0x0, 0x0, 0x7, 0xf0, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
-    0xa, 0xc0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x40, 0x0, 0x1f, 0x70, 0x3f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xe4, 0x3, 0xcd, 0x0,
-    0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xb1, 0x8, 0xf2, 0x0, 0x7d, 0xfe, 0x91,
-    0x0, 0x0, 0x1, 0x31, 0x0, 0x3f, 0x60, 0xa,
-    0xf7, 0x35, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x4f, 0x40, 0x0, 0x1f, 0x80, 0x0,
-    0x0, 0x0, 0x8, 0xf2, 0x0, 0xad, 0x0, 0x0,
-    0x9, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0,
-    0xca, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0xca, 0x0, 0x0, 0x6, 0xf0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0xac, 0x0,
-    0x0, 0x9, 0xd0, 0x0, 0x0, 0x3f, 0x60, 0x0,
-    0x0, 0x4f, 0x30, 0x0, 0x1e, 0x80, 0x0, 0x0,
-    0xdb, 0x0, 0x0, 0x0, 0xa, 0xe5, 0x24, 0xcd,
-    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0xfe, 0x91, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x19, 0xdf, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xb8, 0x9e, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0xdf,
-    0x10, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x1c, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x76, 0xef, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xc2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xf9, 0x3e, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x40, 0x3, 0xff,
-    0x40, 0x0, 0x7d, 0x20, 0xe, 0xf3, 0x0, 0x0,
-    0x3f, 0xf4, 0x0, 0xbf, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x3, 0xff, 0x42, 0xfb, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x0, 0x4f, 0xfb, 0xf4, 0x0, 0x8f,
-    0x60, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0, 0x0,
-    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf3,
-    0x0, 0xc, 0xfc, 0x30, 0x0, 0x1, 0x8f, 0xf8,
-    0xfe, 0x20, 0x1, 0xcf, 0xfd, 0xbb, 0xdf, 0xfd,
-    0x30, 0x5f, 0xe2, 0x0, 0x4, 0xad, 0xff, 0xda,
-    0x50, 0x0, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0xf, 0xb0, 0xfa, 0xf, 0xa0, 0xfa, 0xf, 0x90,
-    0xf9, 0xf, 0x90, 0x64,
-
-    /* U+0028 "(" */
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x2f, 0xd0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x2f, 0xc0, 0x0, 0x5, 0xf8, 0x0,
-    0x0, 0x8f, 0x60, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0xef, 0x10, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x8,
-    0xf6, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x7f, 0x70,
-    0x0, 0x1, 0xfd, 0x0, 0x0, 0x9, 0xf5, 0x0,
-    0x0, 0x1f, 0xc0,
-
-    /* U+0029 ")" */
-    0xaf, 0x40, 0x0, 0x2f, 0xc0, 0x0, 0xa, 0xf4,
-    0x0, 0x4, 0xfa, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0xaf, 0x50, 0x0, 0x5f, 0x80, 0x0, 0x3f, 0xb0,
-    0x0, 0xf, 0xe0, 0x0, 0xd, 0xf1, 0x0, 0xc,
-    0xf2, 0x0, 0xb, 0xf3, 0x0, 0xa, 0xf4, 0x0,
-    0xb, 0xf4, 0x0, 0xb, 0xf3, 0x0, 0xc, 0xf2,
-    0x0, 0xd, 0xf1, 0x0, 0xf, 0xe0, 0x0, 0x3f,
-    0xc0, 0x0, 0x5f, 0x90, 0x0, 0x9f, 0x50, 0x0,
-    0xef, 0x0, 0x4, 0xfb, 0x0, 0xa, 0xf5, 0x0,
-    0x2f, 0xc0, 0x0, 0xaf, 0x40, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xf0, 0x0, 0x0, 0x1d, 0x50, 0x3f, 0x0, 0x7c,
-    0x1, 0xaf, 0xb6, 0xf4, 0xdf, 0x80, 0x0, 0x3c,
-    0xff, 0xfa, 0x20, 0x0, 0x0, 0x8f, 0xff, 0x60,
-    0x0, 0x6, 0xee, 0x9f, 0x8f, 0xd4, 0x2, 0xf9,
-    0x13, 0xf0, 0x2a, 0xe0, 0x1, 0x0, 0x3f, 0x0,
-    0x1, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0xa, 0xaa, 0xaa, 0xff, 0xaa,
-    0xaa, 0xa1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0025 */
+    0x0, 0x6d, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x8, 0xf8, 0x47, 0xeb, 0x0,
+    0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x3f, 0x70, 0x0,
+    0x0, 0x8e, 0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0xbb, 0x0, 0x0, 0x8,
+    0xf0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x3f, 0x70, 0x0,
+    0x0, 0x0, 0xca, 0x0, 0x0, 0x7, 0xf0, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x0,
+    0xa, 0xc0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x1f, 0x70, 0x3f, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xe4, 0x3, 0xcd, 0x0, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xb1, 0x8, 0xf2, 0x0, 0x7d, 0xfe, 0x91, 0x0, 0x0, 0x1, 0x31, 0x0, 0x3f, 0x60, 0xa,
+    0xf7, 0x35, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x4f, 0x40, 0x0, 0x1f, 0x80, 0x0,
+    0x0, 0x0, 0x8, 0xf2, 0x0, 0xad, 0x0, 0x0, 0x9, 0xd0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0,
+    0xca, 0x0, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0, 0xdb, 0x0, 0x0, 0xca, 0x0, 0x0, 0x6, 0xf0,
+    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0xac, 0x0, 0x0, 0x9, 0xd0, 0x0, 0x0, 0x3f, 0x60, 0x0,
+    0x0, 0x4f, 0x30, 0x0, 0x1e, 0x80, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0xa, 0xe5, 0x24, 0xcd,
+    0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xfe, 0x91, 0x0,
+    /* U+0026 */
+    0x0, 0x0, 0x19, 0xdf, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xb8, 0x9e, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0,
+    0x7f, 0x50, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0xe, 0xf0,
+    0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x1c, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x76, 0xef, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xc2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xaf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xf9, 0x3e, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xfe, 0x40, 0x3, 0xff, 0x40, 0x0, 0x7d, 0x20, 0xe, 0xf3, 0x0, 0x0,
+    0x3f, 0xf4, 0x0, 0xbf, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x3, 0xff, 0x42, 0xfb, 0x0, 0x9f, 0x60,
+    0x0, 0x0, 0x0, 0x4f, 0xfb, 0xf4, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0, 0x0,
+    0x5f, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xef, 0xf3, 0x0, 0xc, 0xfc, 0x30, 0x0, 0x1, 0x8f, 0xf8,
+    0xfe, 0x20, 0x1, 0xcf, 0xfd, 0xbb, 0xdf, 0xfd, 0x30, 0x5f, 0xe2, 0x0, 0x4, 0xad, 0xff, 0xda,
+    0x50, 0x0, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0027 */
+    0xf, 0xb0, 0xfa, 0xf, 0xa0, 0xfa, 0xf, 0x90, 0xf9, 0xf, 0x90, 0x64,
+    /* U+0028 */
+    0x0, 0x1, 0xfd, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x2f, 0xd0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0xcf,
+    0x20, 0x0, 0x2f, 0xc0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x8f, 0x60, 0x0, 0xb, 0xf3, 0x0, 0x0,
+    0xef, 0x10, 0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x1, 0xfe, 0x0,
+    0x0, 0xf, 0xf0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x8,
+    0xf6, 0x0, 0x0, 0x5f, 0x80, 0x0, 0x2, 0xfc, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x7f, 0x70,
+    0x0, 0x1, 0xfd, 0x0, 0x0, 0x9, 0xf5, 0x0, 0x0, 0x1f, 0xc0,
+    /* U+0029 */
+    0xaf, 0x40, 0x0, 0x2f, 0xc0, 0x0, 0xa, 0xf4, 0x0, 0x4, 0xfa, 0x0, 0x0, 0xef, 0x0, 0x0,
+    0xaf, 0x50, 0x0, 0x5f, 0x80, 0x0, 0x3f, 0xb0, 0x0, 0xf, 0xe0, 0x0, 0xd, 0xf1, 0x0, 0xc,
+    0xf2, 0x0, 0xb, 0xf3, 0x0, 0xa, 0xf4, 0x0, 0xb, 0xf4, 0x0, 0xb, 0xf3, 0x0, 0xc, 0xf2,
+    0x0, 0xd, 0xf1, 0x0, 0xf, 0xe0, 0x0, 0x3f, 0xc0, 0x0, 0x5f, 0x90, 0x0, 0x9f, 0x50, 0x0,
+    0xef, 0x0, 0x4, 0xfb, 0x0, 0xa, 0xf5, 0x0, 0x2f, 0xc0, 0x0, 0xaf, 0x40, 0x0,
+    /* U+002A */
+    0x0, 0x0, 0x3f, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x1d, 0x50, 0x3f, 0x0, 0x7c,
+    0x1, 0xaf, 0xb6, 0xf4, 0xdf, 0x80, 0x0, 0x3c, 0xff, 0xfa, 0x20, 0x0, 0x0, 0x8f, 0xff, 0x60,
+    0x0, 0x6, 0xee, 0x9f, 0x8f, 0xd4, 0x2, 0xf9, 0x13, 0xf0, 0x2a, 0xe0, 0x1, 0x0, 0x3f, 0x0,
+    0x1, 0x0, 0x0, 0x3, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0,
+    /* U+002B */
+    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x0, 0x0, 0x0, 0xa, 0xaa, 0xaa, 0xff, 0xaa, 0xaa, 0xa1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0xdf, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x0, 0x2e, 0xe2, 0x7f, 0xf7, 0x2d, 0xf4,
-    0xa, 0xf0, 0xd, 0xa0, 0x1f, 0x50, 0x5f, 0x10,
-
-    /* U+002D "-" */
-    0x3c, 0xcc, 0xcc, 0xcc, 0x5, 0xff, 0xff, 0xff,
-    0xf0,
-
-    /* U+002E "." */
+    /* U+002C */
+    0x0, 0x0, 0x2e, 0xe2, 0x7f, 0xf7, 0x2d, 0xf4, 0xa, 0xf0, 0xd, 0xa0, 0x1f, 0x50, 0x5f, 0x10,
+    /* U+002D */
+    0x3c, 0xcc, 0xcc, 0xcc, 0x5, 0xff, 0xff, 0xff, 0xf0,
+    /* U+002E */
     0x0, 0x0, 0x2e, 0xe2, 0x7f, 0xf6, 0x2d, 0xd1,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x82, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x10, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
+    /* U+002F */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x82, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0xed,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x20, 0x0, 0x0,
+    0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0x10, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0,
     0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x7, 0xcf, 0xfe, 0xa3, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xff, 0xfe, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0x30, 0x0, 0x6e, 0xfb,
-    0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0x2e,
-    0xf7, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x60, 0x1f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfb, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xe0, 0x6f, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x8, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x16, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x5f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x1, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0,
-    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0,
-    0x0, 0xef, 0x90, 0x0, 0x0, 0x2, 0xef, 0x70,
-    0x0, 0x3, 0xff, 0xb3, 0x0, 0x16, 0xef, 0xb0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0xef, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0xff, 0xea, 0x30,
-    0x0, 0x0,
-
-    /* U+0031 "1" */
-    0xcf, 0xff, 0xff, 0xe9, 0xdd, 0xdd, 0xfe, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f,
-    0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0,
+    /* U+0030 */
+    0x0, 0x0, 0x7, 0xcf, 0xfe, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xfe, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x3f, 0xfb, 0x30, 0x0, 0x6e, 0xfb, 0x0, 0x0, 0xe, 0xf9, 0x0, 0x0, 0x0, 0x2e,
+    0xf7, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0x60, 0x1f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x5, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xe0, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x8, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x16, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x1, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0x0,
+    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x2, 0xef, 0x70,
+    0x0, 0x3, 0xff, 0xb3, 0x0, 0x16, 0xef, 0xb0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xef, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x7c, 0xff, 0xea, 0x30, 0x0, 0x0,
+    /* U+0031 */
+    0xcf, 0xff, 0xff, 0xe9, 0xdd, 0xdd, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0,
+    0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0,
+    0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2,
+    0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe, 0x0,
     0x0, 0x2f, 0xe0, 0x0, 0x2, 0xfe,
-
-    /* U+0032 "2" */
-    0x0, 0x4, 0x9d, 0xef, 0xec, 0x71, 0x0, 0x0,
-    0x2c, 0xff, 0xfe, 0xef, 0xff, 0xe4, 0x0, 0x2e,
-    0xfd, 0x50, 0x0, 0x3, 0xbf, 0xf2, 0x0, 0xb8,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa0, 0xef,
+    /* U+0032 */
+    0x0, 0x4, 0x9d, 0xef, 0xec, 0x71, 0x0, 0x0, 0x2c, 0xff, 0xfe, 0xef, 0xff, 0xe4, 0x0, 0x2e,
+    0xfd, 0x50, 0x0, 0x3, 0xbf, 0xf2, 0x0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa0, 0xef,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0033 "3" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0xcd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xb7, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
-    0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x3e, 0x30, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x7,
-    0xff, 0xb5, 0x0, 0x0, 0x29, 0xff, 0x40, 0x6,
-    0xef, 0xff, 0xfe, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    /* U+0033 */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xcd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xb7, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15,
+    0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x3e, 0x30, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x7,
+    0xff, 0xb5, 0x0, 0x0, 0x29, 0xff, 0x40, 0x6, 0xef, 0xff, 0xfe, 0xff, 0xfe, 0x50, 0x0, 0x0,
     0x59, 0xde, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x30, 0x0, 0x7, 0x91, 0x0,
-    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0xc,
-    0xf3, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0034 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x7, 0x91, 0x0,
+    0x0, 0x0, 0xd, 0xf6, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0xc,
+    0xf3, 0x0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0,
+    0x0, 0xc, 0xf3, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0xd, 0xf3, 0x0, 0x0,
-
-    /* U+0035 "5" */
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x2, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0x90, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdd, 0xcc,
-    0xb8, 0x50, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
-    0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0xc, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff, 0x32,
-    0xff, 0xd6, 0x20, 0x0, 0x17, 0xff, 0x90, 0x2,
-    0xcf, 0xff, 0xfe, 0xef, 0xff, 0x90, 0x0, 0x0,
+    /* U+0035 */
+    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x2, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0x90, 0x0,
+    0x4f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdd, 0xcc,
+    0xb8, 0x50, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x25,
+    0xaf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0xc, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff, 0x32,
+    0xff, 0xd6, 0x20, 0x0, 0x17, 0xff, 0x90, 0x2, 0xcf, 0xff, 0xfe, 0xef, 0xff, 0x90, 0x0, 0x0,
     0x38, 0xce, 0xfe, 0xd9, 0x30, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xfd, 0x93, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xdc, 0xdf, 0xfd, 0x0,
-    0x0, 0x1d, 0xfd, 0x50, 0x0, 0x0, 0x54, 0x0,
-    0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x90, 0x5, 0xbe, 0xfe, 0xc6, 0x0, 0x0,
-    0x8f, 0x81, 0xcf, 0xfd, 0xcd, 0xff, 0xe3, 0x0,
-    0x8f, 0x8d, 0xf6, 0x0, 0x0, 0x1a, 0xfe, 0x20,
-    0x7f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0xa0,
-    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x90,
-    0x0, 0x6f, 0xf6, 0x0, 0x0, 0x1a, 0xfe, 0x10,
-    0x0, 0x5, 0xff, 0xfd, 0xcd, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x1f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf3,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
-    0x9, 0x80, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa5, 0x0, 0x0,
-    0x0, 0x3e, 0xff, 0xec, 0xce, 0xff, 0xc1, 0x0,
-    0x2, 0xff, 0xa2, 0x0, 0x0, 0x4c, 0xfd, 0x0,
-    0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x6, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0x30,
-    0x0, 0xaf, 0xe6, 0x20, 0x13, 0x8f, 0xf8, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x7e, 0xfe, 0xba, 0xac, 0xff, 0xd5, 0x0,
-    0x9, 0xfd, 0x40, 0x0, 0x0, 0x6, 0xef, 0x60,
-    0x3f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
-    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1,
-    0xa, 0xfe, 0x60, 0x0, 0x0, 0x17, 0xff, 0x70,
-    0x0, 0x9f, 0xff, 0xdc, 0xcd, 0xff, 0xf6, 0x0,
-    0x0, 0x2, 0x8c, 0xef, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x6b, 0xef, 0xec, 0x81, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xdb, 0xcf, 0xff, 0x60, 0x0,
-    0x1, 0xdf, 0xa1, 0x0, 0x0, 0x6e, 0xf6, 0x0,
-    0x8, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x9, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf8,
-    0x1, 0xef, 0xa2, 0x0, 0x0, 0x6e, 0xd8, 0xf9,
-    0x0, 0x3d, 0xff, 0xdb, 0xcf, 0xfc, 0x27, 0xf9,
-    0x0, 0x0, 0x6b, 0xef, 0xeb, 0x50, 0x8, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x0, 0x46, 0x0, 0x0, 0x5, 0xdf, 0xe1, 0x0,
-    0x0, 0xcf, 0xfe, 0xcd, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x29, 0xcf, 0xff, 0xd9, 0x30, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x2d, 0xd2, 0x7f, 0xf6, 0x2e, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xe2, 0x7f, 0xf6, 0x2d, 0xd1,
-
-    /* U+003B ";" */
-    0x2d, 0xd2, 0x7f, 0xf6, 0x2e, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2d, 0xd2, 0x7f, 0xf7, 0x2e, 0xf4, 0x9, 0xf0,
+    /* U+0036 */
+    0x0, 0x0, 0x3, 0x9d, 0xff, 0xfd, 0x93, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xdc, 0xdf, 0xfd, 0x0,
+    0x0, 0x1d, 0xfd, 0x50, 0x0, 0x0, 0x54, 0x0, 0x0, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0x90, 0x5, 0xbe, 0xfe, 0xc6, 0x0, 0x0, 0x8f, 0x81, 0xcf, 0xfd, 0xcd, 0xff, 0xe3, 0x0,
+    0x8f, 0x8d, 0xf6, 0x0, 0x0, 0x1a, 0xfe, 0x20, 0x7f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0xa0,
+    0x6f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
+    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
+    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x1a, 0xfe, 0x10,
+    0x0, 0x5, 0xff, 0xfd, 0xcd, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x17, 0xce, 0xfe, 0xb6, 0x0, 0x0,
+    /* U+0037 */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x1f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf3,
+    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x50,
+    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x9, 0x80, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    /* U+0038 */
+    0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa5, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xec, 0xce, 0xff, 0xc1, 0x0,
+    0x2, 0xff, 0xa2, 0x0, 0x0, 0x4c, 0xfd, 0x0, 0x9, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
+    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
+    0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x6, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0x30,
+    0x0, 0xaf, 0xe6, 0x20, 0x13, 0x8f, 0xf8, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
+    0x0, 0x7e, 0xfe, 0xba, 0xac, 0xff, 0xd5, 0x0, 0x9, 0xfd, 0x40, 0x0, 0x0, 0x6, 0xef, 0x60,
+    0x3f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
+    0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
+    0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf1, 0xa, 0xfe, 0x60, 0x0, 0x0, 0x17, 0xff, 0x70,
+    0x0, 0x9f, 0xff, 0xdc, 0xcd, 0xff, 0xf6, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfe, 0xb7, 0x10, 0x0,
+    /* U+0039 */
+    0x0, 0x0, 0x6b, 0xef, 0xec, 0x81, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xdb, 0xcf, 0xff, 0x60, 0x0,
+    0x1, 0xdf, 0xa1, 0x0, 0x0, 0x6e, 0xf6, 0x0, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0x20,
+    0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf0,
+    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6,
+    0x9, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf8, 0x1, 0xef, 0xa2, 0x0, 0x0, 0x6e, 0xd8, 0xf9,
+    0x0, 0x3d, 0xff, 0xdb, 0xcf, 0xfc, 0x27, 0xf9, 0x0, 0x0, 0x6b, 0xef, 0xeb, 0x50, 0x8, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x0, 0x0, 0x46, 0x0, 0x0, 0x5, 0xdf, 0xe1, 0x0,
+    0x0, 0xcf, 0xfe, 0xcd, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x29, 0xcf, 0xff, 0xd9, 0x30, 0x0, 0x0,
+    /* U+003A */
+    0x2d, 0xd2, 0x7f, 0xf6, 0x2e, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xe2, 0x7f, 0xf6, 0x2d, 0xd1,
+    /* U+003B */
+    0x2d, 0xd2, 0x7f, 0xf6, 0x2e, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xd2, 0x7f, 0xf7, 0x2e, 0xf4, 0x9, 0xf0,
     0xd, 0xa0, 0x1f, 0x60, 0x4f, 0x10, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x81, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xf2, 0x0, 0x0,
-    0x0, 0x17, 0xef, 0xfa, 0x40, 0x0, 0x0, 0x4a,
-    0xff, 0xd7, 0x10, 0x0, 0x1, 0x7d, 0xff, 0xa3,
-    0x0, 0x0, 0x0, 0xf, 0xfd, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfa, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xaf, 0xfd, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7d, 0xff, 0xa3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xff, 0xd7, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xef, 0xf1, 0x0, 0x0, 0x0,
+    /* U+003C */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x81, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xf2, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xfa, 0x40, 0x0, 0x0, 0x4a, 0xff, 0xd7, 0x10, 0x0, 0x1, 0x7d, 0xff, 0xa3,
+    0x0, 0x0, 0x0, 0xf, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xaf, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xa3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4a, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x17, 0xef, 0xf1, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x4, 0xb2,
-
-    /* U+003D "=" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    /* U+003D */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
     0xa1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+003E ">" */
-    0x8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f,
-    0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39,
-    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f,
-    0xf2, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xfb, 0x40,
-    0x0, 0x0, 0x39, 0xff, 0xe8, 0x10, 0x0, 0x0,
-    0x6c, 0xff, 0xb4, 0x0, 0x0, 0x0, 0xf, 0xfe,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0xb, 0x50, 0x0,
+    /* U+003E */
+    0x8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f,
+    0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39,
+    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9f,
+    0xf2, 0x0, 0x0, 0x0, 0x6, 0xcf, 0xfb, 0x40, 0x0, 0x0, 0x39, 0xff, 0xe8, 0x10, 0x0, 0x0,
+    0x6c, 0xff, 0xb4, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0xb, 0x50, 0x0,
     0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x0, 0x4, 0x9d, 0xef, 0xec, 0x71, 0x0, 0x3,
-    0xcf, 0xff, 0xdd, 0xff, 0xfe, 0x40, 0x3f, 0xfb,
-    0x30, 0x0, 0x3, 0xcf, 0xf2, 0x1c, 0x60, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x90, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff, 0xfd,
-    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xfc, 0x97, 0x77, 0x9c, 0xff, 0xc4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfc, 0x10, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0,
-    0x17, 0xce, 0xfd, 0x81, 0x6, 0xf7, 0x4, 0xf8,
-    0x0, 0x2, 0xf9, 0x0, 0x0, 0x3e, 0xff, 0xca,
-    0xcf, 0xf5, 0x6f, 0x70, 0x8, 0xf2, 0x0, 0x9f,
-    0x10, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x2b, 0xf9,
-    0xf7, 0x0, 0x1f, 0x90, 0xe, 0xa0, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
-    0x9e, 0x3, 0xf5, 0x0, 0x4, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xf7, 0x0, 0x4, 0xf2, 0x6f,
-    0x20, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x70, 0x0, 0x1f, 0x57, 0xf0, 0x0, 0xc,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0,
-    0x0, 0xf7, 0x8f, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0xf, 0x77,
-    0xf0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf7, 0x0, 0x0, 0xf7, 0x6f, 0x20, 0x0,
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x1f, 0x53, 0xf5, 0x0, 0x4, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x4, 0xf3,
-    0xe, 0xa0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x70, 0x0, 0x9e, 0x0, 0x9f, 0x10,
-    0x0, 0x2f, 0xf7, 0x0, 0x0, 0x1b, 0xf6, 0xfb,
-    0x0, 0x3f, 0x80, 0x2, 0xfa, 0x0, 0x0, 0x3e,
-    0xfe, 0xba, 0xcf, 0xf5, 0xc, 0xfc, 0xaf, 0xd0,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x17, 0xce, 0xfd,
-    0x82, 0x0, 0x1b, 0xfe, 0x91, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x50, 0x0, 0x0,
-    0x0, 0x1, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xcf, 0xfb, 0x97, 0x77, 0x9c, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0xbe, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
+    /* U+003F */
+    0x0, 0x4, 0x9d, 0xef, 0xec, 0x71, 0x0, 0x3, 0xcf, 0xff, 0xdd, 0xff, 0xfe, 0x40, 0x3f, 0xfb,
+    0x30, 0x0, 0x3, 0xcf, 0xf2, 0x1c, 0x60, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x3e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0,
+    /* U+0040 */
+    0x0, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff, 0xfd, 0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xcf, 0xfc, 0x97, 0x77, 0x9c, 0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x5d, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xfc, 0x10, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xfc, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x17, 0xce, 0xfd, 0x81, 0x6, 0xf7, 0x4, 0xf8,
+    0x0, 0x2, 0xf9, 0x0, 0x0, 0x3e, 0xff, 0xca, 0xcf, 0xf5, 0x6f, 0x70, 0x8, 0xf2, 0x0, 0x9f,
+    0x10, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x2b, 0xf9, 0xf7, 0x0, 0x1f, 0x90, 0xe, 0xa0, 0x0, 0xd,
+    0xf5, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x9e, 0x3, 0xf5, 0x0, 0x4, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xf7, 0x0, 0x4, 0xf2, 0x6f, 0x20, 0x0, 0x9f, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0x70, 0x0, 0x1f, 0x57, 0xf0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0,
+    0x0, 0xf7, 0x8f, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0xf, 0x77,
+    0xf0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x0, 0xf7, 0x6f, 0x20, 0x0,
+    0x9f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x1f, 0x53, 0xf5, 0x0, 0x4, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x4, 0xf3, 0xe, 0xa0, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x70, 0x0, 0x9e, 0x0, 0x9f, 0x10, 0x0, 0x2f, 0xf7, 0x0, 0x0, 0x1b, 0xf6, 0xfb,
+    0x0, 0x3f, 0x80, 0x2, 0xfa, 0x0, 0x0, 0x3e, 0xfe, 0xba, 0xcf, 0xf5, 0xc, 0xfc, 0xaf, 0xd0,
+    0x0, 0x8, 0xf5, 0x0, 0x0, 0x17, 0xce, 0xfd, 0x82, 0x0, 0x1b, 0xfe, 0x91, 0x0, 0x0, 0xc,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd, 0x50, 0x0, 0x0,
+    0x0, 0x1, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xfb, 0x97, 0x77, 0x9c, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
     0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x76, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0xe,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x20, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0xa,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x5,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x7f, 0xdb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbd, 0xf8, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0,
-    0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x70, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xfe, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0041 */
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0x76, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0xe,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0x20, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0xa,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x5,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x9,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x10, 0x0, 0x0, 0x7f, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xf8, 0x0, 0x0, 0xe, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x70, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x4f, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x6f, 0xc0,
-
-    /* U+0042 "B" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0xd, 0xfc, 0xbb, 0xbb, 0xbb, 0xcf, 0xff, 0xc1,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xc0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x40, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf7, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x70, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x38, 0xff, 0x40, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0xdf, 0xcb, 0xbb,
-    0xbb, 0xbb, 0xcf, 0xfe, 0x70, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0x90, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x2d, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8d,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x3d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf,
-    0xb0, 0xdf, 0xcb, 0xbb, 0xbb, 0xbb, 0xcf, 0xff,
-    0xb0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9,
-    0x40, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xee, 0xff,
-    0xfd, 0x40, 0x0, 0x4, 0xff, 0xe8, 0x20, 0x0,
-    0x4, 0xbf, 0xf7, 0x0, 0x4f, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0xe4, 0x1, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x4, 0xff, 0xe8, 0x20, 0x0, 0x5,
-    0xbf, 0xf7, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xee,
-    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x38, 0xce,
+    /* U+0042 */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0, 0xd, 0xfc, 0xbb, 0xbb, 0xbb, 0xcf, 0xff, 0xc1,
+    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x4, 0xef, 0xc0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0x40, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0x70, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0xd, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xfe, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x38, 0xff, 0x40, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x20, 0x0, 0xdf, 0xcb, 0xbb, 0xbb, 0xbb, 0xcf, 0xfe, 0x70, 0xd, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xdf, 0x90, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x2d, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x8d,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0x3d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xb0, 0xdf, 0xcb, 0xbb, 0xbb, 0xbb, 0xcf, 0xff,
+    0xb0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc9, 0x40, 0x0,
+    /* U+0043 */
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xda, 0x50, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xee, 0xff,
+    0xfd, 0x40, 0x0, 0x4, 0xff, 0xe8, 0x20, 0x0, 0x4, 0xbf, 0xf7, 0x0, 0x4f, 0xfb, 0x10, 0x0,
+    0x0, 0x0, 0x5, 0xe4, 0x1, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x4, 0xff, 0xe8, 0x20, 0x0, 0x5,
+    0xbf, 0xf7, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xee, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x38, 0xce,
     0xfe, 0xd9, 0x50, 0x0,
-
-    /* U+0044 "D" */
-    0xdf, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x30, 0x0,
-    0x0, 0xd, 0xfd, 0xdd, 0xdd, 0xdd, 0xef, 0xff,
-    0xc3, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x16, 0xdf, 0xf6, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x1d, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf6, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0x9d, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xad, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x6d, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x60, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x1, 0x6d,
-    0xff, 0x60, 0x0, 0xdf, 0xdd, 0xdd, 0xdd, 0xde,
-    0xff, 0xfc, 0x30, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x93, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xd,
-    0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x80, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0xdf, 0xdc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0x50, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd, 0xff,
+    /* U+0044 */
+    0xdf, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0xd, 0xfd, 0xdd, 0xdd, 0xdd, 0xef, 0xff,
+    0xc3, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xf6, 0x0, 0xd, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0xd,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xb0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0x1d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6, 0xdf, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0xdf,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xad, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x6d, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xf1, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb, 0xd, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x60, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x1, 0x6d, 0xff, 0x60, 0x0, 0xdf, 0xdd, 0xdd, 0xdd, 0xde,
+    0xff, 0xfc, 0x30, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xec, 0x93, 0x0, 0x0, 0x0,
+    /* U+0045 */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xd, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x80, 0xdf,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xdf, 0xdc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x50, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd, 0xff,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xdf,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd8, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0xdf, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0x50, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xfe, 0xef,
-    0xff, 0xe7, 0x0, 0x0, 0x4, 0xff, 0xe8, 0x20,
-    0x0, 0x4, 0x9f, 0xfa, 0x0, 0x3, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0x70, 0x0, 0xef,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0xef, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0xd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x2f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x0, 0x0, 0x3e, 0xfe, 0x82, 0x0, 0x0,
-    0x39, 0xff, 0xc0, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xee, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2,
-    0x8c, 0xef, 0xfd, 0xa6, 0x10, 0x0,
-
-    /* U+0048 "H" */
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x9d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xdf, 0xed, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xef, 0x9d, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9,
-
-    /* U+0049 "I" */
-    0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d,
-    0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf,
-    0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4,
-    0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4,
-
-    /* U+004A "J" */
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2d,
-    0xdd, 0xdd, 0xdd, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0x8, 0xb0, 0x0, 0x0, 0x9, 0xf9, 0xd, 0xfc,
-    0x30, 0x0, 0x7f, 0xf3, 0x1, 0xcf, 0xfe, 0xdf,
+    /* U+0046 */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd8, 0xdf, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xdf, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0x50, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0047 */
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x60, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xfe, 0xef,
+    0xff, 0xe7, 0x0, 0x0, 0x4, 0xff, 0xe8, 0x20, 0x0, 0x4, 0x9f, 0xfa, 0x0, 0x3, 0xff, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0x70, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xf0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0xef, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0xd,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x2f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x0, 0x0, 0x3e, 0xfe, 0x82, 0x0, 0x0, 0x39, 0xff, 0xc0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xee, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa6, 0x10, 0x0,
+    /* U+0048 */
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0xdf, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xef, 0x9d, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
+    /* U+0049 */
+    0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf,
+    0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4, 0xdf, 0x4d, 0xf4,
+    /* U+004A */
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2d, 0xdd, 0xdd, 0xdd, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
+    0x8, 0xb0, 0x0, 0x0, 0x9, 0xf9, 0xd, 0xfc, 0x30, 0x0, 0x7f, 0xf3, 0x1, 0xcf, 0xfe, 0xdf,
     0xff, 0x70, 0x0, 0x6, 0xbe, 0xfe, 0xa3, 0x0,
-
-    /* U+004B "K" */
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x9, 0xfc,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x9, 0xfd,
-    0x10, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x8, 0xfd,
-    0x10, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x7, 0xfe,
-    0x10, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x6, 0xfe,
-    0x20, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x6, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x5, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x4, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x44, 0xff,
-    0xef, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0xff,
-    0x61, 0xef, 0xa0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x70, 0x3, 0xff, 0x80, 0x0, 0x0, 0xd, 0xff,
-    0x70, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0xdf,
-    0x80, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf7, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf5,
-
-    /* U+004C "L" */
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xd3, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3,
-
-    /* U+004D "M" */
-    0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x8d, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf8, 0xdf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x8d,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf8, 0xdf, 0xcf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xbf, 0x8d, 0xf4, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xb7, 0xf8, 0xdf,
-    0x36, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0x8d, 0xf3, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0x6, 0xf8, 0x7, 0xf8, 0xdf, 0x30, 0x4f, 0xc0,
-    0x0, 0x0, 0x1, 0xee, 0x10, 0x7f, 0x8d, 0xf3,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x9f, 0x60, 0x7,
-    0xf8, 0xdf, 0x30, 0x2, 0xfe, 0x0, 0x0, 0x2f,
-    0xd0, 0x0, 0x7f, 0x8d, 0xf3, 0x0, 0x8, 0xf7,
-    0x0, 0xb, 0xf4, 0x0, 0x7, 0xf8, 0xdf, 0x30,
-    0x0, 0xe, 0xf1, 0x4, 0xfb, 0x0, 0x0, 0x7f,
-    0x8d, 0xf3, 0x0, 0x0, 0x6f, 0xa0, 0xdf, 0x20,
-    0x0, 0x7, 0xf8, 0xdf, 0x30, 0x0, 0x0, 0xcf,
-    0x9f, 0x80, 0x0, 0x0, 0x7f, 0x8d, 0xf3, 0x0,
-    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xf8,
-    0xdf, 0x30, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0x0, 0x7f, 0x8d, 0xf3, 0x0, 0x0, 0x0, 0x16,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0xdf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x8d,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+004B */
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfb,
+    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x9, 0xfd,
+    0x10, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x8, 0xfd, 0x10, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x7, 0xfe,
+    0x10, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x6, 0xfe, 0x20, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x6, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x5, 0xff, 0x30, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x4, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x44, 0xff, 0xef, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0xff,
+    0x61, 0xef, 0xa0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x70, 0x3, 0xff, 0x80, 0x0, 0x0, 0xd, 0xff,
+    0x70, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0xd,
+    0xf4, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0xb, 0xfc, 0x0,
+    0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfa, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xf7, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5,
+    /* U+004C */
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xd3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+    /* U+004D */
+    0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x8d, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1e, 0xf8, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x8d,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf8, 0xdf, 0xcf, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xbf, 0x8d, 0xf4, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xb7, 0xf8, 0xdf,
+    0x36, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x7f, 0x8d, 0xf3, 0xd, 0xf3, 0x0, 0x0, 0x0,
+    0x6, 0xf8, 0x7, 0xf8, 0xdf, 0x30, 0x4f, 0xc0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x7f, 0x8d, 0xf3,
+    0x0, 0xbf, 0x50, 0x0, 0x0, 0x9f, 0x60, 0x7, 0xf8, 0xdf, 0x30, 0x2, 0xfe, 0x0, 0x0, 0x2f,
+    0xd0, 0x0, 0x7f, 0x8d, 0xf3, 0x0, 0x8, 0xf7, 0x0, 0xb, 0xf4, 0x0, 0x7, 0xf8, 0xdf, 0x30,
+    0x0, 0xe, 0xf1, 0x4, 0xfb, 0x0, 0x0, 0x7f, 0x8d, 0xf3, 0x0, 0x0, 0x6f, 0xa0, 0xdf, 0x20,
+    0x0, 0x7, 0xf8, 0xdf, 0x30, 0x0, 0x0, 0xcf, 0x9f, 0x80, 0x0, 0x0, 0x7f, 0x8d, 0xf3, 0x0,
+    0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xf8, 0xdf, 0x30, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
+    0x0, 0x7f, 0x8d, 0xf3, 0x0, 0x0, 0x0, 0x16, 0x0, 0x0, 0x0, 0x7, 0xf8, 0xdf, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x8d, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x7, 0xf8,
-
-    /* U+004E "N" */
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x9d, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf9, 0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x9d, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0xdf, 0x7f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x9d, 0xf4, 0x6f, 0xf3, 0x0, 0x0,
-    0x0, 0x7, 0xf9, 0xdf, 0x40, 0x9f, 0xe1, 0x0,
-    0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0xcf, 0xb0,
-    0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x2, 0xef,
-    0x80, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x4,
-    0xff, 0x40, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0,
-    0x8, 0xfe, 0x20, 0x0, 0x7f, 0x9d, 0xf4, 0x0,
-    0x0, 0xb, 0xfc, 0x0, 0x7, 0xf9, 0xdf, 0x40,
-    0x0, 0x0, 0x1e, 0xfa, 0x0, 0x7f, 0x9d, 0xf4,
-    0x0, 0x0, 0x0, 0x3f, 0xf6, 0x7, 0xf9, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x7f, 0x9d,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe8, 0xf9,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xf9,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xee, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xa0, 0x0, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0xef, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x90, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20,
-    0x0, 0x4, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x1a, 0xff, 0xff, 0xee, 0xff, 0xfe, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda,
-    0x50, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xdf, 0xff, 0xff, 0xff, 0xed, 0x94, 0x0, 0x0,
-    0xdf, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xc1, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x5d, 0xfe, 0x10,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x90,
-    0xdf, 0x40, 0x0, 0x0, 0x13, 0x8e, 0xfd, 0x10,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0xdf, 0xed, 0xdd, 0xdd, 0xca, 0x72, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
-    0xee, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0,
-    0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xa0, 0x0, 0x0, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x60, 0x3f, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xe0, 0x4f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x10, 0x1, 0xef, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
-    0x0, 0x3f, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xa0, 0x0, 0x0, 0x4, 0xef, 0xe7, 0x20,
-    0x0, 0x4, 0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xff, 0xde, 0xff, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xff, 0xfa,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xfa, 0x0, 0x0, 0x0, 0x52, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xd6, 0x10,
-    0x39, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
+    /* U+004E */
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xf9, 0xdf, 0x7f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x6f, 0xf3, 0x0, 0x0,
+    0x0, 0x7, 0xf9, 0xdf, 0x40, 0x9f, 0xe1, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0xcf, 0xb0,
+    0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x2, 0xef, 0x80, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x0, 0x4,
+    0xff, 0x40, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x8, 0xfe, 0x20, 0x0, 0x7f, 0x9d, 0xf4, 0x0,
+    0x0, 0xb, 0xfc, 0x0, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x1e, 0xfa, 0x0, 0x7f, 0x9d, 0xf4,
+    0x0, 0x0, 0x0, 0x3f, 0xf6, 0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x6f, 0xf3, 0x7f, 0x9d,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe8, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
+    0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9,
+    /* U+004F */
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xee, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0,
+    0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0xef, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xfe, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
+    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20,
+    0x0, 0x4, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
+    /* U+0050 */
+    0xdf, 0xff, 0xff, 0xff, 0xed, 0x94, 0x0, 0x0, 0xdf, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xc1, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x5d, 0xfe, 0x10, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x90, 0xdf, 0x40, 0x0, 0x0, 0x13, 0x8e, 0xfd, 0x10,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0, 0xdf, 0xed, 0xdd, 0xdd, 0xca, 0x72, 0x0, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0051 */
+    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xee, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xef, 0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0,
+    0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0xef, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xfe, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x3f, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xe0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xf,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x10, 0x1, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0,
+    0x0, 0x3f, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x5, 0xef, 0xa0, 0x0, 0x0, 0x4, 0xef, 0xe7, 0x20,
+    0x0, 0x4, 0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xde, 0xff, 0xfe, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xff, 0xfa, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xfa, 0x0, 0x0, 0x0, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xd6, 0x10,
+    0x39, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x16, 0x9a, 0x83, 0x0,
-
-    /* U+0052 "R" */
-    0xdf, 0xff, 0xff, 0xff, 0xed, 0x94, 0x0, 0x0,
-    0xdf, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xc2, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x5d, 0xfe, 0x10,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x90,
-    0xdf, 0x40, 0x0, 0x0, 0x13, 0x8e, 0xfc, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xdf, 0xdc, 0xcc, 0xcc, 0xbf, 0xf5, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
-
-    /* U+0053 "S" */
-    0x0, 0x1, 0x6b, 0xdf, 0xfe, 0xb7, 0x10, 0x0,
-    0x5, 0xef, 0xfe, 0xcd, 0xef, 0xff, 0x90, 0x4,
-    0xff, 0x92, 0x0, 0x0, 0x27, 0xec, 0x0, 0xcf,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x20, 0x1f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfc,
-    0x73, 0x0, 0x0, 0x0, 0x0, 0x16, 0xae, 0xff,
-    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7d,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x3d, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x87,
-    0xff, 0xa4, 0x0, 0x0, 0x3, 0xbf, 0xd1, 0x5,
-    0xdf, 0xff, 0xec, 0xdf, 0xff, 0xc2, 0x0, 0x0,
+    /* U+0052 */
+    0xdf, 0xff, 0xff, 0xff, 0xed, 0x94, 0x0, 0x0, 0xdf, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xc2, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x5d, 0xfe, 0x10, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf1,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x90, 0xdf, 0x40, 0x0, 0x0, 0x13, 0x8e, 0xfc, 0x0,
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0xdf, 0xdc, 0xcc, 0xcc, 0xbf, 0xf5, 0x0, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x3, 0xff, 0x20,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf7,
+    /* U+0053 */
+    0x0, 0x1, 0x6b, 0xdf, 0xfe, 0xb7, 0x10, 0x0, 0x5, 0xef, 0xfe, 0xcd, 0xef, 0xff, 0x90, 0x4,
+    0xff, 0x92, 0x0, 0x0, 0x27, 0xec, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x20, 0x1f, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xfc, 0x73, 0x0, 0x0, 0x0, 0x0, 0x16, 0xae, 0xff,
+    0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3, 0x7d, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x3d, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x87,
+    0xff, 0xa4, 0x0, 0x0, 0x3, 0xbf, 0xd1, 0x5, 0xdf, 0xff, 0xec, 0xdf, 0xff, 0xc2, 0x0, 0x0,
     0x49, 0xce, 0xfe, 0xda, 0x50, 0x0,
-
-    /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xbd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdc,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xef, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x9f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x4,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
-    0x0, 0x2e, 0xfd, 0x50, 0x0, 0x4, 0xbf, 0xf3,
-    0x0, 0x0, 0x2d, 0xff, 0xfe, 0xef, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60,
-    0x0, 0x0,
-
-    /* U+0056 "V" */
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf4, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xd0, 0xd, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x6, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0x0, 0x0, 0x1f, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0xa,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x4, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0,
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0,
-    0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfb, 0x0, 0x1, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x7,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x90, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf1, 0x5f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf7, 0xcf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0054 */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xdd, 0xdd, 0xdf, 0xfd, 0xdd, 0xdd, 0xdc,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0,
+    /* U+0055 */
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xef, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x4,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0xc, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe0,
+    0x0, 0x2e, 0xfd, 0x50, 0x0, 0x4, 0xbf, 0xf3, 0x0, 0x0, 0x2d, 0xff, 0xfe, 0xef, 0xff, 0xe3,
+    0x0, 0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0, 0x0,
+    /* U+0056 */
+    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xd0, 0xd, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x6, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xf8, 0x0, 0x0, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x1f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0,
+    0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0,
+    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf4, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x1, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0x90, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf1, 0x5f, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xf7, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x2f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x40, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x9f, 0xc0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x1e, 0xf1, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
-    0x3, 0xfb, 0x9, 0xf7, 0x0, 0x0, 0x0, 0xb,
-    0xf4, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x8,
-    0xf5, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0xe, 0xf0,
-    0x0, 0xef, 0x10, 0x0, 0x0, 0x6f, 0x90, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x3f, 0xa0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x3f,
-    0xc0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x8,
-    0xf9, 0x0, 0x0, 0xef, 0x0, 0x0, 0xe, 0xf1,
-    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x3, 0xfa, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x9, 0xf5, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x1f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x5f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x4f, 0xa0,
-    0x0, 0x0, 0x0, 0x8f, 0x70, 0xbf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0xef, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xa0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0xb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe1, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x40, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0,
-    0xa, 0xf9, 0x0, 0x0, 0x8, 0xfd, 0x0, 0x0,
-    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0x90,
-    0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2f,
-    0xf4, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xfe, 0x10, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xb4, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xea,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x30, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf8, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xc0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x20, 0x0, 0x0, 0xbf, 0xa0, 0x0,
-    0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x1e, 0xf5,
-    0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x20, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
+    /* U+0057 */
+    0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x7f,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0x2f, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0xd, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x7, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x1e, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
+    0x3, 0xfb, 0x9, 0xf7, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x8,
+    0xf5, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0xe, 0xf0,
+    0x0, 0xef, 0x10, 0x0, 0x0, 0x6f, 0x90, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x3f, 0xa0, 0x0,
+    0x9f, 0x70, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x3f,
+    0xc0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0xef, 0x0, 0x0, 0xe, 0xf1,
+    0x0, 0x6, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x8, 0xf7, 0x0,
+    0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x9, 0xf5, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x1f,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0xe, 0xf0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x5f, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x4f, 0xa0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0xbf, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf4, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xf9, 0xef, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xa0, 0x0, 0x0, 0x0,
+    /* U+0058 */
+    0xb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1, 0x1, 0xef, 0x60, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0x40, 0x0, 0x4f, 0xf2, 0x0, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x8, 0xfd, 0x0, 0x0,
+    0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0, 0x2, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2f,
+    0xf4, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x9f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xb4, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xea, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x30, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xc0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0xbf, 0xa0, 0x0,
+    0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0xbf, 0xa0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x20, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0, 0x3f, 0xf3, 0x0, 0x0, 0x0,
     0x0, 0x0, 0xd, 0xf8,
-
-    /* U+0059 "Y" */
-    0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf7, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x40, 0x0, 0xdf, 0x50, 0x0, 0x0,
-    0x0, 0x6, 0xfa, 0x0, 0x0, 0x4f, 0xe0, 0x0,
-    0x0, 0x0, 0x1e, 0xf1, 0x0, 0x0, 0xa, 0xf8,
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x1,
-    0xff, 0x20, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xb0, 0x0, 0xc, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf5, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfe, 0x1, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x89, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
+    /* U+0059 */
+    0xaf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xd0, 0x7, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0xdf, 0x50, 0x0, 0x0,
+    0x0, 0x6, 0xfa, 0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x1e, 0xf1, 0x0, 0x0, 0xa, 0xf8,
+    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xb0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x6f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xfe, 0x1, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x89, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
     0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5,
-
-    /* U+005B "[" */
-    0xdf, 0xff, 0xf5, 0xdf, 0xba, 0xa3, 0xdf, 0x30,
-    0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf,
-    0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0,
-    0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30,
-    0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf,
-    0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0,
-    0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30,
-    0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf,
-    0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0,
-    0xdf, 0xba, 0xa3, 0xdf, 0xff, 0xf5,
-
-    /* U+005C "\\" */
-    0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    /* U+005A */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    /* U+005B */
+    0xdf, 0xff, 0xf5, 0xdf, 0xba, 0xa3, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf,
+    0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30,
+    0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0,
+    0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf,
+    0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0x30, 0x0, 0xdf, 0xba, 0xa3, 0xdf, 0xff, 0xf5,
+    /* U+005C */
+    0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xed, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x80, 0x0, 0x0, 0x0, 0x0,
     0xe, 0xe0,
-
-    /* U+005D "]" */
-    0x6f, 0xff, 0xfb, 0x4a, 0xac, 0xfb, 0x0, 0x4,
-    0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0,
-    0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb,
-    0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4,
-    0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0,
-    0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb,
-    0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4,
-    0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0,
-    0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb,
-    0x4a, 0xac, 0xfb, 0x6f, 0xff, 0xfb,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x7, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xae, 0xdc,
-    0x0, 0x0, 0x0, 0x1, 0xf8, 0x6f, 0x30, 0x0,
-    0x0, 0x7, 0xf1, 0xe, 0xa0, 0x0, 0x0, 0xe,
-    0xa0, 0x8, 0xf1, 0x0, 0x0, 0x5f, 0x40, 0x2,
-    0xf7, 0x0, 0x0, 0xcd, 0x0, 0x0, 0xbe, 0x0,
-    0x2, 0xf6, 0x0, 0x0, 0x4f, 0x50, 0x9, 0xf0,
-    0x0, 0x0, 0xe, 0xb0, 0x1f, 0x90, 0x0, 0x0,
+    /* U+005D */
+    0x6f, 0xff, 0xfb, 0x4a, 0xac, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0,
+    0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4,
+    0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb,
+    0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0,
+    0x4, 0xfb, 0x0, 0x4, 0xfb, 0x0, 0x4, 0xfb, 0x4a, 0xac, 0xfb, 0x6f, 0xff, 0xfb,
+    /* U+005E */
+    0x0, 0x0, 0x7, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xae, 0xdc,
+    0x0, 0x0, 0x0, 0x1, 0xf8, 0x6f, 0x30, 0x0, 0x0, 0x7, 0xf1, 0xe, 0xa0, 0x0, 0x0, 0xe,
+    0xa0, 0x8, 0xf1, 0x0, 0x0, 0x5f, 0x40, 0x2, 0xf7, 0x0, 0x0, 0xcd, 0x0, 0x0, 0xbe, 0x0,
+    0x2, 0xf6, 0x0, 0x0, 0x4f, 0x50, 0x9, 0xf0, 0x0, 0x0, 0xe, 0xb0, 0x1f, 0x90, 0x0, 0x0,
     0x7, 0xf2, 0x7f, 0x20, 0x0, 0x0, 0x1, 0xf9,
-
-    /* U+005F "_" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x44,
+    /* U+005F */
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x44,
     0x44, 0x44, 0x44, 0x44, 0x44,
-
-    /* U+0060 "`" */
-    0x7, 0x85, 0x0, 0x0, 0x2, 0xdf, 0x70, 0x0,
-    0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-
-    /* U+0061 "a" */
-    0x0, 0x6, 0xae, 0xff, 0xd9, 0x20, 0x0, 0x6e,
-    0xff, 0xec, 0xdf, 0xff, 0x50, 0xc, 0xe7, 0x10,
-    0x0, 0x19, 0xff, 0x20, 0x21, 0x0, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0,
-    0x2, 0x57, 0x78, 0x88, 0x8f, 0xe0, 0x1b, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xc, 0xfb, 0x31, 0x0,
-    0x0, 0x1f, 0xe4, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xe5,
-    0xfa, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x1f, 0xf4,
-    0x0, 0x0, 0x9, 0xff, 0xe0, 0x5f, 0xfb, 0x87,
-    0x9e, 0xf4, 0xfe, 0x0, 0x29, 0xdf, 0xfd, 0x81,
+    /* U+0060 */
+    0x7, 0x85, 0x0, 0x0, 0x2, 0xdf, 0x70, 0x0, 0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xa0,
+    /* U+0061 */
+    0x0, 0x6, 0xae, 0xff, 0xd9, 0x20, 0x0, 0x6e, 0xff, 0xec, 0xdf, 0xff, 0x50, 0xc, 0xe7, 0x10,
+    0x0, 0x19, 0xff, 0x20, 0x21, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x2, 0x57, 0x78, 0x88, 0x8f, 0xe0, 0x1b, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xc, 0xfb, 0x31, 0x0, 0x0, 0x1f, 0xe4, 0xfc, 0x0, 0x0, 0x0, 0x1,
+    0xfe, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xe5, 0xfa, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x1f, 0xf4,
+    0x0, 0x0, 0x9, 0xff, 0xe0, 0x5f, 0xfb, 0x87, 0x9e, 0xf4, 0xfe, 0x0, 0x29, 0xdf, 0xfd, 0x81,
     0xf, 0xe0,
-
-    /* U+0062 "b" */
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x6, 0xbe, 0xfd, 0xa4, 0x0, 0x0,
-    0x3f, 0xc1, 0xcf, 0xfd, 0xce, 0xff, 0xb1, 0x0,
-    0x3f, 0xdd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x0,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x3f, 0xbd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x0,
-    0x3f, 0xa2, 0xcf, 0xfd, 0xdf, 0xff, 0xb1, 0x0,
+    /* U+0062 */
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xc0, 0x6, 0xbe, 0xfd, 0xa4, 0x0, 0x0, 0x3f, 0xc1, 0xcf, 0xfd, 0xce, 0xff, 0xb1, 0x0,
+    0x3f, 0xdd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf, 0xa0,
+    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
+    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
+    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
+    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf, 0xa0,
+    0x3f, 0xbd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x0, 0x3f, 0xa2, 0xcf, 0xfd, 0xdf, 0xff, 0xb1, 0x0,
     0x3f, 0xa0, 0x6, 0xbe, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x1b, 0xff, 0xed, 0xdf, 0xff, 0x60, 0x0, 0xdf,
-    0xd4, 0x0, 0x0, 0x7f, 0xf4, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xa1, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xa1, 0x0, 0xdf, 0xd4, 0x0,
-    0x0, 0x7f, 0xf4, 0x0, 0x1b, 0xff, 0xfd, 0xdf,
-    0xff, 0x60, 0x0, 0x0, 0x4a, 0xdf, 0xfd, 0x82,
-    0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x60, 0xc, 0xf3,
-    0x0, 0x1c, 0xff, 0xec, 0xdf, 0xfc, 0x1c, 0xf3,
-    0x1, 0xef, 0xd4, 0x0, 0x1, 0x7f, 0xcd, 0xf3,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-    0xa, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3,
-    0x1, 0xdf, 0xb2, 0x0, 0x0, 0x5f, 0xdc, 0xf3,
-    0x0, 0x1c, 0xff, 0xca, 0xbe, 0xfd, 0x2b, 0xf3,
+    /* U+0063 */
+    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0, 0x1b, 0xff, 0xed, 0xdf, 0xff, 0x60, 0x0, 0xdf,
+    0xd4, 0x0, 0x0, 0x7f, 0xf4, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xa1, 0x1f, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
+    0x0, 0x0, 0x3, 0xa1, 0x0, 0xdf, 0xd4, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x1b, 0xff, 0xfd, 0xdf,
+    0xff, 0x60, 0x0, 0x0, 0x4a, 0xdf, 0xfd, 0x82, 0x0,
+    /* U+0064 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x60, 0xc, 0xf3, 0x0, 0x1c, 0xff, 0xec, 0xdf, 0xfc, 0x1c, 0xf3,
+    0x1, 0xef, 0xd4, 0x0, 0x1, 0x7f, 0xcd, 0xf3, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
+    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
+    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0xa, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3,
+    0x1, 0xdf, 0xb2, 0x0, 0x0, 0x5f, 0xdc, 0xf3, 0x0, 0x1c, 0xff, 0xca, 0xbe, 0xfd, 0x2b, 0xf3,
     0x0, 0x0, 0x4a, 0xdf, 0xec, 0x60, 0xb, 0xf3,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x5b, 0xef, 0xeb, 0x50, 0x0, 0x0,
-    0x1, 0xcf, 0xfd, 0xcd, 0xff, 0xc1, 0x0, 0x1,
-    0xef, 0x91, 0x0, 0x1, 0xaf, 0xd0, 0x0, 0xaf,
-    0x80, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x17, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x9f, 0xa8, 0x88,
-    0x88, 0x88, 0x88, 0xaf, 0x8b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0,
-    0x7, 0x0, 0x0, 0xcf, 0xd4, 0x0, 0x0, 0x4c,
-    0xf7, 0x0, 0x0, 0xaf, 0xff, 0xdd, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0,
+    /* U+0065 */
+    0x0, 0x0, 0x5b, 0xef, 0xeb, 0x50, 0x0, 0x0, 0x1, 0xcf, 0xfd, 0xcd, 0xff, 0xc1, 0x0, 0x1,
+    0xef, 0x91, 0x0, 0x1, 0xaf, 0xd0, 0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x2f, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x17, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x9f, 0xa8, 0x88,
+    0x88, 0x88, 0x88, 0xaf, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0xcf, 0xd4, 0x0, 0x0, 0x4c,
+    0xf7, 0x0, 0x0, 0xaf, 0xff, 0xdd, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0,
     0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x19, 0xef, 0xd9, 0x10, 0x0, 0x1e,
-    0xfe, 0xbd, 0xf3, 0x0, 0x9, 0xfa, 0x0, 0x2,
-    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf9, 0x5, 0xbb,
-    0xff, 0xbb, 0xbb, 0x60, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe,
+    /* U+0066 */
+    0x0, 0x0, 0x19, 0xef, 0xd9, 0x10, 0x0, 0x1e, 0xfe, 0xbd, 0xf3, 0x0, 0x9, 0xfa, 0x0, 0x2,
+    0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x0, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf9, 0x5, 0xbb, 0xff, 0xbb, 0xbb, 0x60, 0x0, 0xe, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
+    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe,
     0xf1, 0x0, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x71, 0x8, 0xf6,
-    0x0, 0x2d, 0xff, 0xec, 0xdf, 0xfe, 0x48, 0xf6,
-    0x2, 0xef, 0xb3, 0x0, 0x0, 0x5d, 0xfb, 0xf6,
-    0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6,
-    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0xa, 0xfc, 0x10, 0x0, 0x0, 0x3, 0xef, 0xf6,
-    0x0, 0xdf, 0xe7, 0x20, 0x13, 0x9f, 0xda, 0xf6,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xfb, 0x29, 0xf6,
-    0x0, 0x0, 0x27, 0xac, 0xb8, 0x30, 0x9, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0,
-    0x9, 0xfe, 0x72, 0x0, 0x0, 0x2a, 0xff, 0x20,
-    0x0, 0x9f, 0xff, 0xed, 0xce, 0xff, 0xe4, 0x0,
-    0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
-
-    /* U+0068 "h" */
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x7,
-    0xce, 0xfe, 0xa3, 0x0, 0x3, 0xfc, 0x3e, 0xff,
-    0xdd, 0xff, 0xf8, 0x0, 0x3f, 0xde, 0xd5, 0x0,
-    0x0, 0x8f, 0xf5, 0x3, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x7f, 0xd0, 0x3f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x13, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf4, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x53,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x53, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-
-    /* U+0069 "i" */
-    0x4e, 0xb0, 0x9f, 0xf2, 0x3c, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x3f, 0xc0,
-    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0,
-    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0,
-    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0,
-    0x3f, 0xc0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x2, 0xed, 0x10, 0x0, 0x0, 0x7f,
-    0xf5, 0x0, 0x0, 0x1, 0xba, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
-    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1,
-    0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f,
-    0xe0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x3, 0xfd, 0x0,
-    0x30, 0x0, 0xbf, 0x90, 0x4f, 0xdc, 0xef, 0xe1,
+    /* U+0067 */
+    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x71, 0x8, 0xf6, 0x0, 0x2d, 0xff, 0xec, 0xdf, 0xfe, 0x48, 0xf6,
+    0x2, 0xef, 0xb3, 0x0, 0x0, 0x5d, 0xfb, 0xf6, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6,
+    0x4f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf6,
+    0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
+    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6, 0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
+    0xa, 0xfc, 0x10, 0x0, 0x0, 0x3, 0xef, 0xf6, 0x0, 0xdf, 0xe7, 0x20, 0x13, 0x9f, 0xda, 0xf6,
+    0x0, 0x9, 0xff, 0xff, 0xff, 0xfb, 0x29, 0xf6, 0x0, 0x0, 0x27, 0xac, 0xb8, 0x30, 0x9, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
+    0x1, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x9, 0xfe, 0x72, 0x0, 0x0, 0x2a, 0xff, 0x20,
+    0x0, 0x9f, 0xff, 0xed, 0xce, 0xff, 0xe4, 0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
+    /* U+0068 */
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x7,
+    0xce, 0xfe, 0xa3, 0x0, 0x3, 0xfc, 0x3e, 0xff, 0xdd, 0xff, 0xf8, 0x0, 0x3f, 0xde, 0xd5, 0x0,
+    0x0, 0x8f, 0xf5, 0x3, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x3f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x13, 0xff, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x53,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x53, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
+    /* U+0069 */
+    0x4e, 0xb0, 0x9f, 0xf2, 0x3c, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x3f, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0,
+    0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0,
+    /* U+006A */
+    0x0, 0x0, 0x2, 0xed, 0x10, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x1, 0xba, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0,
+    0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1,
+    0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
+    0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f,
+    0xe0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x0,
+    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x30, 0x0, 0xbf, 0x90, 0x4f, 0xdc, 0xef, 0xe1,
     0x1, 0xad, 0xfe, 0xa2, 0x0,
-
-    /* U+006B "k" */
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x2d, 0xf8, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x2e, 0xf7, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x3e, 0xf7, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x4f,
-    0xf6, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x4f, 0xf6,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x5f, 0xf5, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x6f, 0xfe, 0x10, 0x0,
-    0x0, 0x3, 0xfc, 0x7f, 0xfc, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xe3, 0x1e, 0xf8, 0x0, 0x0,
-    0x3, 0xff, 0xe2, 0x0, 0x3f, 0xf5, 0x0, 0x0,
-    0x3f, 0xe2, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0x70, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-
-    /* U+006C "l" */
-    0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3,
-    0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f,
-    0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc,
-    0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc0,
-
-    /* U+006D "m" */
-    0x3f, 0xa0, 0x18, 0xdf, 0xfd, 0x81, 0x0, 0x1,
-    0x8c, 0xef, 0xd9, 0x20, 0x0, 0x3f, 0xa4, 0xef,
-    0xdb, 0xcf, 0xfe, 0x30, 0x5f, 0xfe, 0xbc, 0xff,
-    0xf5, 0x0, 0x3f, 0xdf, 0xc2, 0x0, 0x1, 0xaf,
-    0xe5, 0xfd, 0x30, 0x0, 0x8, 0xff, 0x20, 0x3f,
-    0xfc, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0xaf, 0x90, 0x3f, 0xf4, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
+    /* U+006B */
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
+    0x0, 0x0, 0x2d, 0xf8, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x2e, 0xf7, 0x0, 0x3f, 0xc0, 0x0, 0x0,
+    0x3e, 0xf7, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x4f, 0xf6, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x4f, 0xf6,
+    0x0, 0x0, 0x3, 0xfc, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x6f, 0xfe, 0x10, 0x0,
+    0x0, 0x3, 0xfc, 0x7f, 0xfc, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xe3, 0x1e, 0xf8, 0x0, 0x0,
+    0x3, 0xff, 0xe2, 0x0, 0x3f, 0xf5, 0x0, 0x0, 0x3f, 0xe2, 0x0, 0x0, 0x6f, 0xf2, 0x0, 0x3,
+    0xfc, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x3, 0xfc,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0x70, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
+    /* U+006C */
+    0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f,
+    0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc3, 0xfc, 0x3f, 0xc0,
+    /* U+006D */
+    0x3f, 0xa0, 0x18, 0xdf, 0xfd, 0x81, 0x0, 0x1, 0x8c, 0xef, 0xd9, 0x20, 0x0, 0x3f, 0xa4, 0xef,
+    0xdb, 0xcf, 0xfe, 0x30, 0x5f, 0xfe, 0xbc, 0xff, 0xf5, 0x0, 0x3f, 0xdf, 0xc2, 0x0, 0x1, 0xaf,
+    0xe5, 0xfd, 0x30, 0x0, 0x8, 0xff, 0x20, 0x3f, 0xfc, 0x0, 0x0, 0x0, 0xc, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0xaf, 0x90, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3f,
+    0xe0, 0x3f, 0xf0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x3f, 0xc0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f,
+    0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
     0x0, 0xe, 0xf1,
-
-    /* U+006E "n" */
-    0x3f, 0xa0, 0x17, 0xce, 0xfe, 0xa3, 0x0, 0x3,
-    0xfa, 0x4e, 0xfe, 0xbc, 0xef, 0xf8, 0x0, 0x3f,
-    0xdf, 0xc3, 0x0, 0x0, 0x6f, 0xf5, 0x3, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x3f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x13, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf4, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0x53, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    /* U+006E */
+    0x3f, 0xa0, 0x17, 0xce, 0xfe, 0xa3, 0x0, 0x3, 0xfa, 0x4e, 0xfe, 0xbc, 0xef, 0xf8, 0x0, 0x3f,
+    0xdf, 0xc3, 0x0, 0x0, 0x6f, 0xf5, 0x3, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x3f, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x13, 0xff, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x3f, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
     0x50,
-
-    /* U+006F "o" */
+    /* U+006F */
+    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0,
+    0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
+    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
+    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
+    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0, 0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
+    0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0, 0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
     0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0,
-    0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x3f, 0xa0, 0x6, 0xbe, 0xfd, 0xa4, 0x0, 0x0,
-    0x3f, 0xa2, 0xdf, 0xeb, 0xbd, 0xff, 0xb1, 0x0,
-    0x3f, 0xcd, 0xf6, 0x0, 0x0, 0x2c, 0xfd, 0x0,
-    0x3f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x3f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x3f, 0xdd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x10,
-    0x3f, 0xc1, 0xcf, 0xfd, 0xdf, 0xff, 0xc1, 0x0,
-    0x3f, 0xc0, 0x6, 0xbe, 0xfd, 0xb4, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x50, 0xb, 0xf3,
-    0x0, 0x1c, 0xff, 0xec, 0xdf, 0xfc, 0x1b, 0xf3,
-    0x1, 0xef, 0xd4, 0x0, 0x1, 0x8f, 0xdb, 0xf3,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
-    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0xa, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
-    0x1, 0xef, 0xd4, 0x0, 0x1, 0x7f, 0xdd, 0xf3,
-    0x0, 0x1c, 0xff, 0xfd, 0xdf, 0xfc, 0x1c, 0xf3,
-    0x0, 0x0, 0x5b, 0xdf, 0xeb, 0x60, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-
-    /* U+0072 "r" */
-    0x3f, 0xa0, 0x18, 0xde, 0x23, 0xfa, 0x3e, 0xff,
-    0xf2, 0x3f, 0xbe, 0xe6, 0x10, 0x3, 0xff, 0xe2,
-    0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x3, 0xff,
-    0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f,
+    /* U+0070 */
+    0x3f, 0xa0, 0x6, 0xbe, 0xfd, 0xa4, 0x0, 0x0, 0x3f, 0xa2, 0xdf, 0xeb, 0xbd, 0xff, 0xb1, 0x0,
+    0x3f, 0xcd, 0xf6, 0x0, 0x0, 0x2c, 0xfd, 0x0, 0x3f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xa0,
+    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
+    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9, 0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
+    0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x3f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf, 0xa0,
+    0x3f, 0xdd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x10, 0x3f, 0xc1, 0xcf, 0xfd, 0xdf, 0xff, 0xc1, 0x0,
+    0x3f, 0xc0, 0x6, 0xbe, 0xfd, 0xb4, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+0071 */
+    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x50, 0xb, 0xf3, 0x0, 0x1c, 0xff, 0xec, 0xdf, 0xfc, 0x1b, 0xf3,
+    0x1, 0xef, 0xd4, 0x0, 0x1, 0x8f, 0xdb, 0xf3, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
+    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3,
+    0x2f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0xa, 0xfc, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+    0x1, 0xef, 0xd4, 0x0, 0x1, 0x7f, 0xdd, 0xf3, 0x0, 0x1c, 0xff, 0xfd, 0xdf, 0xfc, 0x1c, 0xf3,
+    0x0, 0x0, 0x5b, 0xdf, 0xeb, 0x60, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
+    /* U+0072 */
+    0x3f, 0xa0, 0x18, 0xde, 0x23, 0xfa, 0x3e, 0xff, 0xf2, 0x3f, 0xbe, 0xe6, 0x10, 0x3, 0xff, 0xe2,
+    0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x3, 0xff, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x3,
+    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
+    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f,
     0xc0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x3, 0xad, 0xff, 0xeb, 0x61, 0x0, 0x8,
-    0xff, 0xec, 0xcd, 0xff, 0xf1, 0x4, 0xff, 0x40,
-    0x0, 0x1, 0x7a, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xfa, 0x63, 0x0, 0x0, 0x0, 0x1, 0x8e,
-    0xff, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x2, 0x58,
-    0xcf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0,
-    0x20, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xd, 0xd6,
-    0x10, 0x0, 0x3, 0xef, 0x50, 0xaf, 0xff, 0xdc,
-    0xce, 0xff, 0x90, 0x0, 0x28, 0xce, 0xff, 0xda,
+    /* U+0073 */
+    0x0, 0x3, 0xad, 0xff, 0xeb, 0x61, 0x0, 0x8, 0xff, 0xec, 0xcd, 0xff, 0xf1, 0x4, 0xff, 0x40,
+    0x0, 0x1, 0x7a, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfa, 0x63, 0x0, 0x0, 0x0, 0x1, 0x8e,
+    0xff, 0xff, 0xc7, 0x0, 0x0, 0x0, 0x2, 0x58, 0xcf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1c,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xb0, 0x20, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xd, 0xd6,
+    0x10, 0x0, 0x3, 0xef, 0x50, 0xaf, 0xff, 0xdc, 0xce, 0xff, 0x90, 0x0, 0x28, 0xce, 0xff, 0xda,
     0x30, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xf9, 0x5, 0xbb, 0xff, 0xbb, 0xbb,
-    0x60, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0x9, 0xfb, 0x0, 0x4, 0x0, 0x0, 0x2e,
-    0xfe, 0xcd, 0xf4, 0x0, 0x0, 0x2a, 0xef, 0xe9,
-    0x10,
-
-    /* U+0075 "u" */
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x5f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x5, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x0, 0xef, 0x50, 0x0, 0x0, 0x1,
-    0xef, 0xf0, 0x6, 0xff, 0x50, 0x0, 0x3, 0xdd,
-    0xef, 0x0, 0x8, 0xff, 0xeb, 0xbd, 0xfd, 0x2d,
-    0xf0, 0x0, 0x3, 0xae, 0xfe, 0xc7, 0x0, 0xdf,
+    /* U+0074 */
+    0x0, 0x7, 0x80, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf9, 0x5, 0xbb, 0xff, 0xbb, 0xbb,
+    0x60, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
+    0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0xe, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x4, 0x0, 0x0, 0x2e,
+    0xfe, 0xcd, 0xf4, 0x0, 0x0, 0x2a, 0xef, 0xe9, 0x10,
+    /* U+0075 */
+    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x6f,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x5f, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x2f, 0xe0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0x0, 0xef, 0x50, 0x0, 0x0, 0x1, 0xef, 0xf0, 0x6, 0xff, 0x50, 0x0, 0x3, 0xdd,
+    0xef, 0x0, 0x8, 0xff, 0xeb, 0xbd, 0xfd, 0x2d, 0xf0, 0x0, 0x3, 0xae, 0xfe, 0xc7, 0x0, 0xdf,
     0x0,
-
-    /* U+0076 "v" */
-    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
-    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0xc, 0xf2, 0x0,
-    0x0, 0x9f, 0x70, 0x0, 0x0, 0x3f, 0xb0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0xaf, 0x40, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x1, 0xfd, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x0, 0x8, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0xe, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x90, 0x6f, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf1, 0xdf, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    /* U+0076 */
+    0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70,
+    0xd, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xef, 0x10, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x5, 0xf9, 0x0,
+    0x1, 0xff, 0x10, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x3f, 0xb0, 0x0,
+    0x0, 0x2f, 0xe0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x1, 0xfd, 0x0, 0x0,
+    0x0, 0x4, 0xfc, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0xe, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0x90, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0xdf, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xfb, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x33, 0xfa, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x10, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x7f, 0x60,
-    0x0, 0x0, 0xd, 0xf7, 0xf7, 0x0, 0x0, 0x0,
-    0xbf, 0x10, 0x1, 0xfc, 0x0, 0x0, 0x3, 0xf9,
-    0xf, 0xd0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0xc,
-    0xf1, 0x0, 0x0, 0x8f, 0x30, 0xaf, 0x30, 0x0,
-    0x7, 0xf5, 0x0, 0x0, 0x6f, 0x70, 0x0, 0xe,
-    0xd0, 0x4, 0xf9, 0x0, 0x0, 0xdf, 0x0, 0x0,
-    0x0, 0xfd, 0x0, 0x4, 0xf7, 0x0, 0xe, 0xe0,
-    0x0, 0x3f, 0x90, 0x0, 0x0, 0xa, 0xf3, 0x0,
-    0xaf, 0x10, 0x0, 0x8f, 0x50, 0x8, 0xf3, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x1f, 0xb0, 0x0, 0x2,
-    0xfb, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0x6, 0xf5, 0x0, 0x0, 0xc, 0xf1, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x8, 0xf4, 0xce, 0x0, 0x0,
-    0x0, 0x6f, 0x6a, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xcf, 0x90, 0x0, 0x0, 0x0, 0xfd, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xc, 0xf6, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0,
-    0x1e, 0xf3, 0x0, 0x0, 0x3, 0xfd, 0x10, 0x0,
-    0x4f, 0xd0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0xcf, 0x60, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x1e,
-    0xf3, 0x0, 0x0, 0x0, 0x2, 0xef, 0x20, 0x3f,
-    0xe1, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x7f,
-    0xb0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0xbf,
-    0x80, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x1, 0xef,
-    0x40, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe,
+    /* U+0077 */
+    0x9f, 0x40, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x33, 0xfa, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xf, 0xd0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x10, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x7f, 0x60, 0x0, 0x0, 0xd, 0xf7, 0xf7, 0x0, 0x0, 0x0,
+    0xbf, 0x10, 0x1, 0xfc, 0x0, 0x0, 0x3, 0xf9, 0xf, 0xd0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0xc,
+    0xf1, 0x0, 0x0, 0x8f, 0x30, 0xaf, 0x30, 0x0, 0x7, 0xf5, 0x0, 0x0, 0x6f, 0x70, 0x0, 0xe,
+    0xd0, 0x4, 0xf9, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xfd, 0x0, 0x4, 0xf7, 0x0, 0xe, 0xe0,
+    0x0, 0x3f, 0x90, 0x0, 0x0, 0xa, 0xf3, 0x0, 0xaf, 0x10, 0x0, 0x8f, 0x50, 0x8, 0xf3, 0x0,
+    0x0, 0x0, 0x4f, 0x90, 0x1f, 0xb0, 0x0, 0x2, 0xfb, 0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0xee,
+    0x6, 0xf5, 0x0, 0x0, 0xc, 0xf1, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x8, 0xf4, 0xce, 0x0, 0x0,
+    0x0, 0x6f, 0x6a, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xcf, 0x90, 0x0, 0x0, 0x0, 0xfd, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
+    /* U+0078 */
+    0xc, 0xf6, 0x0, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x3, 0xfd, 0x10, 0x0,
+    0x4f, 0xd0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
+    0xcf, 0x60, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xef, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x1e, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xef, 0x20, 0x3f,
+    0xe1, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0xbf,
+    0x80, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x1, 0xef, 0x40, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x3, 0xfe,
     0x10,
-
-    /* U+0079 "y" */
-    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0x70, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0xe,
-    0xf0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x6,
-    0xf8, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0,
-    0xdf, 0x10, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
-    0x4f, 0xa0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0,
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0,
-    0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x50, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x8, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf5, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0x80, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfc, 0xcf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7d, 0xfe, 0xb3, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+007A "z" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa1, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    /* U+0079 */
+    0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x70, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0xe, 0xf0, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x6,
+    0xf8, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
+    0x4f, 0xa0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
+    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0x50, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x8, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xf5, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
+    0x1, 0x80, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0xcf, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7d, 0xfe, 0xb3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    /* U+007A */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7, 0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0xdf, 0xff, 0xff, 0xff, 0xff,
     0xff, 0x20,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x7d, 0xfc, 0x0, 0x8, 0xff, 0xb8,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x6f, 0xc0, 0x0,
-    0x5f, 0xfe, 0x30, 0x0, 0x3b, 0xef, 0x60, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0xe, 0xf4, 0x0,
+    /* U+007B */
+    0x0, 0x0, 0x7d, 0xfc, 0x0, 0x8, 0xff, 0xb8, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x1f, 0xe0, 0x0,
+    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
+    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x0, 0x6f, 0xc0, 0x0,
+    0x5f, 0xfe, 0x30, 0x0, 0x3b, 0xef, 0x60, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x1f, 0xd0, 0x0,
+    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0,
+    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0xe, 0xf4, 0x0,
     0x0, 0x8, 0xff, 0xb8, 0x0, 0x0, 0x7d, 0xfc,
-
-    /* U+007C "|" */
-    0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd,
-    0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf,
-    0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0,
-    0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd,
+    /* U+007C */
+    0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf,
+    0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd,
     0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0,
-
-    /* U+007D "}" */
-    0x6f, 0xea, 0x10, 0x0, 0x4b, 0xef, 0xd0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x9, 0xf6, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0xbf, 0xfa, 0x0, 0x2, 0xef, 0xc7,
-    0x0, 0x7, 0xf9, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
-    0x0, 0x9, 0xf6, 0x0, 0x0, 0xe, 0xf4, 0x0,
+    /* U+007D */
+    0x6f, 0xea, 0x10, 0x0, 0x4b, 0xef, 0xd0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x9, 0xf6, 0x0,
+    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
+    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x6, 0xfb, 0x0,
+    0x0, 0x0, 0xbf, 0xfa, 0x0, 0x2, 0xef, 0xc7, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x8, 0xf7, 0x0,
+    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0,
+    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0xe, 0xf4, 0x0,
     0x4b, 0xef, 0xd0, 0x0, 0x6f, 0xea, 0x10, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x8e, 0xfb, 0x20, 0x0, 0x0, 0xf4, 0x7,
-    0xfc, 0xae, 0xf6, 0x0, 0x5, 0xf2, 0xf, 0xa0,
-    0x1, 0xbf, 0x92, 0x4e, 0xb0, 0x2f, 0x30, 0x0,
-    0x6, 0xff, 0xfd, 0x20, 0x14, 0x0, 0x0, 0x0,
+    /* U+007E */
+    0x0, 0x8e, 0xfb, 0x20, 0x0, 0x0, 0xf4, 0x7, 0xfc, 0xae, 0xf6, 0x0, 0x5, 0xf2, 0xf, 0xa0,
+    0x1, 0xbf, 0x92, 0x4e, 0xb0, 0x2f, 0x30, 0x0, 0x6, 0xff, 0xfd, 0x20, 0x14, 0x0, 0x0, 0x0,
     0x3, 0x30, 0x0,
-
-    /* U+00A0 " " */
-
-    /* U+00A1 "¡" */
-    0x6f, 0xa0, 0xcf, 0xf0, 0x5d, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x3f, 0x70,
-    0x3f, 0x70, 0x3f, 0x80, 0x4f, 0x80, 0x4f, 0x90,
-    0x5f, 0x90, 0x5f, 0xa0, 0x6f, 0xa0, 0x6f, 0xb0,
-    0x7f, 0xb0, 0x7f, 0xc0, 0x8f, 0xc0, 0x24, 0x30,
-
-    /* U+00A2 "¢" */
-    0x0, 0x0, 0x0, 0x7, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xef,
-    0xfd, 0x93, 0x0, 0x0, 0x1c, 0xff, 0xdf, 0xde,
-    0xff, 0x70, 0x1, 0xdf, 0xc3, 0xf, 0x60, 0x6e,
-    0xf5, 0xa, 0xfb, 0x0, 0xf, 0x60, 0x3, 0xa1,
-    0x1f, 0xf1, 0x0, 0xf, 0x60, 0x0, 0x0, 0x7f,
-    0x90, 0x0, 0xf, 0x60, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x9f, 0x60, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x7f, 0x90, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x1f, 0xf1, 0x0, 0xf, 0x60, 0x0,
-    0x0, 0x9, 0xfb, 0x0, 0xf, 0x60, 0x3, 0xa1,
-    0x0, 0xdf, 0xc3, 0xf, 0x60, 0x6f, 0xf5, 0x0,
-    0x1c, 0xff, 0xef, 0xef, 0xff, 0x70, 0x0, 0x0,
-    0x5b, 0xef, 0xfd, 0x92, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x30, 0x0,
-    0x0,
-
-    /* U+00A3 "£" */
-    0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xfe, 0xb6,
-    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xee, 0xef,
-    0xff, 0xe2, 0x0, 0x0, 0xa, 0xff, 0x71, 0x0,
-    0x0, 0x38, 0xd0, 0x0, 0x0, 0x4f, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x11, 0xff, 0x21, 0x11, 0x11, 0x11, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x4, 0x44, 0xff, 0x54, 0x44, 0x44,
-    0x43, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xdd, 0xff, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xd0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0,
-
-    /* U+00A4 "¤" */
-    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x0, 0xad, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf4, 0x7, 0xfd, 0x10, 0x3a, 0xdf,
-    0xfc, 0x81, 0x6, 0xfe, 0x20, 0x7, 0xfd, 0xaf,
-    0xfd, 0xbc, 0xef, 0xf9, 0xfe, 0x20, 0x0, 0x7,
-    0xff, 0xb3, 0x0, 0x0, 0x5e, 0xff, 0x20, 0x0,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x1d, 0xf4,
-    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xd0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x30, 0x0, 0xce, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xf6, 0x0, 0xd, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0xce, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7,
-    0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x30, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x1c, 0xf4, 0x0, 0x0, 0x6, 0xff,
-    0xb3, 0x0, 0x0, 0x5e, 0xfe, 0x10, 0x0, 0x5,
-    0xfe, 0xbf, 0xfd, 0xbc, 0xff, 0xfa, 0xfd, 0x10,
-    0x5, 0xfe, 0x20, 0x3a, 0xdf, 0xfc, 0x81, 0x7,
-    0xfd, 0x10, 0xbe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf5, 0x0, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x0,
-
-    /* U+00A5 "¥" */
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf2, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x50, 0x2, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0x0, 0x0, 0x6f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0xb, 0xf8, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x30, 0x0, 0x0, 0x1, 0xef, 0x40, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe1,
-    0x0, 0x0, 0x7f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfb, 0x0, 0x3, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x70, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf3, 0xaf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x13, 0x33, 0x33, 0x7f, 0xc3, 0x33, 0x33,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x13, 0x33, 0x33, 0x7f, 0xc3, 0x33, 0x33,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00A6 "¦" */
-    0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd,
-    0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xb, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0xd, 0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd,
-    0xf0, 0xdf, 0xd, 0xf0, 0xdf, 0xd, 0xf0,
-
-    /* U+00A7 "§" */
-    0x0, 0x0, 0x6b, 0xef, 0xfd, 0x94, 0x0, 0x2,
-    0xdf, 0xfc, 0xab, 0xdf, 0xfa, 0x0, 0xcf, 0x70,
-    0x0, 0x0, 0x29, 0x60, 0x2f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xb6, 0x10, 0x0, 0x0, 0xcf, 0xa6, 0xae,
-    0xff, 0xa1, 0x0, 0x8f, 0x70, 0x0, 0x3, 0xaf,
-    0xe1, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x70,
-    0xde, 0x0, 0x0, 0x0, 0x1, 0xfa, 0xb, 0xf5,
-    0x0, 0x0, 0x0, 0x2f, 0xa0, 0x3f, 0xf9, 0x30,
-    0x0, 0xa, 0xf5, 0x0, 0x3c, 0xff, 0xea, 0x7c,
-    0xfa, 0x0, 0x0, 0x2, 0x7b, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x10, 0x20, 0x0, 0x0, 0x0,
-    0xe, 0xf0, 0xe, 0xb4, 0x0, 0x0, 0x9, 0xf9,
-    0x0, 0xaf, 0xfe, 0xba, 0xbf, 0xfc, 0x10, 0x0,
-    0x28, 0xce, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+00A8 "¨" */
-    0x4, 0x30, 0x0, 0x43, 0x3, 0xff, 0x0, 0x3f,
-    0xf0, 0x1e, 0xc0, 0x1, 0xec, 0x0,
-
-    /* U+00A9 "©" */
-    0x0, 0x0, 0x0, 0x28, 0xbd, 0xed, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xae, 0x95, 0x22,
-    0x35, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x3, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xb1, 0x0, 0x0,
-    0x2, 0xe5, 0x0, 0x0, 0x1, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x0, 0xc7, 0x0, 0x4, 0xbf, 0xff,
-    0xc4, 0x0, 0xb, 0x80, 0x0, 0x7b, 0x0, 0x7,
-    0xfd, 0x75, 0x7d, 0xf7, 0x0, 0x1e, 0x20, 0xe,
-    0x30, 0x4, 0xfa, 0x0, 0x0, 0xa, 0x80, 0x0,
-    0x89, 0x3, 0xd0, 0x0, 0xce, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xe0, 0x6a, 0x0, 0x1f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x18, 0x80,
-    0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe2, 0x88, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x37, 0x90, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf1, 0x4c, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0x0, 0xf2, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x75,
-    0x0, 0x8, 0xa0, 0x9, 0x90, 0x0, 0x9f, 0xb4,
-    0x24, 0xaf, 0xa0, 0x1, 0xe3, 0x0, 0x1e, 0x40,
-    0x0, 0x6e, 0xff, 0xff, 0x70, 0x0, 0xba, 0x0,
-    0x0, 0x3e, 0x30, 0x0, 0x3, 0x43, 0x0, 0x0,
-    0x8d, 0x0, 0x0, 0x0, 0x5e, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xbd, 0x20, 0x0, 0x0, 0x0, 0x2d,
-    0xc6, 0x20, 0x0, 0x38, 0xea, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00AA "ª" */
-    0x5, 0xbe, 0xfd, 0x70, 0x5, 0xe7, 0x33, 0x7f,
-    0xb0, 0x1, 0x0, 0x0, 0x7f, 0x10, 0x0, 0x0,
-    0x4, 0xf3, 0x9, 0xdf, 0xff, 0xff, 0x39, 0xe3,
-    0x0, 0x4, 0xf3, 0xc9, 0x0, 0x0, 0x5f, 0x38,
-    0xe4, 0x0, 0x5d, 0xf3, 0x8, 0xde, 0xe9, 0x3f,
-    0x30,
-
-    /* U+00AB "«" */
-    0x0, 0x0, 0x9a, 0x10, 0x9, 0xa0, 0x0, 0x7,
-    0xf6, 0x0, 0x7f, 0x60, 0x0, 0x3f, 0xa0, 0x3,
-    0xfa, 0x0, 0x1, 0xed, 0x0, 0x1e, 0xd0, 0x0,
-    0xb, 0xf3, 0x0, 0xbf, 0x30, 0x0, 0x6f, 0x80,
-    0x6, 0xf8, 0x0, 0x0, 0x1e, 0xe1, 0x1, 0xed,
-    0x10, 0x0, 0x3, 0xfb, 0x0, 0x3f, 0xa0, 0x0,
-    0x0, 0x7f, 0x70, 0x7, 0xf6, 0x0, 0x0, 0xa,
-    0xf3, 0x0, 0xbf, 0x30, 0x0, 0x0, 0xdd, 0x10,
-    0x1d, 0xd0,
-
-    /* U+00AC "¬" */
-    0xa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf2,
-
-    /* U+00AD "­" */
-    0x3c, 0xcc, 0xcc, 0xcc, 0x5, 0xff, 0xff, 0xff,
-    0xf0,
-
-    /* U+00AE "®" */
-    0x0, 0x0, 0x0, 0x28, 0xbd, 0xed, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xae, 0x95, 0x22,
-    0x35, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x3, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0x2c, 0xb1, 0x0, 0x0,
-    0x2, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x0, 0xc7, 0x0, 0x8f, 0xff, 0xff,
-    0xc5, 0x0, 0xb, 0x80, 0x0, 0x7b, 0x0, 0x8,
-    0xe3, 0x33, 0x5a, 0xf7, 0x0, 0x1e, 0x20, 0xe,
-    0x30, 0x0, 0x8e, 0x0, 0x0, 0x9, 0xf1, 0x0,
-    0x89, 0x3, 0xd0, 0x0, 0x8, 0xe0, 0x0, 0x0,
-    0x3f, 0x40, 0x3, 0xe0, 0x6a, 0x0, 0x0, 0x8e,
-    0x0, 0x0, 0x2, 0xf4, 0x0, 0xf, 0x18, 0x80,
-    0x0, 0x8, 0xe0, 0x0, 0x0, 0x7f, 0x10, 0x0,
-    0xe2, 0x88, 0x0, 0x0, 0x8e, 0x0, 0x1, 0x7f,
-    0x90, 0x0, 0xd, 0x37, 0x90, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xf1, 0x4c, 0x0,
-    0x0, 0x8f, 0x33, 0x36, 0xf3, 0x0, 0x0, 0x2e,
-    0x0, 0xf2, 0x0, 0x8, 0xf0, 0x0, 0xa, 0xd0,
-    0x0, 0x8, 0xa0, 0x9, 0x90, 0x0, 0x8f, 0x0,
-    0x0, 0x1e, 0x70, 0x1, 0xe3, 0x0, 0x1e, 0x40,
-    0x7, 0xd0, 0x0, 0x0, 0x5e, 0x20, 0xba, 0x0,
-    0x0, 0x3e, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8d, 0x0, 0x0, 0x0, 0x5e, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xbd, 0x20, 0x0, 0x0, 0x0, 0x2d,
-    0xc6, 0x20, 0x0, 0x38, 0xea, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00AF "¯" */
-    0x11, 0x11, 0x11, 0x11, 0xe, 0xff, 0xff, 0xff,
-    0xfb, 0x34, 0x44, 0x44, 0x44, 0x20,
-
-    /* U+00B0 "°" */
-    0x0, 0x4c, 0xfe, 0xa2, 0x0, 0x6, 0xf8, 0x45,
-    0xbf, 0x30, 0x1f, 0x50, 0x0, 0xa, 0xc0, 0x7d,
-    0x0, 0x0, 0x1, 0xf2, 0x9a, 0x0, 0x0, 0x0,
-    0xf4, 0x7c, 0x0, 0x0, 0x1, 0xf3, 0x2f, 0x30,
-    0x0, 0x8, 0xe0, 0x9, 0xe5, 0x11, 0x8f, 0x40,
-    0x0, 0x7e, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x21,
+    /* U+00B0 */
+    0x0, 0x4c, 0xfe, 0xa2, 0x0, 0x6, 0xf8, 0x45, 0xbf, 0x30, 0x1f, 0x50, 0x0, 0xa, 0xc0, 0x7d,
+    0x0, 0x0, 0x1, 0xf2, 0x9a, 0x0, 0x0, 0x0, 0xf4, 0x7c, 0x0, 0x0, 0x1, 0xf3, 0x2f, 0x30,
+    0x0, 0x8, 0xe0, 0x9, 0xe5, 0x11, 0x8f, 0x40, 0x0, 0x7e, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x21,
     0x0, 0x0,
-
-    /* U+00B1 "±" */
-    0x0, 0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x0, 0x0, 0x0, 0xb, 0xbb, 0xbb, 0xff, 0xbb,
-    0xbb, 0xb1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa1,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+00B2 "²" */
-    0x0, 0x6c, 0xef, 0xda, 0x30, 0x0, 0xbf, 0xa6,
-    0x56, 0xcf, 0x50, 0x4, 0x20, 0x0, 0x0, 0xcd,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x20, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0xbf, 0x40, 0x0, 0x0, 0x1, 0xce, 0x30,
-    0x0, 0x0, 0x2, 0xdd, 0x20, 0x0, 0x0, 0x2,
-    0xef, 0x54, 0x44, 0x44, 0x20, 0xaf, 0xff, 0xff,
-    0xff, 0xf8,
-
-    /* U+00B3 "³" */
-    0xd, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x34, 0x44,
-    0x44, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x2e, 0x90,
-    0x0, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x0,
-    0x1d, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc8,
-    0x0, 0x0, 0x0, 0x12, 0x37, 0xed, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0x70, 0x51, 0x0, 0x0, 0x6, 0xf4, 0xd,
-    0xf9, 0x64, 0x59, 0xfb, 0x0, 0x17, 0xbe, 0xff,
-    0xc6, 0x0,
-
-    /* U+00B4 "´" */
-    0x0, 0x0, 0x68, 0x60, 0x0, 0xa, 0xfb, 0x10,
-    0x0, 0xbf, 0x70, 0x0, 0x1c, 0xe4, 0x0, 0x0,
-
-    /* U+00B5 "µ" */
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x33,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x33, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x33, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf3, 0x3f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x33, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf3, 0x3f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x33, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf3, 0x3f, 0xf0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x33, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0xdf, 0xf3, 0x3f, 0xff, 0x60, 0x0, 0x2, 0xcf,
-    0xdf, 0x33, 0xfc, 0xbf, 0xeb, 0xbd, 0xff, 0x5b,
-    0xf3, 0x3f, 0xc0, 0x6c, 0xef, 0xd9, 0x20, 0xbf,
-    0x33, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00B6 "¶" */
-    0x0, 0x6, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x1d, 0xff, 0xff, 0xf9, 0x99, 0x9a, 0xf8, 0xc,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x2f, 0x83, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x2, 0xf8, 0x5f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x2f, 0x85, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x2, 0xf8, 0x2f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x2f, 0x80, 0x9f, 0xff, 0xff,
-    0xf0, 0x0, 0x2, 0xf8, 0x0, 0xaf, 0xff, 0xff,
-    0x0, 0x0, 0x2f, 0x80, 0x0, 0x38, 0xae, 0xf0,
-    0x0, 0x2, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0x0,
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0xa, 0xf0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0,
-    0x2f, 0x80, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x2f,
-    0x80, 0x0, 0x0, 0xa, 0xf0, 0x0, 0x2, 0xf8,
-    0x0, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0xa, 0xf0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0xaf, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x0, 0xa, 0xf0, 0x0, 0x2, 0xf8, 0x0, 0x0,
-    0x0, 0xaf, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0,
-    0xa, 0xf0, 0x0, 0x2, 0xf8, 0x0, 0x0, 0x0,
-    0xaf, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x6,
-    0x90, 0x0, 0x1, 0x94,
-
-    /* U+00B7 "·" */
-    0x0, 0x0, 0x9f, 0xa0, 0xef, 0xf0, 0x7f, 0x90,
-
-    /* U+00B8 "¸" */
-    0x0, 0x5d, 0x0, 0x0, 0x9c, 0x20, 0x0, 0x7b,
-    0xf6, 0x0, 0x0, 0x9e, 0x13, 0x1, 0xcc, 0x4f,
-    0xff, 0xd2, 0x0, 0x21, 0x0,
-
-    /* U+00B9 "¹" */
-    0x7f, 0xff, 0xf4, 0x0, 0x1, 0x44, 0x7f, 0x40,
-    0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x4f,
-    0x40, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
-    0x4f, 0x40, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x0, 0x4f, 0x40, 0x0, 0x24, 0x47, 0xf7,
-    0x44, 0x1a, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+00BA "º" */
-    0x0, 0x7, 0xdf, 0xeb, 0x30, 0x0, 0xc, 0xf8,
-    0x45, 0xbf, 0x60, 0x8, 0xf2, 0x0, 0x0, 0x8f,
-    0x20, 0xe9, 0x0, 0x0, 0x0, 0xf7, 0xf, 0x70,
-    0x0, 0x0, 0xd, 0x90, 0xe8, 0x0, 0x0, 0x0,
-    0xf8, 0xa, 0xe1, 0x0, 0x0, 0x6f, 0x30, 0x1e,
-    0xd4, 0x12, 0x7f, 0x90, 0x0, 0x1a, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0,
-
-    /* U+00BB "»" */
-    0x7b, 0x20, 0x7, 0xb1, 0x0, 0x1, 0xec, 0x0,
-    0x1e, 0xc0, 0x0, 0x4, 0xf9, 0x0, 0x4f, 0x90,
-    0x0, 0x8, 0xf5, 0x0, 0x9f, 0x50, 0x0, 0xc,
-    0xf2, 0x0, 0xcf, 0x20, 0x0, 0x2f, 0xc0, 0x2,
-    0xfb, 0x0, 0x9, 0xf5, 0x0, 0x9f, 0x50, 0x5,
-    0xf9, 0x0, 0x5f, 0x80, 0x2, 0xfc, 0x0, 0x2f,
-    0xc0, 0x0, 0xce, 0x10, 0xc, 0xe1, 0x0, 0x9f,
-    0x40, 0x9, 0xf4, 0x0, 0x0,
-
-    /* U+00BC "¼" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x13, 0x37, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x8,
-    0x70, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x1,
-    0xe9, 0x0, 0x0, 0x0, 0x8f, 0x20, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0xb, 0xe1, 0x0, 0x0,
-    0x4, 0xf6, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0x40, 0x5f, 0x40, 0x0, 0x0, 0x1e, 0xa0, 0x0,
-    0x0, 0x23, 0x33, 0x33, 0x33, 0x11, 0xea, 0x0,
-    0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x7, 0xf3,
-    0x0, 0x74, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x3f, 0x60, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xea, 0x0, 0x0, 0x1,
-    0xeb, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xe1, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0,
-    0x0, 0x1, 0x33, 0x33, 0x33, 0xf9, 0x33, 0x0,
-    0x0, 0x1, 0xea, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0xa, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x3, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x31, 0x0,
-
-    /* U+00BD "½" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x13, 0x37, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf4,
-    0x0, 0x0, 0x0, 0x6f, 0x40, 0x8, 0xdf, 0xff,
-    0xa2, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x1,
-    0xe9, 0x1, 0xdf, 0x95, 0x47, 0xdf, 0x20, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0xb, 0xe1, 0x0, 0xb3,
-    0x0, 0x0, 0x1f, 0x90, 0xaf, 0xff, 0xff, 0xff,
-    0x40, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xb0, 0x23, 0x33, 0x33, 0x33, 0x11, 0xea, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xce, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xea, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xce, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0,
-    0x0, 0x0, 0x2, 0xed, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xea, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x3, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x33, 0x33, 0x33, 0x33, 0x31,
-
-    /* U+00BE "¾" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf8, 0x0, 0x0, 0x0, 0x3, 0x33, 0x33, 0x37,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd,
-    0x80, 0x0, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x12, 0x37, 0xfd, 0x0,
-    0x0, 0x1, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0xb,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0x70, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0xb, 0x80, 0x0, 0x3, 0x0, 0x0, 0x0,
-    0x4f, 0x50, 0x1, 0xe9, 0x0, 0x0, 0x0, 0x9e,
-    0x10, 0x0, 0xe, 0xc6, 0x21, 0x26, 0xec, 0x0,
-    0xb, 0xe1, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x3, 0xaf, 0xff, 0xff, 0xa1, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x23, 0x20, 0x0, 0x1, 0xea, 0x0, 0x0, 0x0,
-    0xcd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xe1, 0x0, 0x0, 0x8, 0xf2, 0x0,
-    0x85, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x3f, 0x60, 0x0, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xea, 0x0, 0x0,
-    0x1, 0xeb, 0x0, 0x0, 0xd8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x50, 0x0, 0x0, 0x1, 0x33, 0x33, 0x33,
-    0xf9, 0x33, 0x0, 0x0, 0x0, 0x1, 0xea, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x31, 0x0,
-
-    /* U+00BF "¿" */
-    0x0, 0x0, 0xb, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x10,
-    0x9f, 0xc0, 0x0, 0x0, 0x0, 0x1c, 0xe2, 0x1e,
-    0xfd, 0x62, 0x1, 0x38, 0xef, 0xc0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x4, 0x8b,
-    0xcb, 0x95, 0x10, 0x0,
-
-    /* U+00C0 "À" */
-    0x0, 0x0, 0x2, 0xdf, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xed, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x7, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf,
-    0x80, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-
-    /* U+00C1 "Á" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x84, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xed, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x7, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf,
-    0x80, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-
-    /* U+00C2 "Â" */
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x98,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0x70, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0x40, 0x0, 0x3, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xed, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x7, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf,
-    0x80, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0xbf, 0x70, 0x0, 0x0,
+    /* U+00C4 */
+    0x0, 0x0, 0x0, 0x6, 0x10, 0x0, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x0,
+    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xed, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0x10, 0xef, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x8, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xfb, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x3, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xf6, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x30, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x7, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf,
+    0x80, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x5f, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0xd, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xe0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x50, 0xbf, 0x70, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-
-    /* U+00C3 "Ã" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0x90,
-    0x0, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe9, 0x5d, 0xc1, 0x5f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0x0, 0xa, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x1,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xfe, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x76, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf1, 0xe, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x20, 0x1, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0,
-    0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x5, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x7f, 0xdb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbd, 0xf8, 0x0, 0x0, 0xe, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x5,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x70, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfe, 0x0, 0x4f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xb, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xc0,
-
-    /* U+00C4 "Ä" */
-    0x0, 0x0, 0x0, 0x6, 0x10, 0x0, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x0,
-    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x70, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xed, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf7, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x10, 0xef, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x8, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x1f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0,
-    0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xf6, 0x0, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x7, 0xfd, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf,
-    0x80, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x0, 0x0, 0x5f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0xd,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xe0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x50, 0xbf, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0,
-
-    /* U+00C5 "Å" */
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x11,
-    0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x30, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc3, 0x0, 0x2e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xb1, 0x1b,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xee, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x76, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf1, 0xe, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x8f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20,
-    0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0,
-    0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0x60, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x7f, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xf8,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf0, 0x0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0xdf,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
-    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf5, 0xb, 0xf7, 0x0, 0x0, 0x0,
+    /* U+00C5 */
+    0x0, 0x0, 0x0, 0x0, 0x7e, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x11,
+    0xb7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x30, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc3, 0x0, 0x2e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xb1, 0x1b,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xee, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xdf, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x76, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf1, 0xe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x8f, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x1, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xb0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x3f, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0x60, 0x0, 0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0xe, 0xf3,
+    0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x7f, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbd, 0xf8,
+    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf0, 0x0, 0x5, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0x70, 0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfe,
+    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xb, 0xf7, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0,
-
-    /* U+00C6 "Æ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0xfe, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x99, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x19, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfa, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x70, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x9, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xc7, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0xbb,
-    0xbb, 0xbb, 0xbd, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0,
-    0x9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x9, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd3, 0xaf, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+00C7 "Ç" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xee, 0xff,
-    0xfd, 0x40, 0x0, 0x4, 0xff, 0xe8, 0x20, 0x0,
-    0x4, 0xbf, 0xf7, 0x0, 0x4f, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0xe4, 0x1, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x4, 0xff, 0xe8, 0x20, 0x0, 0x5,
-    0xbf, 0xf7, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xee,
-    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x38, 0xcf,
-    0xfe, 0xd9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x30, 0x2d, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10,
+    /* U+00D6 */
+    0x0, 0x0, 0x0, 0x2, 0x50, 0x0, 0x25, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
+    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe3, 0x0, 0xae, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xa0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x6f,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
+    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0xef, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0x90, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20, 0x0, 0x4, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xff, 0xee, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
     0x0, 0x0, 0x0,
-
-    /* U+00C8 "È" */
-    0x0, 0x3e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0xdf, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd8, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xd, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0,
-
-    /* U+00C9 "É" */
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x48, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0xdf, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd8, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xd, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0,
-
-    /* U+00CA "Ê" */
-    0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0xaf, 0x70, 0x0, 0x0, 0x0,
-    0xa, 0xf6, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x3,
-    0x83, 0x0, 0x0, 0x48, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0xdf, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd8, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xd, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0,
-
-    /* U+00CB "Ë" */
-    0x0, 0x1, 0x60, 0x0, 0x16, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0x90, 0xa, 0xf8, 0x0, 0x0, 0x0,
-    0x7, 0xf5, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0xdf, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd8, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xd, 0xfd, 0xcc, 0xcc, 0xcc, 0xcc, 0xc5, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xd0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0,
-
-    /* U+00CC "Ì" */
-    0x1b, 0xfb, 0x0, 0x0, 0x0, 0x8f, 0xc1, 0x0,
-    0x0, 0x4, 0xed, 0x10, 0x0, 0x0, 0x17, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0xdf, 0x40,
-
-    /* U+00CD "Í" */
-    0x0, 0x5, 0xff, 0x50, 0x6, 0xfd, 0x20, 0x7,
-    0xfa, 0x0, 0x2, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0xd, 0xf4, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0xd, 0xf4, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0xd, 0xf4, 0x0, 0x0, 0xdf, 0x40, 0x0, 0xd,
-    0xf4, 0x0, 0x0, 0xdf, 0x40, 0x0, 0xd, 0xf4,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0xd, 0xf4, 0x0, 0x0,
-
-    /* U+00CE "Î" */
-    0x0, 0x5, 0xff, 0xb0, 0x0, 0x0, 0x5f, 0xc6,
-    0xfb, 0x0, 0x5, 0xf9, 0x0, 0x4e, 0xc0, 0x17,
-    0x60, 0x0, 0x2, 0x84, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0xdf, 0x40, 0x0, 0x0, 0x0, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0xdf, 0x40, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0,
-
-    /* U+00CF "Ï" */
-    0x5, 0x20, 0x0, 0x52, 0x6f, 0xd0, 0x6, 0xfd,
-    0x3e, 0x90, 0x3, 0xe9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0xd, 0xf4, 0x0,
-
-    /* U+00D0 "Ð" */
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0xdd, 0xdd,
-    0xdd, 0xef, 0xff, 0xd4, 0x0, 0x0, 0x0, 0xa,
-    0xf6, 0x0, 0x0, 0x0, 0x1, 0x5c, 0xff, 0x80,
-    0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf8, 0x0, 0x0, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x6a, 0xaf,
-    0xff, 0xaa, 0xaa, 0xa2, 0x0, 0x0, 0x0, 0x4,
-    0xfc, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0xa, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0,
-    0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf3, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x0, 0xa, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf8, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
-    0x0, 0x1, 0x5c, 0xff, 0x80, 0x0, 0x0, 0xa,
-    0xfe, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xec,
-    0x94, 0x0, 0x0, 0x0,
-
-    /* U+00D1 "Ñ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0xc2, 0x0, 0x8b, 0x0,
-    0x0, 0x0, 0x0, 0xac, 0x4a, 0xe4, 0x2e, 0x70,
-    0x0, 0x0, 0x0, 0xf, 0x40, 0x6, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x9d, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf9, 0xdf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x9d, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf, 0x7f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4, 0x6f,
-    0xf3, 0x0, 0x0, 0x0, 0x7, 0xf9, 0xdf, 0x40,
-    0x9f, 0xe1, 0x0, 0x0, 0x0, 0x7f, 0x9d, 0xf4,
-    0x0, 0xcf, 0xb0, 0x0, 0x0, 0x7, 0xf9, 0xdf,
-    0x40, 0x2, 0xef, 0x80, 0x0, 0x0, 0x7f, 0x9d,
-    0xf4, 0x0, 0x4, 0xff, 0x40, 0x0, 0x7, 0xf9,
-    0xdf, 0x40, 0x0, 0x8, 0xfe, 0x20, 0x0, 0x7f,
-    0x9d, 0xf4, 0x0, 0x0, 0xb, 0xfc, 0x0, 0x7,
-    0xf9, 0xdf, 0x40, 0x0, 0x0, 0x1e, 0xfa, 0x0,
-    0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x3f, 0xf6,
-    0x7, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x6f,
-    0xf3, 0x7f, 0x9d, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xe8, 0xf9, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x9d, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf9, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x9d, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xf9,
-
-    /* U+00D2 "Ò" */
-    0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xa0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-    0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x90, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20, 0x0,
-    0x4, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xee, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xde, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xa0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-    0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x90, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20, 0x0,
-    0x4, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xee, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+00D4 "Ô" */
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x6c, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe3, 0x0, 0xaf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x47, 0x20, 0x0, 0x6,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xa0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-    0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x90, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20, 0x0,
-    0x4, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xee, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+00D5 "Õ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
-    0x50, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x66, 0xf8, 0x19, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8a, 0x0, 0x2d, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce, 0xff,
-    0xda, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xee, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xe7, 0x20, 0x0, 0x4, 0xbf,
-    0xfa, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xa0, 0x0, 0x0, 0xef,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6,
-    0x0, 0x8, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0xe, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x3f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xe0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x8f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x3f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xb0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x8, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0,
-    0xef, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf6, 0x0, 0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x4, 0xff,
-    0xe7, 0x20, 0x0, 0x4, 0xbf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xff, 0xff, 0xee, 0xff, 0xfe,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xce,
-    0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
-
-    /* U+00D6 "Ö" */
-    0x0, 0x0, 0x0, 0x2, 0x50, 0x0, 0x25, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf6,
-    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xe3, 0x0, 0xae, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xe7, 0x20, 0x0, 0x4, 0xbf, 0xfa, 0x0, 0x0,
-    0x0, 0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xa0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x8, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfe,
-    0x0, 0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x6f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x60, 0x8, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfe, 0x0, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0,
-    0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x90, 0x0, 0x0, 0x4, 0xff, 0xe7, 0x20, 0x0,
-    0x4, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xee, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x50,
-    0x0, 0x0, 0x0,
-
-    /* U+00D7 "×" */
-    0x29, 0x0, 0x0, 0x0, 0x83, 0x8f, 0xa0, 0x0,
-    0x9, 0xfa, 0xa, 0xfa, 0x0, 0x8f, 0xb0, 0x0,
-    0xaf, 0xa8, 0xfb, 0x0, 0x0, 0xa, 0xff, 0xc0,
-    0x0, 0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x7f,
-    0xcb, 0xf9, 0x0, 0x7, 0xfc, 0x10, 0xbf, 0x90,
-    0x7f, 0xc1, 0x0, 0xb, 0xf8, 0x4c, 0x10, 0x0,
-    0x0, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00D8 "Ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x5f, 0x40,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xee, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe7,
-    0x20, 0x0, 0x4, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x3f, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xa0, 0x0, 0x0, 0xef, 0x90, 0x0, 0x0, 0x0,
-    0x3, 0xf7, 0x2f, 0xf6, 0x0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xc0, 0x5, 0xfe, 0x0,
-    0xe, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x10,
-    0x0, 0xcf, 0x60, 0x3f, 0xd0, 0x0, 0x0, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x6f, 0xb0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x1e, 0xa0, 0x0, 0x0, 0x2f,
-    0xe0, 0x8f, 0x80, 0x0, 0x0, 0x0, 0xbe, 0x10,
-    0x0, 0x0, 0x1f, 0xf0, 0x8f, 0x80, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x6f,
-    0xa0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x0, 0x0,
-    0x2f, 0xe0, 0x3f, 0xd0, 0x0, 0x0, 0xcc, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xb0, 0xe, 0xf4, 0x0,
-    0x8, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
-    0x8, 0xfc, 0x0, 0x4f, 0x60, 0x0, 0x0, 0x0,
-    0x5, 0xfe, 0x0, 0x0, 0xef, 0x91, 0xeb, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x3f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0x90,
-    0x0, 0x0, 0x4, 0xff, 0xf7, 0x20, 0x0, 0x4,
-    0xbf, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xee, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x28, 0xce, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00D9 "Ù" */
-    0x0, 0x2, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x2, 0xef, 0xd5, 0x0, 0x0,
-    0x4b, 0xff, 0x30, 0x0, 0x2, 0xdf, 0xff, 0xee,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5a, 0xdf,
-    0xfe, 0xb6, 0x0, 0x0, 0x0,
-
-    /* U+00DA "Ú" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x2, 0xef, 0xd5, 0x0, 0x0,
-    0x4b, 0xff, 0x30, 0x0, 0x2, 0xdf, 0xff, 0xee,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5a, 0xdf,
-    0xfe, 0xb6, 0x0, 0x0, 0x0,
-
-    /* U+00DB "Û" */
-    0x0, 0x0, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa8, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0x80, 0x5, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x28, 0x40, 0x0, 0x3, 0x83,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x2, 0xef, 0xd5, 0x0, 0x0,
-    0x4b, 0xff, 0x30, 0x0, 0x2, 0xdf, 0xff, 0xee,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5a, 0xdf,
-    0xfe, 0xb6, 0x0, 0x0, 0x0,
-
-    /* U+00DC "Ü" */
-    0x0, 0x0, 0x6, 0x10, 0x0, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfb, 0x0, 0x8f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x70, 0x5, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x2f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x1e, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xb0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf6, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x0,
-    0x8, 0xfe, 0x0, 0x2, 0xef, 0xd5, 0x0, 0x0,
-    0x4b, 0xff, 0x30, 0x0, 0x2, 0xdf, 0xff, 0xee,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x5a, 0xdf,
-    0xfe, 0xb6, 0x0, 0x0, 0x0,
-
-    /* U+00DD "Ý" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x7,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0xdf, 0x50, 0x0, 0x0, 0x0, 0x6, 0xfa,
-    0x0, 0x0, 0x4f, 0xe0, 0x0, 0x0, 0x0, 0x1e,
-    0xf1, 0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0,
-    0x9f, 0x70, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xb0,
-    0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf5, 0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfe, 0x1, 0xef, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x89, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+00DE "Þ" */
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-    0xdf, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xd3, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x4c, 0xff, 0x30,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf8,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x4c, 0xff, 0x30,
-    0xdf, 0xdd, 0xdd, 0xdd, 0xef, 0xff, 0xd3, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00DF "ß" */
-    0x0, 0x0, 0x6b, 0xef, 0xeb, 0x60, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xdc, 0xef, 0xfd, 0x20, 0x0,
-    0x1, 0xdf, 0xa2, 0x0, 0x2, 0xaf, 0xd0, 0x0,
-    0x8, 0xfb, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
-    0xe, 0xf2, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x0,
-    0x1f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x3, 0xcf, 0x70, 0x0,
-    0x3f, 0xc0, 0x0, 0x1c, 0xef, 0xf6, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x2f, 0xff, 0xff, 0xb1, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x1, 0x4b, 0xfe, 0x20,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf3,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50,
-    0x3f, 0xc0, 0x2, 0xfd, 0xcc, 0xff, 0xf6, 0x0,
-    0x3f, 0xc0, 0x2, 0xce, 0xfe, 0xd8, 0x20, 0x0,
-
-    /* U+00E0 "à" */
-    0x0, 0x3e, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xb4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xae, 0xff, 0xd9, 0x20, 0x0, 0x6e, 0xff,
-    0xec, 0xdf, 0xff, 0x50, 0xc, 0xe7, 0x10, 0x0,
-    0x19, 0xff, 0x20, 0x21, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x2,
-    0x57, 0x78, 0x88, 0x8f, 0xe0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xc, 0xfb, 0x31, 0x0, 0x0,
-    0x1f, 0xe4, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xe5, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x1f, 0xf4, 0x0,
-    0x0, 0x9, 0xff, 0xe0, 0x5f, 0xfb, 0x87, 0x9e,
-    0xf4, 0xfe, 0x0, 0x29, 0xdf, 0xfd, 0x81, 0xf,
-    0xe0,
-
-    /* U+00E1 "á" */
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xb1, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x5b, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xae, 0xff, 0xd9, 0x20, 0x0, 0x6e, 0xff,
-    0xec, 0xdf, 0xff, 0x50, 0xc, 0xe7, 0x10, 0x0,
-    0x19, 0xff, 0x20, 0x21, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x2,
-    0x57, 0x78, 0x88, 0x8f, 0xe0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xc, 0xfb, 0x31, 0x0, 0x0,
-    0x1f, 0xe4, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xe5, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x1f, 0xf4, 0x0,
-    0x0, 0x9, 0xff, 0xe0, 0x5f, 0xfb, 0x87, 0x9e,
-    0xf4, 0xfe, 0x0, 0x29, 0xdf, 0xfd, 0x81, 0xf,
-    0xe0,
-
-    /* U+00E2 "â" */
-    0x0, 0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0xaf, 0x70, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x9f, 0x60, 0x0, 0x3, 0xa6, 0x0, 0x0,
-    0x6a, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xae, 0xff, 0xd9, 0x20, 0x0, 0x6e, 0xff,
-    0xec, 0xdf, 0xff, 0x50, 0xc, 0xe7, 0x10, 0x0,
-    0x19, 0xff, 0x20, 0x21, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x2,
-    0x57, 0x78, 0x88, 0x8f, 0xe0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xc, 0xfb, 0x31, 0x0, 0x0,
-    0x1f, 0xe4, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xe5, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x1f, 0xf4, 0x0,
-    0x0, 0x9, 0xff, 0xe0, 0x5f, 0xfb, 0x87, 0x9e,
-    0xf4, 0xfe, 0x0, 0x29, 0xdf, 0xfd, 0x81, 0xf,
-    0xe0,
-
-    /* U+00E3 "ã" */
-    0x0, 0x4, 0xde, 0x70, 0x0, 0xe5, 0x0, 0x1,
-    0xf9, 0x6e, 0xb1, 0x5f, 0x10, 0x0, 0x5e, 0x0,
-    0x1b, 0xff, 0x60, 0x0, 0x1, 0x20, 0x0, 0x2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xae, 0xff, 0xd9, 0x20, 0x0, 0x6e, 0xff,
-    0xec, 0xdf, 0xff, 0x50, 0xc, 0xe7, 0x10, 0x0,
-    0x19, 0xff, 0x20, 0x21, 0x0, 0x0, 0x0, 0x9,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x2,
-    0x57, 0x78, 0x88, 0x8f, 0xe0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xc, 0xfb, 0x31, 0x0, 0x0,
-    0x1f, 0xe4, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xfe,
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xe5, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x1f, 0xf4, 0x0,
-    0x0, 0x9, 0xff, 0xe0, 0x5f, 0xfb, 0x87, 0x9e,
-    0xf4, 0xfe, 0x0, 0x29, 0xdf, 0xfd, 0x81, 0xf,
-    0xe0,
-
-    /* U+00E4 "ä" */
-    0x0, 0x6, 0xf5, 0x0, 0x6f, 0x50, 0x0, 0x0,
-    0xaf, 0x90, 0xa, 0xf9, 0x0, 0x0, 0x1, 0x61,
-    0x0, 0x16, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6a, 0xef, 0xfd, 0x92, 0x0, 0x6,
-    0xef, 0xfe, 0xcd, 0xff, 0xf5, 0x0, 0xce, 0x71,
-    0x0, 0x1, 0x9f, 0xf2, 0x2, 0x10, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0,
-    0x0, 0x25, 0x77, 0x88, 0x88, 0xfe, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0xcf, 0xb3, 0x10,
-    0x0, 0x1, 0xfe, 0x4f, 0xc0, 0x0, 0x0, 0x0,
-    0x1f, 0xe6, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xfe,
-    0x5f, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xe1, 0xff,
-    0x40, 0x0, 0x0, 0x9f, 0xfe, 0x5, 0xff, 0xb8,
-    0x79, 0xef, 0x4f, 0xe0, 0x2, 0x9d, 0xff, 0xd8,
+    /* U+00E4 */
+    0x0, 0x6, 0xf5, 0x0, 0x6f, 0x50, 0x0, 0x0, 0xaf, 0x90, 0xa, 0xf9, 0x0, 0x0, 0x1, 0x61,
+    0x0, 0x16, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6a, 0xef, 0xfd, 0x92, 0x0, 0x6, 0xef, 0xfe, 0xcd, 0xff, 0xf5, 0x0, 0xce, 0x71,
+    0x0, 0x1, 0x9f, 0xf2, 0x2, 0x10, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x25, 0x77, 0x88, 0x88, 0xfe, 0x1, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0xcf, 0xb3, 0x10, 0x0, 0x1, 0xfe, 0x4f, 0xc0, 0x0, 0x0, 0x0,
+    0x1f, 0xe6, 0xf8, 0x0, 0x0, 0x0, 0x2, 0xfe, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xe1, 0xff,
+    0x40, 0x0, 0x0, 0x9f, 0xfe, 0x5, 0xff, 0xb8, 0x79, 0xef, 0x4f, 0xe0, 0x2, 0x9d, 0xff, 0xd8,
     0x10, 0xfe,
-
-    /* U+00E5 "å" */
-    0x0, 0x0, 0x8, 0xed, 0x70, 0x0, 0x0, 0x0,
-    0x7, 0xb1, 0x1c, 0x60, 0x0, 0x0, 0x0, 0xd2,
-    0x0, 0x4c, 0x0, 0x0, 0x0, 0xd, 0x20, 0x3,
-    0xc0, 0x0, 0x0, 0x0, 0x8b, 0x11, 0xc7, 0x0,
-    0x0, 0x0, 0x0, 0x9e, 0xe8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xae, 0xff,
-    0xd9, 0x20, 0x0, 0x6e, 0xff, 0xec, 0xdf, 0xff,
-    0x50, 0xc, 0xe7, 0x10, 0x0, 0x19, 0xff, 0x20,
-    0x21, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0x2, 0x57, 0x78, 0x88,
-    0x8f, 0xe0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xc, 0xfb, 0x31, 0x0, 0x0, 0x1f, 0xe4, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xfe, 0x6f, 0x80, 0x0,
-    0x0, 0x0, 0x2f, 0xe5, 0xfa, 0x0, 0x0, 0x0,
-    0xa, 0xfe, 0x1f, 0xf4, 0x0, 0x0, 0x9, 0xff,
-    0xe0, 0x5f, 0xfb, 0x87, 0x9e, 0xf4, 0xfe, 0x0,
+    /* U+00E5 */
+    0x0, 0x0, 0x8, 0xed, 0x70, 0x0, 0x0, 0x0, 0x7, 0xb1, 0x1c, 0x60, 0x0, 0x0, 0x0, 0xd2,
+    0x0, 0x4c, 0x0, 0x0, 0x0, 0xd, 0x20, 0x3, 0xc0, 0x0, 0x0, 0x0, 0x8b, 0x11, 0xc7, 0x0,
+    0x0, 0x0, 0x0, 0x9e, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xae, 0xff, 0xd9, 0x20, 0x0, 0x6e, 0xff, 0xec, 0xdf, 0xff,
+    0x50, 0xc, 0xe7, 0x10, 0x0, 0x19, 0xff, 0x20, 0x21, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfd, 0x0, 0x2, 0x57, 0x78, 0x88,
+    0x8f, 0xe0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc, 0xfb, 0x31, 0x0, 0x0, 0x1f, 0xe4, 0xfc,
+    0x0, 0x0, 0x0, 0x1, 0xfe, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xe5, 0xfa, 0x0, 0x0, 0x0,
+    0xa, 0xfe, 0x1f, 0xf4, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x5f, 0xfb, 0x87, 0x9e, 0xf4, 0xfe, 0x0,
     0x29, 0xdf, 0xfd, 0x81, 0xf, 0xe0,
-
-    /* U+00E6 "æ" */
-    0x0, 0x6, 0xbe, 0xff, 0xd8, 0x20, 0x0, 0x17,
-    0xce, 0xfd, 0x92, 0x0, 0x0, 0x6, 0xef, 0xfe,
-    0xcd, 0xff, 0xf4, 0x4, 0xef, 0xfd, 0xcf, 0xff,
-    0x80, 0x0, 0xc, 0xe7, 0x10, 0x0, 0x19, 0xfe,
-    0x5f, 0xf7, 0x10, 0x0, 0x5e, 0xf9, 0x0, 0x2,
-    0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xdf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x2,
-    0x57, 0x78, 0x88, 0x8f, 0xf8, 0x88, 0x88, 0x88,
-    0x88, 0x8d, 0xf3, 0x1, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xc, 0xfa, 0x30, 0x0, 0x0, 0x1f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xc0, 0x0,
-    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x5f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xc0, 0x0, 0x0, 0x0, 0xcf, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x25, 0x0, 0x1e, 0xf9, 0x10, 0x0,
-    0x3c, 0xf7, 0x3f, 0xfa, 0x20, 0x0, 0x6, 0xef,
-    0x10, 0x4, 0xff, 0xfd, 0xce, 0xff, 0x80, 0x3,
-    0xdf, 0xfe, 0xcd, 0xff, 0xf5, 0x0, 0x0, 0x29,
-    0xdf, 0xfd, 0x93, 0x0, 0x0, 0x6, 0xbe, 0xfe,
-    0xc7, 0x10, 0x0,
-
-    /* U+00E7 "ç" */
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x1b, 0xff, 0xed, 0xdf, 0xff, 0x60, 0x0, 0xdf,
-    0xd4, 0x0, 0x0, 0x7f, 0xf4, 0x9, 0xfb, 0x0,
-    0x0, 0x0, 0x3, 0xa1, 0x1f, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x3, 0xa1, 0x0, 0xdf, 0xd4, 0x0,
-    0x0, 0x7f, 0xf4, 0x0, 0x1b, 0xff, 0xfd, 0xdf,
-    0xff, 0x60, 0x0, 0x0, 0x4a, 0xff, 0xfd, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x8b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x47, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0, 0x23,
-    0x2, 0xda, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x0,
-    0x0, 0x0,
-
-    /* U+00E8 "è" */
-    0x0, 0x9, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xee, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xa9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xeb, 0x50, 0x0, 0x0, 0x1, 0xcf, 0xfd,
-    0xcd, 0xff, 0xc1, 0x0, 0x1, 0xef, 0x91, 0x0,
-    0x1, 0xaf, 0xd0, 0x0, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x17, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x9f, 0xa8, 0x88, 0x88, 0x88, 0x88,
-    0xaf, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0xcf, 0xd4, 0x0, 0x0, 0x4c, 0xf7, 0x0, 0x0,
-    0xaf, 0xff, 0xdd, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+00E9 "é" */
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xeb, 0x50, 0x0, 0x0, 0x1, 0xcf, 0xfd,
-    0xcd, 0xff, 0xc1, 0x0, 0x1, 0xef, 0x91, 0x0,
-    0x1, 0xaf, 0xd0, 0x0, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x17, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x9f, 0xa8, 0x88, 0x88, 0x88, 0x88,
-    0xaf, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0xcf, 0xd4, 0x0, 0x0, 0x4c, 0xf7, 0x0, 0x0,
-    0xaf, 0xff, 0xdd, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+00EA "ê" */
-    0x0, 0x0, 0x2, 0xef, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xee, 0x7f, 0xd1, 0x0, 0x0, 0x0,
-    0x1, 0xde, 0x20, 0x2e, 0xd1, 0x0, 0x0, 0x0,
-    0x8a, 0x10, 0x0, 0x1a, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b,
-    0xef, 0xeb, 0x50, 0x0, 0x0, 0x1, 0xcf, 0xfd,
-    0xcd, 0xff, 0xc1, 0x0, 0x1, 0xef, 0x91, 0x0,
-    0x1, 0xaf, 0xd0, 0x0, 0xaf, 0x80, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x17, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf6, 0x9f, 0xa8, 0x88, 0x88, 0x88, 0x88,
-    0xaf, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xb0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0,
-    0xcf, 0xd4, 0x0, 0x0, 0x4c, 0xf7, 0x0, 0x0,
-    0xaf, 0xff, 0xdd, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
-
-    /* U+00EB "ë" */
-    0x0, 0x0, 0xdc, 0x0, 0xd, 0xc0, 0x0, 0x0,
-    0x0, 0x2f, 0xf1, 0x2, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x44, 0x0, 0x4, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xbe, 0xfe, 0xb5, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0xdc, 0xdf, 0xfc, 0x10, 0x0, 0x1e, 0xf9, 0x10,
-    0x0, 0x1a, 0xfd, 0x0, 0xa, 0xf8, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x2, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf1, 0x7f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x69, 0xfa, 0x88, 0x88, 0x88, 0x88,
-    0x8a, 0xf8, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x99, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x70, 0x0,
-    0xc, 0xfd, 0x40, 0x0, 0x4, 0xcf, 0x70, 0x0,
-    0xa, 0xff, 0xfd, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x3, 0x9d, 0xff, 0xd9, 0x30, 0x0,
-
-    /* U+00EC "ì" */
-    0x5f, 0xf5, 0x0, 0x0, 0x2d, 0xf5, 0x0, 0x0,
-    0xb, 0xf6, 0x0, 0x0, 0x7, 0x92, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3,
-    0xfc, 0x0,
-
-    /* U+00ED "í" */
-    0x0, 0x0, 0xbf, 0xb1, 0x0, 0xb, 0xf9, 0x0,
-    0x1, 0xcf, 0x50, 0x0, 0x7, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0,
-
-    /* U+00EE "î" */
-    0x0, 0x9, 0xff, 0x30, 0x0, 0x6, 0xf9, 0xee,
-    0x10, 0x3, 0xfa, 0x2, 0xec, 0x0, 0x88, 0x0,
-    0x3, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x3f,
-    0xc0, 0x0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-
-    /* U+00EF "ï" */
-    0x1d, 0xc0, 0x3e, 0x72, 0xff, 0x6, 0xfb, 0x4,
-    0x30, 0x5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xc0,
-    0x0, 0x3, 0xfc, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x3, 0xfc, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfc,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x0,
-    0x0, 0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x3, 0xfc, 0x0,
-
-    /* U+00F0 "ð" */
-    0x2, 0x9c, 0xef, 0xfe, 0xb7, 0x10, 0x28, 0x0,
-    0x3, 0xfe, 0xcb, 0xbc, 0xff, 0xfc, 0xff, 0x20,
-    0x0, 0x20, 0x0, 0x3, 0x9f, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x17, 0xdf, 0xd7, 0x2b, 0xf9, 0x0,
-    0x0, 0x1b, 0xff, 0x93, 0x0, 0x0, 0xef, 0x30,
-    0x0, 0xa, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0x38, 0xab, 0x96, 0x0, 0xc, 0xf2,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xe5, 0xa, 0xf4,
-    0x3, 0xff, 0xb4, 0x10, 0x16, 0xdf, 0x69, 0xf6,
-    0xe, 0xf7, 0x0, 0x0, 0x0, 0xb, 0xfb, 0xf6,
-    0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf4,
-    0xaf, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf1,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc0,
-    0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60,
-    0x1f, 0xf4, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x0,
-    0x6, 0xff, 0x60, 0x0, 0x2, 0xaf, 0xf3, 0x0,
-    0x0, 0x6f, 0xff, 0xcc, 0xdf, 0xfd, 0x30, 0x0,
-    0x0, 0x2, 0x8c, 0xef, 0xeb, 0x60, 0x0, 0x0,
-
-    /* U+00F1 "ñ" */
-    0x0, 0x0, 0xaf, 0xc3, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x7e, 0x69, 0xf5, 0x1c, 0x90, 0x0, 0x0,
-    0xc, 0x60, 0x5, 0xef, 0xd1, 0x0, 0x0, 0x0,
-    0x20, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xa0, 0x17,
-    0xce, 0xfe, 0xa3, 0x0, 0x3, 0xfa, 0x4e, 0xfe,
-    0xbc, 0xef, 0xf8, 0x0, 0x3f, 0xdf, 0xc3, 0x0,
-    0x0, 0x6f, 0xf5, 0x3, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x6f, 0xd0, 0x3f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0x13, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xf4, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xf5, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x53, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x53,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x53, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x3f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-
-    /* U+00F2 "ò" */
-    0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xcf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xa2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0,
-    0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-
-    /* U+00F3 "ó" */
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7a, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0,
-    0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-
-    /* U+00F4 "ô" */
-    0x0, 0x0, 0x0, 0xbf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xf8, 0xdf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0xb, 0xf4, 0x0, 0x0,
-    0x0, 0x5, 0xa4, 0x0, 0x0, 0x8a, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0,
-    0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-
-    /* U+00F5 "õ" */
-    0x0, 0x0, 0x7e, 0xe5, 0x0, 0x1f, 0x10, 0x0,
-    0x0, 0x4, 0xf7, 0x7f, 0x81, 0x9d, 0x0, 0x0,
-    0x0, 0x8, 0xa0, 0x2, 0xdf, 0xf4, 0x0, 0x0,
-    0x0, 0x1, 0x10, 0x0, 0x2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0,
-    0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-
-    /* U+00F6 "ö" */
-    0x0, 0x0, 0x9e, 0x30, 0x9, 0xe3, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x60, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x25, 0x0, 0x2, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0,
-    0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0,
-    0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-
-    /* U+00F7 "÷" */
-    0x0, 0x0, 0x0, 0x89, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xa1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x10,
-    0x0, 0x0,
-
-    /* U+00F8 "ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb9, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xec, 0x77, 0xe1, 0x0,
-    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0xb0, 0x0,
-    0x0, 0xdf, 0xc4, 0x0, 0x1, 0xff, 0xf7, 0x0,
-    0x9, 0xfb, 0x0, 0x0, 0x4, 0xe5, 0xff, 0x30,
-    0x1f, 0xf1, 0x0, 0x0, 0x1e, 0x50, 0x7f, 0xa0,
-    0x7f, 0xa0, 0x0, 0x0, 0x9b, 0x0, 0x1f, 0xf0,
-    0x9f, 0x60, 0x0, 0x4, 0xf1, 0x0, 0xd, 0xf2,
-    0xbf, 0x50, 0x0, 0xe, 0x60, 0x0, 0xc, 0xf3,
-    0x9f, 0x60, 0x0, 0x9b, 0x0, 0x0, 0xd, 0xf2,
-    0x7f, 0xa0, 0x3, 0xf2, 0x0, 0x0, 0x1f, 0xf0,
-    0x1f, 0xf1, 0xd, 0x70, 0x0, 0x0, 0x8f, 0xa0,
-    0x9, 0xfc, 0x9c, 0x0, 0x0, 0x3, 0xff, 0x30,
-    0x0, 0xdf, 0xf7, 0x0, 0x1, 0x7f, 0xf6, 0x0,
-    0x0, 0x1f, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x7d, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
-    0x2, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00F9 "ù" */
-    0x0, 0xa, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xed, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x98, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x1, 0xef, 0xf0, 0x6,
-    0xff, 0x50, 0x0, 0x3, 0xdd, 0xef, 0x0, 0x8,
-    0xff, 0xeb, 0xbd, 0xfd, 0x2d, 0xf0, 0x0, 0x3,
-    0xae, 0xfe, 0xc7, 0x0, 0xdf, 0x0,
-
-    /* U+00FA "ú" */
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x19, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x1, 0xef, 0xf0, 0x6,
-    0xff, 0x50, 0x0, 0x3, 0xdd, 0xef, 0x0, 0x8,
-    0xff, 0xeb, 0xbd, 0xfd, 0x2d, 0xf0, 0x0, 0x3,
-    0xae, 0xfe, 0xc7, 0x0, 0xdf, 0x0,
-
-    /* U+00FB "û" */
-    0x0, 0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x7f, 0xc0, 0x0, 0x0, 0x0,
-    0x3, 0xfc, 0x10, 0x3e, 0xc0, 0x0, 0x0, 0x0,
-    0x88, 0x0, 0x0, 0x29, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0,
-    0x2f, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x0,
-    0xef, 0x50, 0x0, 0x0, 0x1, 0xef, 0xf0, 0x6,
-    0xff, 0x50, 0x0, 0x3, 0xdd, 0xef, 0x0, 0x8,
-    0xff, 0xeb, 0xbd, 0xfd, 0x2d, 0xf0, 0x0, 0x3,
-    0xae, 0xfe, 0xc7, 0x0, 0xdf, 0x0,
-
-    /* U+00FC "ü" */
-    0x0, 0x1, 0xeb, 0x0, 0x2e, 0xb0, 0x0, 0x0,
-    0x0, 0x4f, 0xf0, 0x4, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x53, 0x0, 0x5, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0x2, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0xe, 0xf5, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x0,
-    0x6f, 0xf5, 0x0, 0x0, 0x3d, 0xde, 0xf0, 0x0,
-    0x8f, 0xfe, 0xbb, 0xdf, 0xd2, 0xdf, 0x0, 0x0,
-    0x3a, 0xef, 0xec, 0x70, 0xd, 0xf0,
-
-    /* U+00FD "ý" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x97, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfe, 0x0, 0x4f, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0x0, 0xe, 0xf0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x7f,
-    0x90, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0,
-    0xff, 0x10, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0,
-    0x8, 0xf7, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0x0, 0xaf, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0x50, 0x1f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xfd, 0x8, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf5, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
-    0x0, 0x0, 0x0, 0x1, 0x80, 0x0, 0x3f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc, 0xcf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0xfe, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00FE "þ" */
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x6, 0xbe, 0xfd, 0xa4, 0x0, 0x0,
-    0x3f, 0xc2, 0xcf, 0xfd, 0xce, 0xff, 0xb1, 0x0,
-    0x3f, 0xdd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x0,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfa,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf9,
-    0x3f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7,
-    0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf1,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xbf, 0xa0,
-    0x3f, 0xdd, 0xf7, 0x10, 0x0, 0x4d, 0xfd, 0x10,
-    0x3f, 0xc1, 0xcf, 0xfd, 0xdf, 0xff, 0xc1, 0x0,
-    0x3f, 0xc0, 0x6, 0xbe, 0xfd, 0xb4, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+00FF "ÿ" */
-    0x0, 0x0, 0x3e, 0x90, 0x3, 0xe8, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x0, 0x6f, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0x20, 0x0, 0x52, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xe0, 0x4, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf7, 0x0, 0xd, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0x6f, 0xa0, 0x0,
-    0x0, 0x0, 0x6f, 0x80, 0x0, 0x0, 0xef, 0x20,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x7, 0xf9,
-    0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x0, 0xf,
-    0xf1, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0,
-    0x8f, 0x70, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
-    0x1, 0xfe, 0x0, 0xa, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf5, 0x1, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xd0, 0x8f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x5f, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0x0, 0x3, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xcc, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xeb, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2600 "☀" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0x10, 0x0, 0x0, 0xd, 0x69, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xde,
-    0x40, 0x0, 0x8, 0xc0, 0x6a, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa7, 0x5e, 0xa0,
-    0x3, 0xf2, 0x3, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xa0, 0x1a, 0xe4, 0xea,
-    0x20, 0xf, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3e, 0x0, 0x1e, 0xff, 0xef, 0xfb,
-    0xf3, 0x14, 0x7a, 0xdf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xf2, 0x6f, 0xa4, 0x0, 0x1, 0x6f, 0xff,
-    0xda, 0x74, 0xe6, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xde, 0x30, 0x0, 0x0, 0x0, 0xb, 0xe1, 0x0,
-    0x8c, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x3f, 0x20,
-    0x0, 0x2, 0x68, 0xbe, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x6d, 0x60, 0x0, 0x2,
-    0xfb, 0x85, 0x35, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x98, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf8, 0x0, 0x0, 0x0, 0x2c, 0xd4, 0xb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfa, 0x10, 0x0, 0x0, 0x6, 0xea, 0xd4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc5, 0xae,
-    0x60, 0x0, 0x0, 0x1, 0xaf, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0x30, 0x4e, 0xb1,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xf0, 0x0, 0xb, 0xb0, 0x0,
-    0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8e, 0x69, 0xbe, 0xf7, 0x0, 0x0, 0x2f,
-    0x3b, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x85, 0x20, 0x0, 0x0, 0xc, 0x80, 0x2f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x7f, 0xc0,
-    0x0, 0x0, 0x0, 0x2d, 0xbd, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf8, 0x8b, 0xfe, 0xef, 0xf7, 0x42,
-    0x37, 0xbf, 0x80, 0x98, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xd9, 0x62, 0x0, 0xca, 0xad, 0xff, 0xff,
-    0x70, 0x6, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0x80, 0x2, 0xf3, 0x5e, 0xa1,
-    0x2e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6b, 0x0, 0xc8, 0x0, 0x1a, 0xe4, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xe0, 0x6d, 0x0, 0x0, 0x5, 0xef, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0x2e,
-    0x40, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+2601 "☁" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x8d, 0xff, 0xfb, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0x41, 0x2, 0x6c, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xd2, 0x0, 0x0, 0x0, 0x6, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x23, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xef, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xd4, 0x0, 0x17, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xc0, 0x0, 0x0, 0x4, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0x0, 0x0, 0x0, 0xa, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x0, 0x0, 0x0, 0x0, 0x6a, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7d, 0x50, 0x0, 0x0, 0x6,
-    0xdf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x6c, 0xc1, 0x0, 0xb,
-    0xe6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xd0, 0x9,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0x60,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a,
-    0x2f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xb0, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x99, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0x30, 0xb, 0xd5, 0x0, 0x1, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4e, 0x80, 0x0, 0x6, 0xdf, 0xee, 0xff, 0x91,
-    0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x3d,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x13, 0x30, 0x1b,
-    0xfa, 0x88, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x4e,
-    0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x7a, 0x98, 0x33, 0xec, 0x63, 0x35, 0xbe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6b, 0xdd, 0xb7,
-    0x10, 0x0, 0x0, 0x0,
-
-    /* U+26A1 "⚡" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xad, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xe7, 0x6c, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0x41, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xc2, 0x9, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xda, 0x0,
-    0x3e, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0x60, 0x0, 0xd5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xe3, 0x0, 0x7,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbc, 0x10, 0x0, 0x1e, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2d, 0x90, 0x0, 0x0, 0xa8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe5,
-    0x0, 0x0, 0x4, 0xf4, 0x44, 0x44, 0x44, 0x20,
-    0x0, 0x0, 0x8d, 0x30, 0x0, 0x0, 0xb, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xf1, 0x0, 0x1b, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xb0,
-    0x3, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xd9, 0x0, 0x4e, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x60, 0x0,
-    0x7f, 0xee, 0xee, 0xee, 0xee, 0xe3, 0x0, 0x0,
-    0x5, 0xe4, 0x0, 0x0, 0x2, 0x22, 0x22, 0x22,
-    0x2a, 0xa0, 0x0, 0x0, 0x8d, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0x10, 0x0, 0xa,
-    0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb7, 0x0, 0x1, 0xca, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x3e, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0x30, 0x5, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x99, 0x0, 0x7e, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xe1,
-    0xa, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0x61, 0xca, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x3e,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xe8, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+26C5 "⛅" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x63,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x80, 0x0, 0x0,
-    0xe, 0x7f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xed, 0x20,
-    0x0, 0x8b, 0xf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x86,
-    0xf6, 0x2, 0xf2, 0xd, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xc0, 0x3e, 0xab, 0x80, 0xa, 0x70, 0x0, 0x15,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xf0, 0x3, 0xff, 0xfe, 0xbc, 0xb6, 0xad,
-    0xfe, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd4, 0x7f, 0x94, 0x23, 0x6d, 0xfc,
-    0x74, 0xb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xae, 0xd2, 0x0, 0x0, 0x0,
-    0x8d, 0x14, 0xef, 0x95, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0x8a, 0xdf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xe, 0xfe, 0x98, 0x9c, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x97, 0x41, 0xa8, 0x0, 0x0,
-    0x0, 0x0, 0x8e, 0x50, 0x0, 0x0, 0x3d, 0xb0,
-    0x0, 0x0, 0x0, 0x4f, 0xa1, 0x0, 0xf2, 0x0,
-    0x0, 0x0, 0x7, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0xbb, 0x0, 0x0, 0x0, 0x1, 0xaf, 0x71, 0xf0,
-    0x0, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0x50, 0x0, 0x0, 0x0, 0x4, 0xde,
-    0xf0, 0x0, 0x0, 0x13, 0xa9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0x0, 0x3c, 0xfe, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xc8, 0x5, 0xf6, 0x0, 0x7, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0xc8, 0x2e, 0x4e, 0x40, 0x0, 0x0,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc4, 0x0,
-    0x0, 0x0, 0x8, 0xc0, 0x5, 0xfc, 0x0, 0x0,
-    0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe3,
-    0x0, 0x0, 0x0, 0x3f, 0x21, 0x7f, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0x20, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x91, 0x0, 0x0, 0x9e, 0xdf, 0xff, 0xc3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x9e, 0x20, 0x0, 0x27, 0x8f, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0xc6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x0,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xf0, 0x0,
-    0x0, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xc0,
-    0x0, 0x0, 0x7e, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7f,
-    0x40, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0x0, 0x0,
-
-    /* U+26C8 "⛈" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xac, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xec, 0x74,
-    0x46, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0x40, 0x0, 0x0,
-    0x3, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xfc, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe6, 0x0, 0x2, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x50, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0x0, 0x0, 0x0, 0x59,
-    0xdb, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0xf9, 0x0, 0xc, 0xe8, 0x42,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xa0, 0x9b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf2, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd4, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf3, 0x6e, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xb0,
-    0x6, 0xef, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf8, 0x0, 0x0,
-    0x1, 0x33, 0x33, 0x33, 0x38, 0xd3, 0x33, 0x9c,
-    0x33, 0x33, 0x33, 0x32, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0x70, 0x0, 0xe6, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0x20, 0x0, 0x1f, 0x10, 0x5, 0xff, 0xff, 0x20,
-    0x0, 0x89, 0x0, 0x0, 0x0, 0x0, 0xef, 0x40,
-    0x0, 0x7c, 0x0, 0x0, 0x0, 0x4f, 0x10, 0x7,
-    0xfc, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0,
-    0xc8, 0x22, 0x21, 0x1, 0xe6, 0x0, 0x1f, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xfe, 0x0, 0x0, 0x9f,
-    0xff, 0xf8, 0xb, 0xa0, 0x0, 0x3f, 0xf6, 0x0,
-    0x0, 0x0, 0x1, 0x62, 0x0, 0x0, 0x0, 0x0,
-    0xc5, 0x7d, 0x0, 0x0, 0x4, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x86, 0x0, 0x0, 0xf5,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x3, 0xfe, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0x5, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf4, 0x0, 0x0, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+2744 "❄" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0x9e, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x57, 0xc0, 0x3f, 0x36, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xce, 0xff, 0x7,
-    0xff, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0xc, 0x45, 0xa1, 0x58, 0x1b, 0x50,
-    0x2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x50,
-    0x7c, 0x10, 0x0, 0x4, 0xe1, 0xb, 0xf9, 0x0,
-    0x0, 0x1, 0x68, 0x7d, 0x3f, 0x10, 0x9e, 0x70,
-    0x2b, 0xe3, 0x8, 0xb6, 0xc8, 0x83, 0x0, 0xea,
-    0x8f, 0xc0, 0xc4, 0x0, 0x5f, 0x7, 0xc1, 0x0,
-    0xc4, 0x4f, 0xc9, 0xd6, 0xd, 0x30, 0x66, 0xb,
-    0x60, 0x1, 0xf0, 0x7a, 0x0, 0xd, 0x30, 0xa1,
-    0xb, 0x50, 0x8b, 0x61, 0x0, 0xbd, 0x40, 0x1f,
-    0x7, 0xa0, 0x8, 0xf3, 0x0, 0x48, 0xf1, 0x1,
-    0xdf, 0x50, 0x0, 0x6e, 0xb4, 0xf0, 0x7a, 0x7e,
-    0xb2, 0x0, 0xd, 0xf6, 0x0, 0x6e, 0x50, 0x3b,
-    0x30, 0x7, 0xfe, 0x6, 0xfc, 0x30, 0x8, 0x90,
-    0x1b, 0xd0, 0x8, 0xd7, 0xae, 0x9e, 0xa1, 0x1,
-    0x0, 0x1, 0x0, 0x5e, 0xbb, 0xe8, 0xae, 0x10,
-    0x5, 0x97, 0x10, 0x19, 0xe6, 0x1, 0xb7, 0x1,
-    0xbe, 0x50, 0x4, 0x98, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xd0, 0x6f, 0xe0, 0x4f, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xb9, 0x20, 0x2c, 0xd4,
-    0x0, 0x95, 0x0, 0x9f, 0x70, 0x6, 0xba, 0x20,
-    0x9, 0xd5, 0x8f, 0xbf, 0x80, 0x2, 0x0, 0x2,
-    0x0, 0x3c, 0xdd, 0xc6, 0x8f, 0x10, 0x4f, 0x80,
-    0x28, 0x20, 0x1a, 0xff, 0x7, 0xfe, 0x60, 0x6,
-    0x60, 0x2d, 0xb0, 0x2, 0xdf, 0x60, 0x1, 0x9f,
-    0x93, 0xf0, 0x7a, 0x5d, 0xd5, 0x0, 0xe, 0xf7,
-    0x0, 0x9a, 0x40, 0x0, 0xbb, 0x20, 0x1f, 0x7,
-    0xa0, 0x6, 0xf4, 0x0, 0x25, 0xf1, 0xd, 0x20,
-    0x78, 0xb, 0x60, 0x1, 0xf0, 0x7a, 0x0, 0xd,
-    0x31, 0xc2, 0xa, 0x50, 0xdc, 0xaf, 0xd0, 0xd4,
-    0x0, 0x7f, 0x7, 0xd2, 0x0, 0xb5, 0x5f, 0xdb,
-    0xe5, 0x0, 0x46, 0x5d, 0x6e, 0x0, 0xcc, 0x50,
-    0x18, 0xf5, 0x7, 0xc7, 0xb5, 0x51, 0x0, 0x0,
-    0x1, 0xdd, 0x30, 0x9a, 0x0, 0x0, 0x2, 0xe2,
-    0x8, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0x58, 0xd1, 0x7c, 0x5b, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xdd,
-    0x5, 0xfd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x15, 0xd0, 0x6e, 0x1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+1F327 "🌧" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xac, 0xdb, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xec, 0x74,
-    0x46, 0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6e, 0x40, 0x0, 0x0,
-    0x3, 0xe9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x7c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xec, 0xdf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe5, 0x0, 0x2, 0xcb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0xc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0x0, 0x0, 0x0, 0x5, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0x0, 0x0, 0x0, 0x59,
-    0xd9, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0xf9, 0x0, 0xc, 0xd8, 0x41,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xa0, 0x9b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xf2, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd4, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf3, 0x7e, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xb0,
-    0x6, 0xef, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf8, 0x0, 0x0,
-    0x1, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x32, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0x30, 0x0, 0x0, 0x0, 0x7f, 0x0, 0x0, 0x0,
-    0x0, 0xbb, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0x0, 0x9,
-    0xfb, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0,
-    0xd, 0xfa, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x41, 0x0, 0x0, 0x0, 0x1,
-    0x40, 0x0, 0x0, 0x0, 0x2, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xb0, 0x0, 0x0,
-    0x0, 0x4b, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xf0, 0x0, 0x0, 0x4,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0, 0xe, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x37, 0x10, 0x0, 0x0, 0x4, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+1F328 "🌨" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xac, 0xca, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xeb, 0x64,
-    0x57, 0xde, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0x30, 0x0, 0x0,
-    0x5, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x89, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xec, 0xee,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7a, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xe5, 0x0, 0x3, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x1e, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x4c, 0x0, 0x0, 0x0,
-    0x0, 0x3b, 0x0, 0x0, 0x0, 0x8, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x59,
-    0xd9, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xf8, 0x0, 0x1c, 0xd8, 0x41,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2b, 0xa0, 0x9b, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf2, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc4, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf3, 0x7e, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xb0,
-    0x6, 0xef, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xf8, 0x0, 0x0,
-    0x1, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x32, 0x0, 0x0, 0x0, 0x1,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x6d,
-    0x20, 0x0, 0x0, 0x9, 0x4b, 0x20, 0x0, 0x0,
-    0x2, 0xb5, 0x80, 0x0, 0x0, 0x26, 0xfc, 0x40,
-    0x0, 0x0, 0x4, 0xec, 0x10, 0x0, 0x0, 0x1,
-    0xce, 0x40, 0x0, 0x0, 0x5a, 0xfd, 0xa0, 0x0,
-    0x0, 0x6c, 0xfe, 0xc0, 0x0, 0x0, 0xc, 0xef,
-    0xc5, 0x0, 0x0, 0x8, 0x8d, 0x10, 0x0, 0x0,
-    0x7, 0xad, 0x10, 0x0, 0x0, 0x1, 0xdb, 0x50,
-    0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x0, 0x4,
-    0x4, 0x10, 0x1, 0x1, 0x1, 0x31, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x25, 0x35, 0x0, 0x0,
-    0x0, 0xb, 0x5d, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xd3, 0x0, 0x0, 0x0,
-    0x5a, 0xfc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xfe, 0x50, 0x0, 0x0, 0x49,
-    0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xc3, 0x0, 0x0, 0x0, 0xb, 0x4d,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x25, 0x34, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+1F32B "🌫" */
-    0x4, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40, 0xf,
-    0x52, 0x22, 0x22, 0x28, 0xf5, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x25, 0xf0, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0x35, 0x78, 0x85, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0xa9, 0xac, 0xff, 0x9c,
-    0xee, 0xd9, 0x40, 0xe3, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x10, 0x0, 0x4, 0xef, 0x85, 0x32,
-    0x48, 0xdd, 0xf3, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x0, 0x7e, 0x60, 0x0, 0x0, 0x0,
-    0x7, 0xf3, 0x3e, 0x0, 0x0, 0x0, 0x3, 0x9e,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0x3e, 0x0, 0x0, 0x0, 0xaf, 0x83, 0x0,
-    0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe3,
-    0x3e, 0x0, 0x0, 0x1c, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x3f,
-    0x50, 0x0, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x3f, 0xde,
-    0x74, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0x3e, 0x4, 0xdf,
-    0x90, 0x1, 0x34, 0x31, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe3, 0x3e, 0x0, 0xb, 0xd7,
-    0xdf, 0xdc, 0xdf, 0xe8, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe3, 0x3e, 0x0, 0x0, 0xab, 0x40,
-    0x0, 0x0, 0x4a, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe3, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2c, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x2, 0x33, 0x10, 0x0, 0xe3,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xee, 0xfe, 0xa4, 0xe3, 0x3e,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x10, 0x0, 0x3, 0x8e, 0xf3, 0x3e, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf3, 0x3e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0xbd, 0xff, 0xf3, 0x3e, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7e, 0xe9,
-    0x63, 0x21, 0xe3, 0x3e, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0xd5, 0x0, 0x0,
-    0x0, 0xe3, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xe3, 0x3e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26,
-    0xac, 0xef, 0x40, 0x0, 0x0, 0x0, 0x0, 0xe3,
-    0x3e, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xfc, 0x85,
-    0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x3e,
-    0x0, 0x0, 0x0, 0x1a, 0xf8, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe3, 0x3e, 0x0,
-    0x0, 0x3, 0xea, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe3, 0xe, 0x63, 0x33,
-    0x6f, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x37, 0xe0, 0x3, 0xcd, 0xee, 0xef,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xdc, 0x30
+    /* U+00F6 */
+    0x0, 0x0, 0x9e, 0x30, 0x9, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x60, 0xd, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x25, 0x0, 0x2, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xec, 0xdf, 0xff, 0x60, 0x0, 0x0, 0xdf, 0xc4, 0x0, 0x1, 0x7f, 0xf7, 0x0,
+    0x9, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0,
+    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
+    0xbf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf2,
+    0x7f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x1f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xa0,
+    0x9, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0, 0xdf, 0xd4, 0x0, 0x1, 0x7f, 0xf6, 0x0,
+    0x0, 0x1a, 0xff, 0xfd, 0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x4a, 0xdf, 0xec, 0x71, 0x0, 0x0,
 };
 
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 117, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
@@ -4493,821 +1102,272 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 12025, .adv_w = 132, .box_w = 3, .box_h = 26, .ofs_x = 3, .ofs_y = -5},
     {.bitmap_index = 12064, .adv_w = 150, .box_w = 8, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
     {.bitmap_index = 12168, .adv_w = 258, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 12203, .adv_w = 117, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12203, .adv_w = 116, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 12243, .adv_w = 252, .box_w = 14, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 12404, .adv_w = 285, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12584, .adv_w = 314, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12765, .adv_w = 311, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12965, .adv_w = 132, .box_w = 3, .box_h = 26, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 13004, .adv_w = 220, .box_w = 13, .box_h = 23, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 13154, .adv_w = 269, .box_w = 9, .box_h = 3, .ofs_x = 4, .ofs_y = 18},
-    {.bitmap_index = 13168, .adv_w = 362, .box_w = 21, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 13389, .adv_w = 180, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 13430, .adv_w = 214, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 13496, .adv_w = 258, .box_w = 14, .box_h = 7, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 13545, .adv_w = 171, .box_w = 9, .box_h = 2, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 13554, .adv_w = 362, .box_w = 21, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 13775, .adv_w = 269, .box_w = 9, .box_h = 3, .ofs_x = 4, .ofs_y = 18},
-    {.bitmap_index = 13789, .adv_w = 188, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 13839, .adv_w = 258, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13958, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 14024, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 14090, .adv_w = 269, .box_w = 8, .box_h = 4, .ofs_x = 6, .ofs_y = 17},
-    {.bitmap_index = 14106, .adv_w = 304, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 14256, .adv_w = 283, .box_w = 15, .box_h = 24, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 14436, .adv_w = 113, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = 6},
-    {.bitmap_index = 14444, .adv_w = 269, .box_w = 6, .box_h = 7, .ofs_x = 5, .ofs_y = -7},
-    {.bitmap_index = 14465, .adv_w = 193, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 14519, .adv_w = 185, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 11},
-    {.bitmap_index = 14574, .adv_w = 214, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 14635, .adv_w = 461, .box_w = 26, .box_h = 22, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 14921, .adv_w = 461, .box_w = 26, .box_h = 22, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 15207, .adv_w = 461, .box_w = 28, .box_h = 22, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 15515, .adv_w = 254, .box_w = 14, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 15655, .adv_w = 321, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15918, .adv_w = 321, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16181, .adv_w = 321, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16444, .adv_w = 321, .box_w = 21, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16717, .adv_w = 321, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16980, .adv_w = 321, .box_w = 21, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17274, .adv_w = 463, .box_w = 28, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 17554, .adv_w = 322, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 17797, .adv_w = 300, .box_w = 15, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17985, .adv_w = 300, .box_w = 15, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18173, .adv_w = 300, .box_w = 15, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18361, .adv_w = 300, .box_w = 15, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18549, .adv_w = 135, .box_w = 8, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18649, .adv_w = 135, .box_w = 7, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18737, .adv_w = 135, .box_w = 10, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18862, .adv_w = 135, .box_w = 8, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18962, .adv_w = 372, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19182, .adv_w = 364, .box_w = 17, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 19403, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19678, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19953, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20228, .adv_w = 376, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20514, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20789, .adv_w = 258, .box_w = 10, .box_h = 11, .ofs_x = 3, .ofs_y = 4},
-    {.bitmap_index = 20844, .adv_w = 376, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 21108, .adv_w = 355, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21321, .adv_w = 355, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21534, .adv_w = 355, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21747, .adv_w = 355, .box_w = 17, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 21960, .adv_w = 284, .box_w = 18, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22185, .adv_w = 322, .box_w = 16, .box_h = 20, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 22345, .adv_w = 299, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22513, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22650, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22787, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22924, .adv_w = 264, .box_w = 13, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23061, .adv_w = 264, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23191, .adv_w = 264, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23341, .adv_w = 442, .box_w = 26, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23536, .adv_w = 252, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 23690, .adv_w = 271, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23848, .adv_w = 271, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24006, .adv_w = 271, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24164, .adv_w = 271, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24314, .adv_w = 121, .box_w = 7, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 24388, .adv_w = 121, .box_w = 8, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24472, .adv_w = 121, .box_w = 9, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 24567, .adv_w = 121, .box_w = 7, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 24637, .adv_w = 284, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24797, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24955, .adv_w = 281, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25123, .adv_w = 281, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25291, .adv_w = 281, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25459, .adv_w = 281, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25627, .adv_w = 281, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25787, .adv_w = 258, .box_w = 14, .box_h = 14, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 25885, .adv_w = 281, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 26037, .adv_w = 302, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26195, .adv_w = 302, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26353, .adv_w = 302, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26511, .adv_w = 302, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 26661, .adv_w = 243, .box_w = 17, .box_h = 26, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 26882, .adv_w = 304, .box_w = 16, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 27090, .adv_w = 243, .box_w = 17, .box_h = 25, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 27303, .adv_w = 569, .box_w = 29, .box_h = 29, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 27724, .adv_w = 569, .box_w = 33, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 28120, .adv_w = 569, .box_w = 24, .box_h = 29, .ofs_x = 6, .ofs_y = -5},
-    {.bitmap_index = 28468, .adv_w = 569, .box_w = 34, .box_h = 27, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 28927, .adv_w = 569, .box_w = 30, .box_h = 29, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 29362, .adv_w = 569, .box_w = 27, .box_h = 29, .ofs_x = 4, .ofs_y = -5},
-    {.bitmap_index = 29754, .adv_w = 569, .box_w = 30, .box_h = 29, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 30189, .adv_w = 569, .box_w = 30, .box_h = 29, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 30624, .adv_w = 569, .box_w = 30, .box_h = 29, .ofs_x = 3, .ofs_y = -5}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_2[] = {
-    0x0, 0x1, 0xa1, 0xc5, 0xc8, 0x144
+    {.bitmap_index = 12203, .adv_w = 188, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 12253, .adv_w = 321, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12516, .adv_w = 321, .box_w = 21, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12810, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13085, .adv_w = 264, .box_w = 13, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13215, .adv_w = 264, .box_w = 13, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13365, .adv_w = 281, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
 };
 
-static const uint8_t glyph_id_ofs_list_3[] = {
-    0, 1, 0, 0, 2
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x14, 0x15, 0x26, 0x34, 0x35, 0x46,
 };
 
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
     {
         .range_start = 32, .range_length = 95, .glyph_id_start = 1,
         .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
     },
     {
-        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 9728, .range_length = 325, .glyph_id_start = 192,
-        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    },
-    {
-        .range_start = 127783, .range_length = 5, .glyph_id_start = 198,
-        .unicode_list = NULL, .glyph_id_ofs_list = glyph_id_ofs_list_3, .list_length = 5, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL
+        .range_start = 176, .range_length = 71, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 7, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
     }
 };
 
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Map glyph_ids to kern left classes*/
-static const uint8_t kern_left_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 0, 13, 14, 15, 16, 17,
-    18, 19, 12, 20, 20, 0, 0, 0,
-    21, 22, 23, 24, 25, 22, 26, 27,
-    28, 29, 29, 30, 31, 32, 29, 29,
-    22, 33, 34, 35, 3, 36, 30, 37,
-    37, 38, 39, 40, 41, 42, 43, 0,
-    44, 0, 45, 46, 47, 48, 49, 50,
-    51, 45, 52, 52, 53, 48, 45, 45,
-    46, 46, 54, 55, 56, 57, 51, 58,
-    58, 59, 58, 60, 41, 0, 0, 9,
-    0, 61, 47, 62, 63, 64, 0, 65,
-    0, 22, 8, 66, 0, 9, 22, 0,
-    67, 0, 0, 0, 0, 51, 29, 9,
-    0, 0, 8, 9, 0, 0, 0, 68,
-    23, 23, 23, 23, 23, 23, 26, 25,
-    26, 26, 26, 26, 29, 29, 29, 29,
-    22, 29, 22, 22, 22, 22, 22, 0,
-    22, 30, 30, 30, 30, 39, 69, 46,
-    45, 45, 45, 45, 45, 45, 49, 47,
-    49, 49, 49, 49, 51, 51, 70, 51,
-    71, 45, 46, 46, 46, 46, 46, 9,
-    46, 51, 51, 51, 51, 58, 46, 58,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    61, 23, 23, 22, 45, 45, 46,
 };
 
-/*Map glyph_ids to kern right classes*/
-static const uint8_t kern_right_class_mapping[] =
-{
-    0, 0, 1, 2, 0, 3, 4, 5,
-    2, 6, 7, 8, 9, 10, 9, 10,
-    11, 12, 13, 14, 15, 16, 17, 12,
-    18, 19, 20, 21, 21, 0, 0, 0,
-    22, 23, 24, 25, 23, 25, 25, 25,
-    23, 25, 25, 26, 25, 25, 25, 25,
-    23, 25, 23, 25, 3, 27, 28, 29,
-    29, 30, 31, 32, 33, 34, 35, 0,
-    36, 0, 37, 38, 39, 39, 39, 0,
-    39, 38, 40, 41, 38, 38, 42, 42,
-    39, 42, 39, 42, 43, 44, 45, 46,
-    46, 47, 46, 48, 0, 0, 35, 9,
-    0, 49, 39, 50, 51, 52, 0, 53,
-    0, 23, 8, 9, 9, 9, 23, 0,
-    54, 0, 0, 0, 0, 42, 55, 9,
-    0, 0, 8, 56, 0, 0, 0, 57,
-    24, 24, 24, 24, 24, 24, 24, 23,
-    25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 23, 23, 23, 23, 23, 0,
-    23, 28, 28, 28, 28, 31, 25, 38,
-    37, 37, 37, 37, 37, 37, 37, 39,
-    39, 39, 39, 39, 58, 42, 59, 60,
-    39, 42, 39, 39, 39, 39, 39, 9,
-    39, 45, 45, 45, 45, 46, 38, 46,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 46, 48, 0, 0, 35, 9,
+    49, 24, 24, 23, 37, 37, 39,
 };
 
-/*Kern values between classes*/
-static const int8_t kern_class_values[] =
-{
-    0, 1, 0, 0, 0, 0, 0, 0,
-    0, 1, 0, 0, 4, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 3, 0, 0, 0, 0,
-    0, 0, 0, 0, 1, 20, 0, 13,
-    -11, 0, 0, 0, 0, -25, -27, 4,
-    22, 11, 8, -18, 4, 24, 2, 20,
-    4, 16, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 27, 2, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -9, 9,
-    0, 9, 22, 0, -22, 0, 0, 0,
-    0, -13, 0, 0, 0, 0, 0, -9,
-    8, 9, 0, 0, -4, 0, -4, 4,
-    0, -4, 0, -4, -2, -9, 0, 0,
-    0, 0, -4, 0, 0, -6, -7, 0,
-    0, -4, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, -4, 0,
-    0, 0, 0, 0, 0, -7, 0, 0,
-    -4, 0, 0, 0, 0, -13, 0, -53,
-    0, 0, -9, 0, 9, 13, 0, 0,
-    -9, 4, 4, 15, 9, -8, 9, 0,
-    0, -26, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -17, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -13, 0, 0, 0, 0, 0, 0,
-    -5, -24, 0, -18, -4, 0, 0, 0,
-    0, 2, 19, 0, -13, -2, -1, 1,
-    0, -8, 0, 0, -3, -35, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -36, -2, 20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, -17, -18, 0,
-    -1, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 14, 0,
-    4, 0, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 16, 2, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -17, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 3, 9, 4, 13,
-    -4, 0, 0, 9, -4, -14, -63, 4,
-    13, 9, 1, -6, 0, 18, 0, 16,
-    0, 16, 0, -41, 0, -5, 13, 0,
-    15, -4, 9, 4, 0, 0, 1, -4,
-    0, 0, -8, 36, 0, 36, 0, 13,
-    0, 20, 5, 8, 0, 0, 4, 0,
-    0, 13, 17, 5, -38, 36, 36, 36,
-    0, 0, 0, -17, 0, 0, 0, 0,
-    1, -3, 0, 4, -8, -5, -9, 4,
-    0, -4, 0, 0, 0, -18, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -29, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 4, -10, 4, 0, -39, -4,
-    0, 0, 0, 0, 1, -25, 0, -28,
-    0, 0, 0, 0, -3, 0, 46, -5,
-    -5, 4, 4, -6, 0, -5, 4, 0,
-    0, -23, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -44, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 1, 0, -4, -13,
-    0, -28, -55, 1, 4, 0, 0, 0,
-    0, 27, 0, 0, -17, 0, 14, 0,
-    -30, -44, -29, -9, 13, 0, 0, -30,
-    0, 7, -10, 0, -7, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 13, 13, -56, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -29, -4, 0, 18, -9, 22, 0, -24,
-    -34, 0, 0, 0, 0, 4, 0, 0,
-    0, 0, 0, 4, 4, -5, -9, 0,
-    -1, -1, -4, 0, 0, -4, 0, 0,
-    0, -9, 0, -3, 0, -10, -9, 0,
-    -11, -14, -14, -9, 0, -9, 0, -9,
-    0, 0, 0, 0, -4, 0, 0, 4,
-    0, 4, -4, 0, 0, 0, 0, -5,
-    0, 2, 0, 0, -13, 0, 0, 0,
-    0, 0, 0, 4, -4, 0, 0, 0,
-    -4, 4, 4, -2, 0, 0, 0, -10,
-    0, -2, 0, 0, 0, 0, 0, 1,
-    0, 5, -4, 0, -5, 0, -7, 0,
-    0, -4, 0, 13, 0, 0, -4, 0,
-    0, 0, 0, 0, -2, 2, -4, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -2, -2, 0, -4, -6, 0, 0,
-    0, 0, 0, 2, 0, 0, -3, 0,
-    -4, -4, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -3, 0, 0, 0,
-    0, -3, -5, 0, 0, 0, 0, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, -13, -4, -13, 9, 0, 0, -9,
-    4, 9, 13, 0, -11, -2, -7, 0,
-    -2, -22, 4, -4, 3, -23, 4, 0,
-    0, 1, -23, 0, -23, -3, -39, -4,
-    0, -22, 0, 9, 13, 0, 5, 0,
-    0, 0, 0, 0, 0, -7, -5, 0,
-    0, 4, 4, -4, 9, -13, -7, 0,
-    4, 0, 0, 0, 0, 0, 0, -4,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    0, -2, -2, 0, -2, -6, 0, 0,
-    0, 0, 0, 0, 0, -4, -4, 0,
-    -3, -5, -4, 0, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -3, -3, 0, 0, 0, 0, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, -4, 0, -9, 4, 0, 0, -7,
-    2, 4, 4, 0, 0, 0, 0, 0,
-    0, -4, 0, 0, 0, 0, 0, 4,
-    0, 0, -4, 0, -4, -4, -7, 0,
-    0, 0, 0, 0, 0, 0, 4, 0,
-    -4, 0, 0, 0, 0, -4, -7, 0,
-    0, 0, 4, 0, 9, -9, 0, 0,
-    0, 0, 0, 0, 0, 13, -4, 1,
-    -16, 0, 0, 13, -22, -24, -19, -9,
-    4, 0, -4, -29, -9, 0, -9, 0,
-    -9, 7, -9, -30, 0, -13, 0, 0,
-    2, -2, 3, -4, 0, 4, -1, -13,
-    -17, 0, -22, -12, -9, -12, -13, -7,
-    -13, -2, -10, -13, -13, -6, -9, 5,
-    -4, 2, 13, -8, -29, -12, -12, -12,
-    0, 2, 0, -4, 0, 0, 0, 4,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, 0, -2,
-    0, -2, -4, 0, -7, -9, -9, -2,
-    0, -13, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, 3, -2, 0,
-    0, 0, 0, -4, 4, 0, 0, 0,
-    -9, 0, 0, 0, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 20, 0,
-    0, 0, 0, 0, 0, 4, 0, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -8, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, -18,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, -10, 0, 0, 0,
-    0, -22, -13, 0, 0, 0, -7, -22,
-    0, 0, -4, 4, 0, -14, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -9, 0, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, -7, 0, 4, 0, 4,
-    -49, 0, 0, 0, 0, -9, 0, 0,
-    0, 0, 7, 0, 4, -9, -9, 0,
-    -4, -4, -5, 0, 0, 0, 0, 0,
-    0, -13, 0, -4, 0, -7, -4, 0,
-    -9, -11, -13, -4, 0, -9, 0, -13,
-    0, 0, 0, 0, 36, 0, 0, 2,
-    0, 0, -5, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, -9, 0, 0, 0,
-    0, -20, 0, 0, 0, 0, 0, -41,
-    -7, 15, 13, -3, -18, 0, 4, -7,
-    0, -22, -2, -6, 4, -31, -4, 4,
-    0, 7, -16, -7, -16, -14, -18, 0,
-    0, -27, 0, 26, 0, 0, -2, 0,
-    0, 0, -2, -2, -4, -12, -14, 0,
-    4, 0, 0, 0, 0, -41, -36, 7,
-    9, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    -2, -4, -7, 0, 0, -9, 0, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -2, 0, -9, 0, 0, 9,
-    -1, 6, 0, -10, 4, -4, -2, -13,
-    -4, 0, -6, -4, -3, 0, -7, -8,
-    0, 0, -4, -1, -4, -8, -7, 0,
-    0, -4, 0, 4, -4, 0, -10, 0,
-    0, 0, -9, 0, -8, 0, -8, -8,
-    -4, 0, 0, 0, -4, 4, 4, -1,
-    -7, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -9, 4, 0, -7,
-    0, -4, -7, -17, -4, -4, -4, -2,
-    -4, -7, -2, 0, 0, 0, 0, 0,
-    -4, -4, -4, 0, 0, 0, 0, 7,
-    -4, 0, -4, 0, 0, 0, -4, -7,
-    -4, -5, -7, -5, -4, 0, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    2, 18, -2, 0, -13, 0, -4, 9,
-    0, -4, -19, -6, 7, 0, 0, -22,
-    -8, 4, -8, 3, 0, -5, -4, -15,
-    0, -7, 2, 0, 0, -8, 0, 0,
-    0, 4, 4, -9, -9, 0, -8, -4,
-    -7, -4, -4, 0, -8, 2, -9, -8,
-    -4, 0, 0, 0, -4, 13, 4, -6,
-    -22, -4, 2, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -8, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -7, 0, 0, -6, 0,
-    0, -4, -4, 0, 0, 0, 0, -4,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    0, 0, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, -7, 0, -9, 0, 0, 0,
-    -14, 0, 4, -9, 9, 0, -4, -22,
-    0, 0, -9, -4, 0, -18, -11, -12,
-    0, 0, -18, -4, -18, -17, -21, 0,
-    -13, 0, 2, 30, -6, 0, -11, -4,
-    -2, -4, -8, -13, -9, -16, -17, -10,
-    0, 0, 0, 0, 0, -4, -2, -1,
-    0, -4, -4, -4, 0, 0, -4, 0,
-    1, 0, 0, -31, -6, 13, 11, -11,
-    -17, 0, 1, -17, 0, -22, -4, -4,
-    9, -43, -6, 1, 0, 0, -29, -6,
-    -24, -4, -33, 0, 0, -31, 0, 28,
-    1, 0, -4, 0, 0, 0, 0, -2,
-    -4, -17, -4, 0, 0, 0, 0, 0,
-    0, -29, -34, 4, 0, 0, 0, 0,
-    0, 0, 0, 0, -15, 0, -5, 0,
-    -1, -13, -22, 0, 0, -2, -7, -13,
-    -4, 0, -3, 0, 0, 0, 0, -20,
-    -4, -15, -15, -2, -7, -11, -4, -8,
-    0, -9, -5, -14, -7, 0, -6, -10,
-    -4, -10, 0, 2, 0, -4, -15, 0,
-    0, 0, 0, 0, 0, 9, 0, 0,
-    -24, -10, -10, -10, 0, -9, 0, 0,
-    0, 0, 7, 0, 4, -9, 17, 0,
-    -4, -4, -5, 0, 0, 0, 0, 0,
-    0, -13, 0, -4, 0, -7, -4, 0,
-    -9, -11, -13, -4, 0, -9, 2, 18,
-    0, 0, 0, 0, 36, 0, 0, 2,
-    0, 0, -5, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, -9, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, -9,
-    0, 0, 0, 0, 0, -2, 0, 0,
-    0, -4, -4, 0, 0, -9, -4, 0,
-    0, -9, 0, 8, -2, 0, 0, 0,
-    0, 0, 0, 2, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 7, 0, 0,
-    -4, 0, 0, 0, 9, 2, -5, 0,
-    -16, -9, 0, 13, -14, -14, -9, -9,
-    18, 7, 4, -39, -3, 9, -4, 0,
-    -4, 3, -4, -16, 0, -4, 4, -6,
-    -2, -13, -2, 0, 0, 13, 9, 0,
-    -13, 0, -25, -6, 10, -6, -17, 1,
-    -6, -15, -15, -4, -9, 0, 0, 0,
-    0, 18, 13, -5, -27, 8, 13, 7,
-    4, 0, -7, 0, -13, 0, 2, 15,
-    -10, -16, -18, -11, 13, 0, 1, -32,
-    -3, 4, -7, -3, -10, 0, -9, -16,
-    -7, -7, -2, 0, 0, -10, -9, -4,
-    0, 13, 10, -4, -25, 0, -25, -8,
-    0, -16, -26, -1, -14, -7, -15, -12,
-    -13, 0, 0, 0, 0, 13, 11, -5,
-    -33, 8, 14, 7, 0, 0, -6, 0,
-    -9, -5, 0, -4, -8, 0, 8, -14,
-    4, 0, 0, -23, 0, -4, -9, -7,
-    -3, -13, -11, -14, -11, 0, -13, -4,
-    -10, -10, -13, -4, 0, 0, 1, 22,
-    -7, 0, -13, -4, 0, -4, -9, -10,
-    -12, -11, -16, -5, -4, 0, 0, 0,
-    0, -9, 0, -2, 1, -4, -4, -4,
-    9, 0, -7, 0, -22, -7, 2, 9,
-    -14, -16, -9, -14, 14, -4, 2, -41,
-    -8, 9, -9, -7, -16, 0, -13, -18,
-    -7, -4, -2, -4, -9, -13, -1, 0,
-    0, 13, 11, -4, -29, 0, -27, -13,
-    9, -17, -30, -9, -16, -18, -22, -14,
-    -18, 0, 0, 0, -9, 9, 11, -7,
-    -37, 13, 11, 8, 0, 0, 0, 0,
-    -7, 0, 0, 4, -7, 9, 4, -9,
-    9, 0, 0, -17, -2, 0, -2, 0,
-    1, 1, -4, 0, 0, 0, 0, 0,
-    0, -4, 0, 0, 0, 0, 2, 13,
-    0, 0, -7, 0, 0, 0, 0, -4,
-    -4, -7, 0, 0, 1, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1, 2, 0, 0, 0, 0, 2, 0,
-    -4, 0, 16, 0, 7, 1, 1, -5,
-    0, 9, 0, 0, 0, 2, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 13, 0, 11, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    1, 0, 0, 4, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, -27, 0, -4,
-    8, 0, 13, 0, 0, 46, 7, -9,
-    -9, 4, 4, -4, 1, -22, 0, 0,
-    20, -27, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -29, 16, 63,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 18, 0, 0, 0,
-    13, -27, -13, 5, 13, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -9, 0, 0, -10, -5, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, 0, -13,
-    0, 0, 1, 0, 0, 4, 60, -9,
-    -4, 16, 13, -13, 4, 0, 0, 4,
-    4, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -58, 11, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 3, 8, -4, -4,
-    13, 0, -35, 4, 0, 0, 0, 0,
-    0, 0, 0, -13, 0, 0, 0, -13,
-    0, 0, 0, 0, -10, -2, 0, 0,
-    0, -10, 0, -7, 0, -22, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -30, 0, 0, 0, 0, 1, 0,
-    0, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, -9, -11, 0,
-    0, 0, 0, 0, 0, -7, 0, -13,
-    0, 0, 0, -8, 4, -7, 0, 0,
-    -13, -4, -11, 0, 0, -13, 0, -4,
-    0, -22, 0, -3, 0, 0, -38, -10,
-    -18, -3, -15, 0, 0, -30, 0, -13,
-    -1, 0, 0, 0, 0, 0, 0, 0,
-    0, -7, -9, -4, 0, 0, 0, 0,
-    0, -7, -11, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, -11, 0, -9, 5,
-    -3, 9, 0, -4, -11, -4, -8, -10,
-    0, -7, -2, -4, 3, -13, -1, 0,
-    0, 0, -43, -2, -4, 0, -7, 0,
-    -4, -22, -5, 0, 0, -4, -4, 0,
-    0, 0, 0, 3, 0, -4, -8, -4,
-    0, 0, 0, 0, -5, 7, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 1,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -11, 0, -4, 0, 0, 0, -9,
-    4, 0, 0, 0, -13, -4, -9, 0,
-    0, -13, 0, -4, 0, -22, 0, 0,
-    0, 0, -44, 0, -9, -16, -22, 0,
-    0, -30, 0, -3, -7, 0, 0, 0,
-    0, 0, 0, 0, 0, -4, -7, -2,
-    0, 0, 0, 0, 0, -7, -9, 0,
-    -4, 0, 0, 0, 1, 0, 0, 8,
-    -5, 0, 12, 24, -4, -4, -13, 7,
-    24, 8, 11, -13, 7, 20, 7, 14,
-    11, 13, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 29, 22, -7,
-    -4, 0, -4, 36, 19, 36, 0, 0,
-    0, 4, 0, 0, 0, 0, 0, 0,
-    0, 17, 20, -1, -5, 30, 20, 27,
-    0, 0, -9, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -4, 0, 0, 0,
-    0, 0, 0, 0, 0, 4, 0, 0,
-    0, 0, -41, -7, -2, -20, -24, 0,
-    0, -30, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -9, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, -41, -7,
-    -2, -20, -24, 0, 0, -22, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -2, 0, 0, 0,
-    -10, 4, 0, -4, 2, 7, 4, -13,
-    0, -2, -3, 4, 0, 2, 0, 0,
-    0, 0, -14, 0, -5, -4, -9, 0,
-    -5, -18, 0, 29, -4, 0, -9, -4,
-    0, -4, -7, 0, -4, -12, -9, -5,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, -4, -4, 0, 0, -9, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 4, 0, 0, 0, 0, -41, -7,
-    -2, -20, -24, 0, 0, -30, 0, 0,
-    0, 0, 0, 0, 22, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, -9, 0, -16, -7, -5, 13,
-    -5, -4, -18, 1, -4, 1, -4, -13,
-    0, 9, 0, 2, 1, 2, -12, -17,
-    -7, 0, -20, -10, -13, -19, -18, 0,
-    -9, -9, -7, -5, -4, -4, -6, -4,
-    0, -4, -2, 7, 0, 7, -4, 0,
-    0, 0, 0, 0, 4, 13, 13, 1,
-    -17, -4, -4, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, -4, -4, 0, 0, -13, 0, -2,
-    0, -8, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -27, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, -4, 0, 0, 0, 0, 0,
-    0, -6, -11, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -4, 0, 0, -8,
-    -4, 4, 0, -8, -9, -4, 0, -15,
-    -4, -11, -3, -7, 0, -8, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -30, 0, 16, 0, 0, -9, 0,
-    0, 0, 0, -6, 0, -4, 0, 0,
-    0, 0, 0, 0, -5, -2, -9, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    -10, 0, 0, 20, -5, -15, -13, 4,
-    3, 3, -2, -11, 4, 7, 4, 13,
-    4, 14, -4, -12, 0, 0, -22, 0,
-    0, -13, -13, 0, 0, -9, 0, -5,
-    -7, 0, -7, 0, -7, 0, -3, 7,
-    0, -2, -13, -4, 0, 0, 0, 0,
-    0, 17, 13, 0, -13, 0, 0, 0,
-    0, 0, -5, 0, -9, 0, 0, 5,
-    -10, 0, 4, -4, 2, -1, 0, -14,
-    0, -4, -1, 0, -4, 3, -2, 0,
-    0, 0, -22, -7, -9, 0, -13, 0,
-    0, -22, 0, 17, -4, 0, -9, 0,
-    -1, 0, -4, 0, -4, -13, 0, -4,
-    0, 0, 0, 0, 0, 4, 1, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 4, -6, 1, 0, 0,
-    -7, -4, 0, -7, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -29, 0, 11,
-    0, 0, -4, 0, 0, 0, 0, 0,
-    0, -4, -4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 18, 0, -9, 0, 0, 0,
-    0, 0, 0, 0, 0, -1, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -25, 1, 3, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, -4, 0,
-    -18, 0, 0, 13, -13, -1, 5, -17,
-    8, -4, -4, -17, -5, 4, -15, -9,
-    -13, 0, -6, -20, 0, -9, 0, 0,
-    0, -4, 4, 0, 0, 8, 1, 8,
-    -18, 0, -13, -9, -11, -9, -18, -9,
-    -13, -9, -11, -18, -11, 0, 0, 0,
-    -4, 0, 7, -5, -10, -9, 11, 2,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    4, -4, 0, 0, 0, -4, 0, 0,
-    0, -7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, -4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -4, 0, 0, 0, 3, 9, 0, 0,
-    0, 0, 4, 0, -10, -13, -13, -5,
-    13, 0, 4, -4, 0, 13, -4, 0,
-    -18, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 22, 4, -4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -9, 0, 0, 0,
-    0, 0, 0, 0, -18, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    9, 0, 11, 0, 0, 0, 0, 8,
-    0, 4, 4, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 4, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, -4, 1, 5, 0,
-    -1, 0, 0, 4, 4, 0, 0, 0,
-    0, -4, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -26, 0, 4,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 4, 0, 0, 0,
-    0, 9, 0, 10, 0, 0, 0, 0,
-    0, -28, -26, 2, 19, 13, 7, -18,
-    4, 20, 0, 17, 0, 9, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 23, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -29, 0, 0, 0, -1, -13, 0, -27,
-    -8, 0, 0, 0, -18, 1, 18, -20,
-    -19, 0, 0, -19, 0, -19, -19, 0,
-    -1, -59, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, -44, 2, 22,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 2, -10, -22,
-    1, -25, -39, -4, -13, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -11, -13, 0, -9, -11, -9, 0,
-    -4, 0, 0, 0, 0, -13, 0, -13,
-    0, -18, -11, 0, -4, -13, -13, -9,
-    0, -18, 0, -13, -4, 0, 0, 0,
-    -4, 0, 0, 2, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    -11, 0, 0, 0, 0, 0, -9, 0,
-    0, 0, 0, 36, 0, 0, 0, 0,
-    -4, 0, 0, 0, 0, 0, 0, 0,
-    0, 18, 0, 0, 0, 0, -41, -7,
-    -2, -20, -24, 0, 0, -30, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 4,
-    0, -9, 0, 4, 0, 0, -4, 0,
-    0, 0, 0, 0, 0, -4, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, -4, 0, -9, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 9, 0, 0,
-    -4, 0, 0, 0
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 20, 0, 13, -11, 0, 0, 0, 0, -25, -27, 4, 22, 11, 8,
+    -18, 4, 24, 2, 20, 4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 27, 2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, -13, 0, 0, 0, 0, 0, -9, 8, 9, 0, 0, -4, 0,
+    -4, 4, 0, -4, 0, -4, -2, -9, 0, 0, 0, 0, -4, 0, 0, -6,
+    -7, 0, 0, -4, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4,
+    -4, 0, -7, 0, -13, 0, -53, 0, 0, -9, 0, 9, 13, 0, 0, -9,
+    4, 4, 15, 9, -8, 9, 0, 0, -26, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -13, -5, -24, 0, -18, -4, 0, 0, 0, 0, 2, 19, 0,
+    -13, -2, -1, 1, 0, -8, 0, 0, -3, -35, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -36, -2, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 4, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 16, 2, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 9, 4, 13, -4, 0, 0, 9, -4,
+    -14, -63, 4, 13, 9, 1, -6, 0, 18, 0, 16, 0, 16, 0, -41, 0,
+    -5, 13, 0, 15, -4, 9, 4, 0, 0, 1, -4, 0, 0, -8, 36, 0,
+    36, 0, 13, 0, 20, 5, 8, 13, 0, 0, 0, -17, 0, 0, 0, 0,
+    1, -3, 0, 4, -8, -5, -9, 4, 0, -4, 0, 0, 0, -18, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -29, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -25, 0, -28, 0, 0, 0,
+    0, -3, 0, 46, -5, -5, 4, 4, -6, 0, -5, 4, 0, 0, -23, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -44, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -28, 0, 27, 0, 0, -17, 0,
+    14, 0, -30, -44, -29, -9, 13, 0, 0, -30, 0, 7, -10, 0, -7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, -56, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 4, 0, 0, 0,
+    0, 0, 4, 4, -5, -9, 0, -1, -1, -4, 0, 0, -4, 0, 0, 0,
+    -9, 0, -3, 0, -10, -9, 0, -11, -14, -14, -9, 0, -9, 0, -9, 0,
+    0, 0, 0, -4, 0, 0, 4, 0, 4, -4, 0, 2, 0, 0, 0, 4,
+    -4, 0, 0, 0, -4, 4, 4, -2, 0, 0, 0, -10, 0, -2, 0, 0,
+    0, 0, 0, 1, 0, 5, -4, 0, -5, 0, -7, 0, 0, -4, 0, 13,
+    0, 0, -4, 0, 0, 0, 0, 0, -2, 2, -4, -4, 0, 0, -4, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -4, -6, 0,
+    0, 0, 0, 0, 2, 0, 0, -3, 0, -4, -4, -4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, -5, 0, -7, 0, -13,
+    -4, -13, 9, 0, 0, -9, 4, 9, 13, 0, -11, -2, -7, 0, -2, -22,
+    4, -4, 3, -23, 4, 0, 0, 1, -23, 0, -23, -3, -39, -4, 0, -22,
+    0, 9, 13, 0, 5, 0, 0, 0, 0, 0, 0, -7, -5, 0, -13, 0,
+    0, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2, -2, 0, -2,
+    -6, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, -3, -5, -4, 0, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, -7,
+    0, -4, 0, -9, 4, 0, 0, -7, 2, 4, 4, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 4, 0, 0, -4, 0, -4, -4, -7, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, -4, 0, 0, 0, 0, -4, -7, 0,
+    -9, 0, 13, -4, 1, -16, 0, 0, 13, -22, -24, -19, -9, 4, 0, -4,
+    -29, -9, 0, -9, 0, -9, 7, -9, -30, 0, -13, 0, 0, 2, -2, 3,
+    -4, 0, 4, -1, -13, -17, 0, -22, -12, -9, -12, -13, -7, -13, -2, -10,
+    -13, 2, 0, 2, 0, -4, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, -2, -4, 0, -7, -9,
+    -9, -2, 0, -13, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 3,
+    -2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -8, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0, -10, 0, 0, 0, 0, -22, -13, 0,
+    0, 0, -7, -22, 0, 0, -4, 4, 0, -14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -9, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, -9, 0, 0, 0, 0, 7, 0, 4, -9, -9,
+    0, -4, -4, -5, 0, 0, 0, 0, 0, 0, -13, 0, -4, 0, -7, -4,
+    0, -9, -11, -13, -4, 0, -9, 0, -13, 0, 0, 0, 0, 36, 0, 0,
+    2, 0, 0, -5, 0, 4, 0, -20, 0, 0, 0, 0, 0, -41, -7, 15,
+    13, -3, -18, 0, 4, -7, 0, -22, -2, -6, 4, -31, -4, 4, 0, 7,
+    -16, -7, -16, -14, -18, 0, 0, -27, 0, 26, 0, 0, -2, 0, 0, 0,
+    -2, -2, -4, -12, -14, 0, -41, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, -2, -4, -7, 0, 0, -9, 0, -4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -9, 0, 0, 9,
+    -1, 6, 0, -10, 4, -4, -2, -13, -4, 0, -6, -4, -3, 0, -7, -8,
+    0, 0, -4, -1, -4, -8, -7, 0, 0, -4, 0, 4, -4, 0, -10, 0,
+    0, 0, -9, 0, -8, 0, -8, -8, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, 4, 0, -7, 0, -4, -7, -17, -4, -4, -4, -2, -4, -7, -2,
+    0, 0, 0, 0, 0, -4, -4, -4, 0, 0, 0, 0, 7, -4, 0, -4,
+    0, 0, 0, -4, -7, -4, -5, -7, -5, 0, 2, 18, -2, 0, -13, 0,
+    -4, 9, 0, -4, -19, -6, 7, 0, 0, -22, -8, 4, -8, 3, 0, -5,
+    -4, -15, 0, -7, 2, 0, 0, -8, 0, 0, 0, 4, 4, -9, -9, 0,
+    -8, -4, -7, -4, -4, 0, -8, 2, -9, -8, 13, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -7, 0, 0, -6, 0, 0, -4, -4, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0,
+    -7, 0, -9, 0, 0, 0, -14, 0, 4, -9, 9, 0, -4, -22, 0, 0,
+    -9, -4, 0, -18, -11, -12, 0, 0, -18, -4, -18, -17, -21, 0, -13, 0,
+    2, 30, -6, 0, -11, -4, -2, -4, -8, -13, -9, -16, -17, -10, -4, 0,
+    0, -4, 0, 1, 0, 0, -31, -6, 13, 11, -11, -17, 0, 1, -17, 0,
+    -22, -4, -4, 9, -43, -6, 1, 0, 0, -29, -6, -24, -4, -33, 0, 0,
+    -31, 0, 28, 1, 0, -4, 0, 0, 0, 0, -2, -4, -17, -4, 0, -29,
+    0, 0, 0, 0, -15, 0, -5, 0, -1, -13, -22, 0, 0, -2, -7, -13,
+    -4, 0, -3, 0, 0, 0, 0, -20, -4, -15, -15, -2, -7, -11, -4, -8,
+    0, -9, -5, -14, -7, 0, -6, -10, -4, -10, 0, 2, 0, -4, -15, 0,
+    9, 0, -9, 0, 0, 0, 0, 7, 0, 4, -9, 17, 0, -4, -4, -5,
+    0, 0, 0, 0, 0, 0, -13, 0, -4, 0, -7, -4, 0, -9, -11, -13,
+    -4, 0, -9, 2, 18, 0, 0, 0, 0, 36, 0, 0, 2, 0, 0, -5,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -4, -9, 0, 0, 0, 0, 0, -2, 0, 0, 0, -4, -4, 0, 0, -9,
+    -4, 0, 0, -9, 0, 8, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 7, 9, 2, -5, 0, -16, -9, 0, 13, -14, -14, -9, -9, 18,
+    7, 4, -39, -3, 9, -4, 0, -4, 3, -4, -16, 0, -4, 4, -6, -2,
+    -13, -2, 0, 0, 13, 9, 0, -13, 0, -25, -6, 10, -6, -17, 1, -6,
+    -15, -15, -4, 18, 4, 0, -7, 0, -13, 0, 2, 15, -10, -16, -18, -11,
+    13, 0, 1, -32, -3, 4, -7, -3, -10, 0, -9, -16, -7, -7, -2, 0,
+    0, -10, -9, -4, 0, 13, 10, -4, -25, 0, -25, -8, 0, -16, -26, -1,
+    -14, -7, -15, -12, 13, 0, 0, -6, 0, -9, -5, 0, -4, -8, 0, 8,
+    -14, 4, 0, 0, -23, 0, -4, -9, -7, -3, -13, -11, -14, -11, 0, -13,
+    -4, -10, -10, -13, -4, 0, 0, 1, 22, -7, 0, -13, -4, 0, -4, -9,
+    -10, -12, -11, -16, -5, -9, 9, 0, -7, 0, -22, -7, 2, 9, -14, -16,
+    -9, -14, 14, -4, 2, -41, -8, 9, -9, -7, -16, 0, -13, -18, -7, -4,
+    -2, -4, -9, -13, -1, 0, 0, 13, 11, -4, -29, 0, -27, -13, 9, -17,
+    -30, -9, -16, -18, -22, -14, 9, 0, 0, 0, 0, -7, 0, 0, 4, -7,
+    9, 4, -9, 9, 0, 0, -17, -2, 0, -2, 0, 1, 1, -4, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0, 0, 2, 13, 0, 0, -7, 0, 0,
+    0, 0, -4, -4, -7, 0, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0,
+    -4, 0, 16, 0, 7, 1, 1, -5, 0, 9, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 11, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -27, 0, -4, 8, 0, 13,
+    0, 0, 46, 7, -9, -9, 4, 4, -4, 1, -22, 0, 0, 20, -27, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29, 16, 63, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -27, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -9, 0, 0, -10, -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -13, 0,
+    0, 1, 0, 0, 4, 60, -9, -4, 16, 13, -13, 4, 0, 0, 4, 4,
+    -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -58, 11, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -13,
+    0, 0, 0, -13, 0, 0, 0, 0, -10, -2, 0, 0, 0, -10, 0, -7,
+    0, -22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -30, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, -4, 0, 0, -9, 0, -7, 0,
+    -13, 0, 0, 0, -8, 4, -7, 0, 0, -13, -4, -11, 0, 0, -13, 0,
+    -4, 0, -22, 0, -3, 0, 0, -38, -10, -18, -3, -15, 0, 0, -30, 0,
+    -13, -1, 0, 0, 0, 0, 0, 0, 0, 0, -7, -9, -4, -7, 0, 0,
+    0, 0, -11, 0, -9, 5, -3, 9, 0, -4, -11, -4, -8, -10, 0, -7,
+    -2, -4, 3, -13, -1, 0, 0, 0, -43, -2, -4, 0, -7, 0, -4, -22,
+    -5, 0, 0, -4, -4, 0, 0, 0, 0, 3, 0, -4, -8, -4, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -11, 0, -4, 0, 0, 0, -9, 4, 0, 0, 0, -13, -4, -9, 0,
+    0, -13, 0, -4, 0, -22, 0, 0, 0, 0, -44, 0, -9, -16, -22, 0,
+    0, -30, 0, -3, -7, 0, 0, 0, 0, 0, 0, 0, 0, -4, -7, -2,
+    -7, 1, 0, 0, 8, -5, 0, 12, 24, -4, -4, -13, 7, 24, 8, 11,
+    -13, 7, 20, 7, 14, 11, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 29, 22, -7, -4, 0, -4, 36, 19, 36, 0, 0, 0, 4, 0,
+    0, 17, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -41, -7, -2, -20,
+    -24, 0, 0, -30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -41, -7, -2,
+    -20, -24, 0, 0, -22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -10, 4, 0, -4,
+    2, 7, 4, -13, 0, -2, -3, 4, 0, 2, 0, 0, 0, 0, -14, 0,
+    -5, -4, -9, 0, -5, -18, 0, 29, -4, 0, -9, -4, 0, -4, -7, 0,
+    -4, -12, -9, -5, 0, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -41,
+    -7, -2, -20, -24, 0, 0, -30, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -9, 0, -16, -7, -5, 13, -5, -4,
+    -18, 1, -4, 1, -4, -13, 0, 9, 0, 2, 1, 2, -12, -17, -7, 0,
+    -20, -10, -13, -19, -18, 0, -9, -9, -7, -5, -4, -4, -6, -4, 0, -4,
+    -2, 7, 0, 7, -4, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -4, -4, 0, 0, -13, 0, -2, 0, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -27, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, -4, 0, -6, 0, 0, 0, 0, -4, 0, 0, -8,
+    -4, 4, 0, -8, -9, -4, 0, -15, -4, -11, -3, -7, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -30, 0, 16, 0, 0, -9, 0,
+    0, 0, 0, -6, 0, -4, 0, 0, -2, 0, 0, -4, 0, -10, 0, 0,
+    20, -5, -15, -13, 4, 3, 3, -2, -11, 4, 7, 4, 13, 4, 14, -4,
+    -12, 0, 0, -22, 0, 0, -13, -13, 0, 0, -9, 0, -5, -7, 0, -7,
+    0, -7, 0, -3, 7, 0, -2, -13, -4, 17, 0, 0, -5, 0, -9, 0,
+    0, 5, -10, 0, 4, -4, 2, -1, 0, -14, 0, -4, -1, 0, -4, 3,
+    -2, 0, 0, 0, -22, -7, -9, 0, -13, 0, 0, -22, 0, 17, -4, 0,
+    -9, 0, -1, 0, -4, 0, -4, -13, 0, -4, 4, 0, 0, 0, 0, -4,
+    0, 0, 4, -6, 1, 0, 0, -7, -4, 0, -7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -29, 0, 11, 0,
+    0, -4, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 9, 0, 10,
+    0, 0, 0, 0, 0, -28, -26, 2, 19, 13, 7, -18, 4, 20, 0, 17,
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
-
-/*Collect the kern class' data in one place*/
-static const lv_font_fmt_txt_kern_classes_t kern_classes =
-{
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
     .class_pair_values   = kern_class_values,
     .left_class_mapping  = kern_left_class_mapping,
     .right_class_mapping = kern_right_class_mapping,
-    .left_class_cnt      = 71,
-    .right_class_cnt     = 60,
+    .left_class_cnt      = 61,
+    .right_class_cnt     = 49,
 };
 
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
+static lv_font_fmt_txt_glyph_cache_t cache;
 
-#if LVGL_VERSION_MAJOR == 8
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-#endif
-
-#if LVGL_VERSION_MAJOR >= 8
 static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
     .glyph_bitmap = glyph_bitmap,
     .glyph_dsc = glyph_dsc,
     .cmaps = cmaps,
     .kern_dsc = &kern_classes,
     .kern_scale = 16,
-    .cmap_num = 4,
+    .cmap_num = 2,
     .bpp = 4,
     .kern_classes = 1,
     .bitmap_format = 0,
-#if LVGL_VERSION_MAJOR == 8
     .cache = &cache
-#endif
-
 };
 
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LVGL_VERSION_MAJOR >= 8
 const lv_font_t montserrat_se_28 = {
-#else
-lv_font_t montserrat_se_28 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 35,          /*The maximum line height required by the font*/
-    .base_line = 7,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 35,
+    .base_line = 7,
     .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
     .underline_position = -2,
     .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-#if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .dsc = &font_dsc,
     .fallback = NULL,
-#endif
     .user_data = NULL,
 };
-
-
-
-#endif /*#if MONTSERRAT_SE_28*/